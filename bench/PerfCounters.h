@@ -0,0 +1,127 @@
+#pragma once
+
+// Contadores hardware del hilo actual con perf_event_open (Linux).
+//
+//   PerfCounters counters;
+//   counters.start();
+//   ...
+//   const CounterSample s = counters.stop();
+//   if (s.has(Counter::Instructions)) ...
+//
+// Un grupo de eventos (ciclos, instrucciones, referencias y fallos de la
+// LLC) que se leen juntos, en espacio de usuario, escalados si el kernel
+// los multiplexa. Sin PMU (VMs, contenedores, perf_event_paranoid > 2)
+// available() es false y stop() devuelve muestras vacías: la suite sigue
+// midiendo tiempo. Solo cuenta el hilo que llama a start(), no los hilos
+// de un ThreadPool.
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace TinyGeo {
+namespace perf {
+
+    enum class Counter : size_t { Cycles, Instructions, CacheReferences, CacheMisses };
+    inline constexpr size_t kCounterCount = 4;
+
+    struct CounterSample {
+        uint64_t values[kCounterCount] = {};
+        bool valid[kCounterCount] = {};
+
+        bool has(Counter c) const { return valid[size_t(c)]; }
+        double get(Counter c) const { return double(values[size_t(c)]); }
+    };
+
+    class PerfCounters {
+    public:
+        PerfCounters() {
+#if defined(__linux__)
+            static constexpr uint64_t kConfig[kCounterCount] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                                 PERF_COUNT_HW_CACHE_REFERENCES,
+                                                                 PERF_COUNT_HW_CACHE_MISSES};
+            for (size_t c = 0; c < kCounterCount; ++c) {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.size = sizeof(attr);
+                attr.config = kConfig[c];
+                attr.disabled = leader_ < 0 ? 1 : 0; // El grupo se activa por el líder
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                const int fd = int(::syscall(SYS_perf_event_open, &attr, 0, -1, leader_, 0));
+                if (fd < 0) {
+                    if (leader_ < 0) {
+                        error_ = std::string("perf_event_open: ") + std::strerror(errno);
+                        return;
+                    }
+                    continue; // Evento no soportado: el resto del grupo sigue
+                }
+                if (leader_ < 0) leader_ = fd;
+                fds_[opened_] = fd;
+                slot_[opened_++] = c;
+            }
+#else
+            error_ = "hardware counters need Linux perf_event";
+#endif
+        }
+
+        ~PerfCounters() {
+#if defined(__linux__)
+            for (size_t i = 0; i < opened_; ++i) ::close(fds_[i]);
+#endif
+        }
+
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        bool available() const { return leader_ >= 0; }
+        const std::string& error() const { return error_; }
+
+        void start() {
+#if defined(__linux__)
+            if (!available()) return;
+            ::ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ::ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+        }
+
+        CounterSample stop() {
+            CounterSample s;
+#if defined(__linux__)
+            if (!available()) return s;
+            ::ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+            // nr, time_enabled, time_running, values[nr]
+            uint64_t buf[3 + kCounterCount] = {};
+            if (::read(leader_, buf, sizeof(buf)) < ssize_t(3 * sizeof(uint64_t))) return s;
+            const uint64_t enabled = buf[1], running = buf[2];
+            if (running == 0) return s; // El grupo no llegó a planificarse
+            const double scale = double(enabled) / double(running);
+            for (size_t i = 0; i < opened_ && i < buf[0]; ++i) {
+                s.values[slot_[i]] = uint64_t(double(buf[3 + i]) * scale);
+                s.valid[slot_[i]] = true;
+            }
+#endif
+            return s;
+        }
+
+    private:
+        int leader_ = -1;
+        int fds_[kCounterCount] = {};
+        size_t slot_[kCounterCount] = {};
+        size_t opened_ = 0;
+        std::string error_;
+    };
+
+} // namespace perf
+} // namespace TinyGeo
@@ -0,0 +1,335 @@
+// Benchmarks de todas las operaciones de Vector (Google Benchmark).
+//
+// Cada operación se mide para float/double y N = 2, 3, 4, 8, 16 en dos modos:
+//   <Op>/<T>/<N>/latency     una operación aislada por iteración
+//   <Op>/<T>/<N>/throughput  la operación sobre un array de kArraySize elementos
+//
+// Salida JSON:  tinygeo_bench --benchmark_format=json
+// (o el target 'bench_json', que escribe bench_output.json en el build).
+// El contexto incluye "simd_backend" para comparar ejecuciones escalares
+// (tinygeo_bench_scalar) y SIMD.
+//
+// Reducciones de Reduction.h sobre arrays largos, una por política:
+//   ReductionDot/<policy>/<T>/<n>   n = 4K, 64K, 1M
+//   ReductionSum/<policy>/<T>/<n>
+// (respaldan que pairwise y kahan en float no son más lentos que widened).
+//
+// Predicados robustos, 256 casos por iteración (items = llamadas):
+//   Predicate/<pred>/random   puntos genéricos: decide el filtro
+//   Predicate/<pred>/grid     degenerados en rejilla entera: el filtro
+//                             falla y decide la etapa B (diferencias exactas)
+//   Predicate/<pred>/near     casi degenerados con coordenadas arbitrarias:
+//                             etapa B o, si no basta, la D
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "TinyGeo/Predicates.h"
+#include "TinyGeo/Reduction.h"
+#include "TinyGeo/Vector.h"
+
+namespace {
+
+    using namespace TinyGeo;
+
+    constexpr size_t kArraySize = 1024;
+
+    // --- Operaciones: apply(a, b, s) devuelve Vector o escalar ---
+
+    struct OpAdd       { template <class V, class T> static V apply(const V& a, const V& b, T)   { return a + b; } };
+    struct OpSub       { template <class V, class T> static V apply(const V& a, const V& b, T)   { return a - b; } };
+    struct OpMulScalar { template <class V, class T> static V apply(const V& a, const V&, T s)   { return a * s; } };
+    struct OpDivScalar { template <class V, class T> static V apply(const V& a, const V&, T s)   { return a / s; } };
+    struct OpAddAssign { template <class V, class T> static V apply(V a, const V& b, T)          { a += b; return a; } };
+    struct OpSubAssign { template <class V, class T> static V apply(V a, const V& b, T)          { a -= b; return a; } };
+    struct OpMulAssign { template <class V, class T> static V apply(V a, const V&, T s)          { a *= s; return a; } };
+    struct OpDivAssign { template <class V, class T> static V apply(V a, const V&, T s)          { a /= s; return a; } };
+    struct OpDot       { template <class V, class T> static T apply(const V& a, const V& b, T)   { return dot(a, b); } };
+    struct OpNormSq    { template <class V, class T> static T apply(const V& a, const V&, T)     { return a.normSq(); } };
+    struct OpNorm      { template <class V, class T> static T apply(const V& a, const V&, T)     { return a.norm(); } };
+    struct OpNormalized     { template <class V, class T> static V apply(const V& a, const V&, T) { return a.normalized(); } };
+    struct OpFastNormalized { template <class V, class T> static V apply(const V& a, const V&, T) { return a.fastNormalized(); } };
+    struct OpCross     { template <class V, class T> static V apply(const V& a, const V& b, T)   { return cross(a, b); } };
+
+    template <typename T, size_t N>
+    Vector<T, N> makeVector(size_t seed) {
+        Vector<T, N> v;
+        for (size_t k = 0; k < N; ++k) {
+            v[k] = static_cast<T>(1.0 + std::sin(double(seed * N + k)));
+        }
+        return v;
+    }
+
+    template <typename Op, typename T, size_t N>
+    void latency(benchmark::State& state) {
+        Vector<T, N> a = makeVector<T, N>(1);
+        Vector<T, N> b = makeVector<T, N>(2);
+        T s = T(1.5);
+        for (auto _ : state) {
+            // Evita que el compilador saque la operación fuera del loop
+            benchmark::DoNotOptimize(a);
+            benchmark::DoNotOptimize(b);
+            benchmark::DoNotOptimize(s);
+            auto r = Op::apply(a, b, s);
+            benchmark::DoNotOptimize(r);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template <typename Op, typename T, size_t N>
+    void throughput(benchmark::State& state) {
+        using V = Vector<T, N>;
+        using R = decltype(Op::apply(std::declval<const V&>(), std::declval<const V&>(), T()));
+        std::vector<V> a(kArraySize), b(kArraySize);
+        std::vector<R> out(kArraySize);
+        for (size_t i = 0; i < kArraySize; ++i) {
+            a[i] = makeVector<T, N>(i);
+            b[i] = makeVector<T, N>(i + kArraySize);
+        }
+        const T s = T(1.5);
+        for (auto _ : state) {
+            for (size_t i = 0; i < kArraySize; ++i) {
+                out[i] = Op::apply(a[i], b[i], s);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * int64_t(kArraySize));
+        state.SetBytesProcessed(state.iterations() * int64_t(kArraySize * (2 * sizeof(V) + sizeof(R))));
+    }
+
+    template <typename Op, typename T, size_t N>
+    void registerOp(const std::string& op, const std::string& type) {
+        const std::string base = op + "/" + type + "/" + std::to_string(N);
+        benchmark::RegisterBenchmark((base + "/latency").c_str(), latency<Op, T, N>);
+        benchmark::RegisterBenchmark((base + "/throughput").c_str(), throughput<Op, T, N>);
+    }
+
+    template <typename T, size_t N>
+    void registerDimension(const std::string& type) {
+        registerOp<OpAdd, T, N>("Add", type);
+        registerOp<OpSub, T, N>("Sub", type);
+        registerOp<OpMulScalar, T, N>("MulScalar", type);
+        registerOp<OpDivScalar, T, N>("DivScalar", type);
+        registerOp<OpAddAssign, T, N>("AddAssign", type);
+        registerOp<OpSubAssign, T, N>("SubAssign", type);
+        registerOp<OpMulAssign, T, N>("MulAssign", type);
+        registerOp<OpDivAssign, T, N>("DivAssign", type);
+        registerOp<OpDot, T, N>("Dot", type);
+        registerOp<OpNormSq, T, N>("NormSq", type);
+        registerOp<OpNorm, T, N>("Norm", type);
+        registerOp<OpNormalized, T, N>("Normalized", type);
+        registerOp<OpFastNormalized, T, N>("FastNormalized", type);
+        if constexpr (N == 3) {
+            registerOp<OpCross, T, N>("Cross", type);
+        }
+    }
+
+    // --- Reducciones con política de precisión ---
+
+    template <typename P, typename T>
+    void reductionDot(benchmark::State& state) {
+        const size_t n = size_t(state.range(0));
+        std::vector<T> a(n), b(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<T>(1.0 + std::sin(double(i)));
+            b[i] = static_cast<T>(1.0 + std::cos(double(i)));
+        }
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(a.data());
+            benchmark::DoNotOptimize(b.data());
+            auto r = reduction::dot(P{}, a.data(), b.data(), n);
+            benchmark::DoNotOptimize(r);
+        }
+        state.SetItemsProcessed(state.iterations() * int64_t(n));
+        state.SetBytesProcessed(state.iterations() * int64_t(2 * n * sizeof(T)));
+    }
+
+    template <typename P, typename T>
+    void reductionSum(benchmark::State& state) {
+        const size_t n = size_t(state.range(0));
+        std::vector<T> a(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<T>(1.0 + std::sin(double(i)));
+        }
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(a.data());
+            auto r = reduction::sum(P{}, a.data(), n);
+            benchmark::DoNotOptimize(r);
+        }
+        state.SetItemsProcessed(state.iterations() * int64_t(n));
+        state.SetBytesProcessed(state.iterations() * int64_t(n * sizeof(T)));
+    }
+
+    template <typename P, typename T>
+    void registerReduction(const std::string& policy, const std::string& type) {
+        benchmark::RegisterBenchmark(("ReductionDot/" + policy + "/" + type).c_str(), reductionDot<P, T>)
+            ->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+        benchmark::RegisterBenchmark(("ReductionSum/" + policy + "/" + type).c_str(), reductionSum<P, T>)
+            ->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+    }
+
+    template <typename T>
+    void registerReductions(const std::string& type) {
+        registerReduction<reduction::NaivePolicy, T>("naive", type);
+        registerReduction<reduction::WidenedPolicy, T>("widened", type);
+        registerReduction<reduction::PairwisePolicy, T>("pairwise", type);
+        registerReduction<reduction::KahanPolicy, T>("kahan", type);
+    }
+
+    // --- Predicados robustos: filtro / etapa B / etapa D ---
+
+    using P2 = Vector<double, 2>;
+    using P3 = Vector<double, 3>;
+
+    constexpr size_t kPredicateCases = 256;
+
+    double uniform(uint32_t& s, double lo, double hi) {
+        s = s * 1664525u + 1013904223u;
+        return lo + (hi - lo) * double(s >> 8) / double(1u << 24);
+    }
+
+    template <typename P, size_t K, typename Gen, typename Pred>
+    void registerPredicate(const std::string& name, Gen&& gen, Pred pred) {
+        std::vector<std::array<P, K>> cases(kPredicateCases);
+        uint32_t seed = 1;
+        for (auto& c : cases) {
+            for (auto& p : c) p = gen(seed);
+        }
+        benchmark::RegisterBenchmark(("Predicate/" + name).c_str(), [cases = std::move(cases), pred](benchmark::State& state) {
+            for (auto _ : state) {
+                double acc = 0.0;
+                for (const auto& c : cases) acc += pred(c);
+                benchmark::DoNotOptimize(acc);
+            }
+            state.SetItemsProcessed(state.iterations() * int64_t(cases.size()));
+        });
+    }
+
+    // Puntos enteros de x^2 + y^2 = 25 y de x^2 + y^2 + z^2 = 9
+    const std::vector<P2>& circleGrid() {
+        static const std::vector<P2> pts = [] {
+            std::vector<P2> v;
+            for (int x = -5; x <= 5; ++x) {
+                for (int y = -5; y <= 5; ++y) {
+                    if (x * x + y * y == 25) v.push_back(P2(100.0 + x, -37.0 + y));
+                }
+            }
+            return v;
+        }();
+        return pts;
+    }
+
+    const std::vector<P3>& sphereGrid() {
+        static const std::vector<P3> pts = [] {
+            std::vector<P3> v;
+            for (int x = -3; x <= 3; ++x) {
+                for (int y = -3; y <= 3; ++y) {
+                    for (int z = -3; z <= 3; ++z) {
+                        if (x * x + y * y + z * z == 9) v.push_back(P3(5.0 + x, -2.0 + y, 7.0 + z));
+                    }
+                }
+            }
+            return v;
+        }();
+        return pts;
+    }
+
+    template <typename P>
+    P pick(const std::vector<P>& pts, uint32_t& seed) {
+        return pts[size_t(uniform(seed, 0.0, double(pts.size()))) % pts.size()];
+    }
+
+    void registerPredicates() {
+        auto o2 = [](const std::array<P2, 3>& c) { return orient2d(c[0], c[1], c[2]); };
+        auto o3 = [](const std::array<P3, 4>& c) { return orient3d(c[0], c[1], c[2], c[3]); };
+        auto ic = [](const std::array<P2, 4>& c) { return incircle(c[0], c[1], c[2], c[3]); };
+        auto is = [](const std::array<P3, 5>& c) { return insphere(c[0], c[1], c[2], c[3], c[4]); };
+
+        auto random2 = [](uint32_t& s) { return P2(uniform(s, -1.0, 1.0), uniform(s, -1.0, 1.0)); };
+        auto random3 = [](uint32_t& s) { return P3(uniform(s, -1.0, 1.0), uniform(s, -1.0, 1.0), uniform(s, -1.0, 1.0)); };
+
+        // orient2d: recta y = 2x + 1 en enteros / rejilla de ulps de Kettner et al.
+        registerPredicate<P2, 3>("orient2d/random", random2, o2);
+        registerPredicate<P2, 3>("orient2d/grid", [](uint32_t& s) {
+            const double x = std::floor(uniform(s, -100.0, 100.0));
+            return P2(x, 2.0 * x + 1.0);
+        }, o2);
+        registerPredicate<P2, 3>("orient2d/near", [](uint32_t& s) {
+            static int k = 0;
+            const double ulp = std::ldexp(1.0, -53);
+            switch (k++ % 3) {
+                case 0: return P2(0.5 + std::floor(uniform(s, 0.0, 256.0)) * ulp, 0.5 + std::floor(uniform(s, 0.0, 256.0)) * ulp);
+                case 1: return P2(12.0, 12.0);
+                default: return P2(24.0, 24.0);
+            }
+        }, o2);
+
+        // orient3d: plano x + y + z = 12 en enteros / plano x + y + z = 1 redondeado
+        registerPredicate<P3, 4>("orient3d/random", random3, o3);
+        registerPredicate<P3, 4>("orient3d/grid", [](uint32_t& s) {
+            const double x = std::floor(uniform(s, -8.0, 8.0)), y = std::floor(uniform(s, -8.0, 8.0));
+            return P3(x, y, 12.0 - x - y);
+        }, o3);
+        registerPredicate<P3, 4>("orient3d/near", [](uint32_t& s) {
+            const double x = uniform(s, -10.0, 10.0), y = uniform(s, -10.0, 10.0);
+            return P3(x, y, 1.0 - x - y);
+        }, o3);
+
+        // incircle: círculo entero de radio 5 / círculo desplazado redondeado
+        registerPredicate<P2, 4>("incircle/random", random2, ic);
+        registerPredicate<P2, 4>("incircle/grid", [](uint32_t& s) { return pick(circleGrid(), s); }, ic);
+        registerPredicate<P2, 4>("incircle/near", [](uint32_t& s) {
+            const double t = uniform(s, 0.0, 6.283185307179586);
+            return P2(1234.5 + 3.0 * std::cos(t), -77.25 + 3.0 * std::sin(t));
+        }, ic);
+
+        // insphere: esfera entera de radio 3 / esfera desplazada redondeada
+        registerPredicate<P3, 5>("insphere/random", random3, is);
+        registerPredicate<P3, 5>("insphere/grid", [](uint32_t& s) { return pick(sphereGrid(), s); }, is);
+        registerPredicate<P3, 5>("insphere/near", [](uint32_t& s) {
+            const double z = uniform(s, -1.0, 1.0), t = uniform(s, 0.0, 6.283185307179586);
+            const double r = std::sqrt(1.0 - z * z);
+            return P3(10.5 + 2.0 * r * std::cos(t), -3.25 + 2.0 * r * std::sin(t), 0.125 + 2.0 * z);
+        }, is);
+    }
+
+    template <typename T>
+    void registerType(const std::string& type) {
+        registerDimension<T, 2>(type);
+        registerDimension<T, 3>(type);
+        registerDimension<T, 4>(type);
+        registerDimension<T, 8>(type);
+        registerDimension<T, 16>(type);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    benchmark::AddCustomContext("simd_backend", TinyGeo::simdBackendName());
+#if defined(TINYGEO_EXPRESSION_TEMPLATES)
+    benchmark::AddCustomContext("expression_templates", "on");
+#else
+    benchmark::AddCustomContext("expression_templates", "off");
+#endif
+
+    registerType<float>("float");
+    registerType<double>("double");
+    registerReductions<float>("float");
+    registerReductions<double>("double");
+    registerPredicates();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
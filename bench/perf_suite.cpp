@@ -0,0 +1,416 @@
+// Suite de regresión de rendimiento (sin dependencias externas).
+//
+//   tinygeo_perf [--quick] [--filter <substr>] [--out results.json]
+//                [--baseline base.json] [--threshold 0.10] [--time-threshold 0.25]
+//
+// Casos fijos (tamaños y semillas constantes): AoS frente a SoA, escalar
+// frente a SIMD (tinygeo_perf_scalar compila la misma suite con
+// TINYGEO_FORCE_SCALAR), batch en serie frente a paralelo, consultas del
+// k-d tree y carga por mmap. Por caso: ns, GFLOP/s, ciclos e instrucciones
+// por elemento, IPC y fallos de LLC (PerfCounters.h), mediana de varias
+// repeticiones.
+//
+// Con --baseline cada caso se compara con el mismo nombre del JSON de
+// referencia y el proceso sale con 1 si alguno empeora más del umbral:
+//   instructions_per_item  > base * (1 + threshold)       (determinista: detecta
+//                                                          p.ej. un dot que deja
+//                                                          de vectorizarse)
+//   ns_per_item            > base * (1 + time-threshold)  (ruidoso: umbral mayor,
+//                                                          mínimo de las repeticiones)
+// Un caso que supera el umbral se vuelve a medir kRetries veces antes de
+// darlo por regresión.
+// Las instrucciones solo se comparan en casos de un hilo (los contadores no
+// ven a los hilos del pool). Casos nuevos o ausentes en la referencia se
+// avisan pero no fallan. La referencia es propia de cada máquina y
+// compilación: se genera con --out en la máquina de CI (target perf_baseline,
+// ver bench/baselines/README.md). Sin archivo de referencia la comparación
+// se salta (SKIPPED, código 0); un archivo ilegible sí es un error (2).
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "PerfCounters.h"
+#include "TinyGeo/Batch.h"
+#include "TinyGeo/ParallelBatch.h"
+#include "TinyGeo/PointCloudIO.h"
+#include "TinyGeo/Simd.h"
+#include "TinyGeo/SpatialIndex.h"
+#include "TinyGeo/Statistics.h"
+#include "TinyGeo/Vector.h"
+#include "TinyGeo/VectorSoA.h"
+
+namespace {
+
+    using namespace TinyGeo;
+    using V3 = Vector<float, 3>;
+
+    // El optimizador no puede descartar lo escrito en *p
+    inline void clobber(const void* p) {
+#if defined(__GNUC__)
+        asm volatile("" : : "g"(p) : "memory");
+#else
+        static volatile const void* sink;
+        sink = p;
+#endif
+    }
+
+    uint32_t nextRandom(uint32_t& s) {
+        s = s * 1664525u + 1013904223u;
+        return s;
+    }
+
+    std::vector<V3> randomPoints(size_t n, uint32_t seed) {
+        std::vector<V3> v(n);
+        for (V3& p : v) {
+            for (size_t k = 0; k < 3; ++k) p.data[k] = float(nextRandom(seed) >> 8) / float(1u << 24) * 2.0f - 1.0f;
+        }
+        return v;
+    }
+
+    // --- 1. CASOS ---
+
+    struct Case {
+        std::string name;
+        size_t items = 0;         // Elementos por llamada a run()
+        double flopsPerItem = 0;  // 0 = no aplica (consultas, E/S)
+        bool singleThread = true; // Los contadores cubren todo el trabajo
+        std::function<void()> run;
+    };
+
+    struct Fixture {
+        static constexpr size_t kBatch = 1 << 16;   // Cabe en L2: mide cálculo, no memoria
+        static constexpr size_t kLarge = 1 << 21;   // Para el paralelo y mmap
+        static constexpr size_t kTreePoints = 1 << 17;
+        static constexpr size_t kQueries = 1 << 12;
+
+        std::vector<V3> a = randomPoints(kBatch, 1), b = randomPoints(kBatch, 2), out = std::vector<V3>(kBatch);
+        std::vector<float> dots = std::vector<float>(kBatch);
+        VectorSoA<float, 3> soaA, soaB, soaUnit; // soaUnit: normalizar en sitio es idempotente
+        std::vector<V3> large = randomPoints(kLarge, 3), largeOut = std::vector<V3>(kLarge);
+        std::vector<V3> queries = randomPoints(kQueries, 5);
+        KdTree<float, 3> tree{Span<const V3>(randomPoints(kTreePoints, 4))};
+        std::string cloudPath = (std::filesystem::temp_directory_path() / "tinygeo_perf.tgpc").string();
+        ThreadPool pool;
+
+        Fixture() {
+            for (size_t i = 0; i < kBatch; ++i) {
+                soaA.push_back(a[i]);
+                soaB.push_back(b[i]);
+            }
+            soaUnit = soaA;
+            io::writePointCloud(cloudPath, Span<const V3>(large));
+        }
+
+        ~Fixture() { std::remove(cloudPath.c_str()); }
+    };
+
+    std::vector<Case> makeCases(Fixture& f) {
+        std::vector<Case> cases;
+        // dot: 3 mul + 2 add
+        cases.push_back({"dot/aos/f32x3", Fixture::kBatch, 5, true, [&f] {
+                             batch::dot(Span<const V3>(f.a), Span<const V3>(f.b), Span<float>(f.dots));
+                             clobber(f.dots.data());
+                         }});
+        cases.push_back({"dot/soa/f32x3", Fixture::kBatch, 5, true, [&f] {
+                             f.soaA.dot(f.soaB, Span<float>(f.dots));
+                             clobber(f.dots.data());
+                         }});
+        // normalize: normSq (5) + sqrt/div (2) + 3 mul
+        cases.push_back({"normalize/aos/f32x3", Fixture::kBatch, 10, true, [&f] {
+                             batch::normalize(Span<const V3>(f.a), Span<V3>(f.out));
+                             clobber(f.out.data());
+                         }});
+        cases.push_back({"normalize/soa/f32x3", Fixture::kBatch, 10, true, [&f] {
+                             f.soaUnit.normalize();
+                             clobber(f.soaUnit.lane(0));
+                         }});
+        cases.push_back({"normalize/aos/f32x3/serial_large", Fixture::kLarge, 10, true, [&f] {
+                             batch::normalize(Span<const V3>(f.large), Span<V3>(f.largeOut));
+                             clobber(f.largeOut.data());
+                         }});
+        cases.push_back({"normalize/aos/f32x3/parallel_large", Fixture::kLarge, 10, false, [&f] {
+                             batch::normalize(execution::on(f.pool), Span<const V3>(f.large), Span<V3>(f.largeOut));
+                             clobber(f.largeOut.data());
+                         }});
+        // Bounds + centroide + covarianza en una pasada (min, max, 3 + 6 productos, sumas)
+        cases.push_back({"stats/all/f32x3", Fixture::kBatch, 24, true, [&f] {
+                             auto s = stats::reduce<stats::All>(Span<const V3>(f.a));
+                             clobber(&s);
+                         }});
+        cases.push_back({"kdtree/knn8/f32x3", Fixture::kQueries, 0, true, [&f] {
+                             Neighbor<float> nn[8];
+                             for (const V3& q : f.queries) {
+                                 f.tree.knn(q, Span<Neighbor<float>>(nn));
+                                 clobber(nn);
+                             }
+                         }});
+        cases.push_back({"kdtree/radius/f32x3", Fixture::kQueries, 0, true, [&f] {
+                             size_t found = 0;
+                             for (const V3& q : f.queries) f.tree.forEachInRadius(q, 0.05f, [&](uint32_t, float) { ++found; });
+                             clobber(&found);
+                         }});
+        // Abrir + mapear + recorrer todos los puntos (page cache caliente)
+        cases.push_back({"mmap/load/f32x3", Fixture::kLarge, 0, true, [&f] {
+                             io::MappedPointCloud cloud(f.cloudPath);
+                             cloud.advise(io::MappedPointCloud::Access::Sequential);
+                             auto s = stats::reduce<stats::Sum>(cloud.points<float, 3>());
+                             clobber(&s);
+                         }});
+        return cases;
+    }
+
+    // --- 2. MEDIDA ---
+
+    struct Result {
+        std::string name;
+        std::map<std::string, double> metrics;
+        bool singleThread = true;
+    };
+
+    constexpr int kRetries = 2;
+
+    double median(std::vector<double> v) {
+        std::sort(v.begin(), v.end());
+        return v.empty() ? 0.0 : v[v.size() / 2];
+    }
+
+    Result measure(const Case& c, perf::PerfCounters& counters, bool quick) {
+        using Clock = std::chrono::steady_clock;
+        const double minSeconds = quick ? 0.002 : 0.05;
+        const int reps = quick ? 3 : 9;
+
+        // Calentamiento y calibración: iteraciones para llegar a minSeconds
+        c.run();
+        size_t iters = 1;
+        for (;;) {
+            const auto t0 = Clock::now();
+            for (size_t i = 0; i < iters; ++i) c.run();
+            const double s = std::chrono::duration<double>(Clock::now() - t0).count();
+            if (s >= minSeconds || iters >= (size_t(1) << 20)) break;
+            iters = s <= 0.0 ? iters * 10 : std::max(iters + 1, size_t(double(iters) * minSeconds / s * 1.2));
+        }
+
+        std::vector<double> ns, cycles, instr, refs, misses;
+        for (int r = 0; r < reps; ++r) {
+            counters.start();
+            const auto t0 = Clock::now();
+            for (size_t i = 0; i < iters; ++i) c.run();
+            const double s = std::chrono::duration<double>(Clock::now() - t0).count();
+            const perf::CounterSample sample = counters.stop();
+            const double items = double(iters) * double(c.items);
+            ns.push_back(s * 1e9 / items);
+            if (sample.has(perf::Counter::Cycles)) cycles.push_back(sample.get(perf::Counter::Cycles) / items);
+            if (sample.has(perf::Counter::Instructions)) instr.push_back(sample.get(perf::Counter::Instructions) / items);
+            if (sample.has(perf::Counter::CacheReferences)) refs.push_back(sample.get(perf::Counter::CacheReferences) / items);
+            if (sample.has(perf::Counter::CacheMisses)) misses.push_back(sample.get(perf::Counter::CacheMisses) / items);
+        }
+
+        Result res;
+        res.name = c.name;
+        res.singleThread = c.singleThread;
+        // Tiempo: el mínimo (el ruido de otros procesos solo suma). Contadores: la mediana
+        res.metrics["ns_per_item"] = *std::min_element(ns.begin(), ns.end());
+        if (c.flopsPerItem > 0) res.metrics["gflops"] = c.flopsPerItem / res.metrics["ns_per_item"];
+        if (!cycles.empty()) res.metrics["cycles_per_item"] = median(cycles);
+        if (!instr.empty()) res.metrics["instructions_per_item"] = median(instr);
+        if (!cycles.empty() && !instr.empty()) res.metrics["ipc"] = median(instr) / median(cycles);
+        if (!refs.empty()) res.metrics["cache_refs_per_kitem"] = median(refs) * 1000.0;
+        if (!misses.empty()) res.metrics["cache_misses_per_kitem"] = median(misses) * 1000.0;
+        return res;
+    }
+
+    // --- 3. JSON ---
+
+    std::string toJson(const std::vector<Result>& results, const perf::PerfCounters& counters, size_t threads) {
+        std::ostringstream os;
+        os.precision(6);
+        os << "{\n  \"context\": {\"simd_backend\": \"" << simdBackendName() << "\", \"compiler\": \""
+#if defined(__VERSION__)
+           << __VERSION__
+#endif
+           << "\", \"pool_threads\": " << threads << ", \"counters\": " << (counters.available() ? "true" : "false")
+           << "},\n  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            os << "    {\"name\": \"" << results[i].name << "\"";
+            for (const auto& [key, value] : results[i].metrics) os << ", \"" << key << "\": " << value;
+            os << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        os << "  ]\n}\n";
+        return os.str();
+    }
+
+    // Lector mínimo para el formato que escribe toJson(): objetos planos
+    // {"name": "...", "metrica": numero, ...} dentro de "results"
+    std::map<std::string, std::map<std::string, double>> parseResults(const std::string& text) {
+        std::map<std::string, std::map<std::string, double>> out;
+        size_t pos = text.find("\"results\"");
+        while (pos != std::string::npos && (pos = text.find('{', pos)) != std::string::npos) {
+            const size_t end = text.find('}', pos);
+            if (end == std::string::npos) break;
+            const std::string obj = text.substr(pos + 1, end - pos - 1);
+            std::string name;
+            std::map<std::string, double> metrics;
+            size_t k = 0;
+            while ((k = obj.find('"', k)) != std::string::npos) {
+                const size_t keyEnd = obj.find('"', k + 1);
+                const size_t colon = obj.find(':', keyEnd);
+                if (keyEnd == std::string::npos || colon == std::string::npos) break;
+                const std::string key = obj.substr(k + 1, keyEnd - k - 1);
+                size_t v = obj.find_first_not_of(" \t\n", colon + 1);
+                if (v != std::string::npos && obj[v] == '"') {
+                    const size_t valueEnd = obj.find('"', v + 1);
+                    if (key == "name") name = obj.substr(v + 1, valueEnd - v - 1);
+                    k = valueEnd + 1;
+                } else {
+                    char* numEnd = nullptr;
+                    metrics[key] = std::strtod(obj.c_str() + v, &numEnd);
+                    k = size_t(numEnd - obj.c_str());
+                }
+            }
+            if (!name.empty()) out[name] = metrics;
+            pos = end + 1;
+        }
+        return out;
+    }
+
+    // --- 4. COMPARACIÓN ---
+
+    using Baseline = std::map<std::string, std::map<std::string, double>>;
+
+    Baseline loadBaseline(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) {
+            std::cerr << "cannot read baseline '" << path << "'" << std::endl;
+            std::exit(2);
+        }
+        std::stringstream ss;
+        ss << in.rdbuf();
+        return parseResults(ss.str());
+    }
+
+    // Mensajes de regresión de un caso (vacío si está dentro de los umbrales)
+    std::vector<std::string> regressions(const Result& r, const Baseline& baseline, double threshold,
+                                         double timeThreshold) {
+        std::vector<std::string> out;
+        const auto it = baseline.find(r.name);
+        if (it == baseline.end()) return out;
+        auto check = [&](const char* metric, double limit) {
+            const auto cur = r.metrics.find(metric);
+            const auto ref = it->second.find(metric);
+            if (cur == r.metrics.end() || ref == it->second.end() || ref->second <= 0.0) return;
+            const double change = cur->second / ref->second - 1.0;
+            if (change <= limit) return;
+            char line[256];
+            std::snprintf(line, sizeof(line), "REGRESSION %-36s %-22s %10.4g -> %10.4g (%+.1f%%, limit %+.1f%%)",
+                          r.name.c_str(), metric, ref->second, cur->second, change * 100.0, limit * 100.0);
+            out.emplace_back(line);
+        };
+        check("ns_per_item", timeThreshold);
+        if (r.singleThread) check("instructions_per_item", threshold);
+        return out;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool quick = false;
+    std::string filter, outPath, baselinePath;
+    double threshold = 0.10, timeThreshold = 0.25;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                std::cerr << arg << " needs a value" << std::endl;
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--quick") quick = true;
+        else if (arg == "--filter") filter = value();
+        else if (arg == "--out") outPath = value();
+        else if (arg == "--baseline") baselinePath = value();
+        else if (arg == "--threshold") threshold = std::atof(value().c_str());
+        else if (arg == "--time-threshold") timeThreshold = std::atof(value().c_str());
+        else {
+            std::cerr << "usage: " << argv[0]
+                      << " [--quick] [--filter s] [--out f.json] [--baseline f.json] [--threshold x]"
+                         " [--time-threshold x]"
+                      << std::endl;
+            return 2;
+        }
+    }
+
+    perf::PerfCounters counters;
+    if (!counters.available()) std::printf("hardware counters unavailable (%s): timing only\n", counters.error().c_str());
+
+    Fixture fixture;
+    const std::vector<Case> cases = makeCases(fixture);
+    std::vector<Result> results;
+    std::printf("%-36s %10s %8s %8s %10s %6s\n", "case", "ns/item", "GFLOP/s", "cyc/item", "instr/item", "IPC");
+    for (const Case& c : cases) {
+        if (!filter.empty() && c.name.find(filter) == std::string::npos) continue;
+        results.push_back(measure(c, counters, quick));
+        const auto& m = results.back().metrics;
+        auto get = [&](const char* k) { return m.count(k) ? m.at(k) : std::nan(""); };
+        std::printf("%-36s %10.3f %8.2f %8.2f %10.2f %6.2f\n", c.name.c_str(), get("ns_per_item"), get("gflops"),
+                    get("cycles_per_item"), get("instructions_per_item"), get("ipc"));
+    }
+
+    const std::string json = toJson(results, counters, fixture.pool.concurrency());
+    if (!outPath.empty()) {
+        std::ofstream out(outPath);
+        out << json;
+        if (!out) {
+            std::cerr << "cannot write '" << outPath << "'" << std::endl;
+            return 2;
+        }
+    }
+    if (!baselinePath.empty() && !std::filesystem::exists(baselinePath)) {
+        // Primera ejecución en una máquina: no es un fallo, pero que se vea
+        std::printf("SKIPPED comparison: no baseline at %s (create it with --out or the perf_baseline target)\n",
+                    baselinePath.c_str());
+        return 0;
+    }
+    if (!baselinePath.empty()) {
+        const Baseline baseline = loadBaseline(baselinePath);
+        bool ok = true;
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (!baseline.count(results[i].name)) {
+                std::printf("new case (not in baseline): %s\n", results[i].name.c_str());
+                continue;
+            }
+            // Un caso que empeora se vuelve a medir: solo falla si empeora siempre
+            std::vector<std::string> found = regressions(results[i], baseline, threshold, timeThreshold);
+            for (int retry = 0; retry < kRetries && !found.empty(); ++retry) {
+                const Case& c = *std::find_if(cases.begin(), cases.end(),
+                                              [&](const Case& k) { return k.name == results[i].name; });
+                found = regressions(measure(c, counters, quick), baseline, threshold, timeThreshold);
+            }
+            for (const std::string& line : found) std::printf("%s\n", line.c_str());
+            ok = ok && found.empty();
+        }
+        if (filter.empty()) {
+            for (const auto& entry : baseline) {
+                const bool ran = std::any_of(results.begin(), results.end(),
+                                             [&](const Result& r) { return r.name == entry.first; });
+                if (!ran) std::printf("baseline case not run: %s\n", entry.first.c_str());
+            }
+        }
+        if (!ok) return 1;
+        std::printf("no regressions against %s\n", baselinePath.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+
+    // Rayo origin + t * dir. Guarda 1 / dir (precalculado una vez) para el
+    // test de slabs; una componente nula da +-inf, que el test acepta. Si
+    // además el origen cae justo en el plano de una cara, (lo - o) * inf es
+    // 0 * inf = NaN: el test descarta ese eje (el rayo corre por la cara de
+    // la caja cerrada, así que el eje no restringe nada).
+    template <typename T, size_t N>
+    struct Ray {
+        Vector<T, N> origin;
+        Vector<T, N> dir;
+        Vector<T, N> invDir;
+
+        constexpr Ray(const Vector<T, N>& origin_, const Vector<T, N>& dir_) : origin(origin_), dir(dir_) {
+            for (size_t i = 0; i < N; ++i) {
+                invDir.data[i] = T(1) / dir.data[i];
+            }
+        }
+
+        constexpr Vector<T, N> at(T t) const {
+            Vector<T, N> p = dir * t;
+            p += origin;
+            return p;
+        }
+    };
+
+    // Caja alineada a los ejes [lo, hi] (cerrada). La caja vacía tiene
+    // lo = +max y hi = lowest, así que expand() funciona sin caso especial.
+    template <typename T, size_t N>
+    struct AABB {
+        using value_type = T;
+        static constexpr size_t static_size = N;
+
+        Vector<T, N> lo;
+        Vector<T, N> hi;
+
+        // --- 1. CONSTRUCTORES ---
+
+        // Caja vacía
+        constexpr AABB() {
+            for (size_t i = 0; i < N; ++i) {
+                lo.data[i] = std::numeric_limits<T>::max();
+                hi.data[i] = std::numeric_limits<T>::lowest();
+            }
+        }
+
+        constexpr AABB(const Vector<T, N>& lo_, const Vector<T, N>& hi_) : lo(lo_), hi(hi_) {}
+
+        // Caja degenerada que contiene solo un punto
+        constexpr explicit AABB(const Vector<T, N>& p) : lo(p), hi(p) {}
+
+        // --- 2. CONSTRUCCIÓN INCREMENTAL ---
+
+        constexpr void expand(const Vector<T, N>& p) {
+            lo = min(lo, p);
+            hi = max(hi, p);
+        }
+
+        constexpr void expand(const AABB& b) {
+            lo = min(lo, b.lo);
+            hi = max(hi, b.hi);
+        }
+
+        // --- 3. CONSULTAS ---
+
+        constexpr bool isEmpty() const {
+            for (size_t i = 0; i < N; ++i) {
+                if (lo.data[i] > hi.data[i]) return true;
+            }
+            return false;
+        }
+
+        constexpr Vector<T, N> center() const { return lerp(lo, hi, T(0.5)); }
+
+        constexpr Vector<T, N> extent() const {
+            Vector<T, N> e = hi;
+            e -= lo;
+            return e;
+        }
+
+        // Eje de mayor extensión (el de partición en KdTree / Bvh)
+        constexpr size_t longestAxis() const {
+            size_t axis = 0;
+            for (size_t i = 1; i < N; ++i) {
+                if (hi.data[i] - lo.data[i] > hi.data[axis] - lo.data[axis]) axis = i;
+            }
+            return axis;
+        }
+
+        constexpr bool contains(const Vector<T, N>& p) const {
+            bool inside = true;
+            for (size_t i = 0; i < N; ++i) {
+                inside &= (p.data[i] >= lo.data[i]) & (p.data[i] <= hi.data[i]);
+            }
+            return inside;
+        }
+
+        constexpr bool overlaps(const AABB& b) const {
+            bool hit = true;
+            for (size_t i = 0; i < N; ++i) {
+                hit &= (b.lo.data[i] <= hi.data[i]) & (b.hi.data[i] >= lo.data[i]);
+            }
+            return hit;
+        }
+
+        // Distancia al cuadrado de p a la caja (0 si p está dentro)
+        constexpr T distanceSq(const Vector<T, N>& p) const {
+            Vector<T, N> d = clamp(p, lo, hi);
+            d -= p;
+            return d.normSq();
+        }
+
+        // Intersección con otra caja (vacía si no solapan)
+        constexpr AABB intersection(const AABB& b) const { return AABB(max(lo, b.lo), min(hi, b.hi)); }
+
+        // Test de slabs: el rayo entra en la caja dentro de [tMin, tMax].
+        // Si hay impacto, tNear recibe el parámetro de entrada.
+        constexpr bool intersects(const Ray<T, N>& ray, T tMin, T tMax, T& tNear) const {
+            for (size_t i = 0; i < N; ++i) {
+                const T ta = (lo.data[i] - ray.origin.data[i]) * ray.invDir.data[i];
+                const T tb = (hi.data[i] - ray.origin.data[i]) * ray.invDir.data[i];
+                const bool ordered = (ta <= tb) | (tb <= ta); // Falso si hay NaN
+                const T t0 = ta < tb ? ta : tb;
+                const T t1 = ta < tb ? tb : ta;
+                tMin = ordered & (t0 > tMin) ? t0 : tMin;
+                tMax = ordered & (t1 < tMax) ? t1 : tMax;
+            }
+            tNear = tMin;
+            return tMin <= tMax;
+        }
+    };
+
+    using AABB2f = AABB<float, 2>;
+    using AABB3f = AABB<float, 3>;
+    using AABB3d = AABB<double, 3>;
+
+    // --- PAQUETES DE CAJAS ---
+    // K = 4 u 8 cajas en layout SoA (lo[eje][caja]): cada test recorre los
+    // K carriles de un eje a la vez, sin ramas, y el compilador lo emite con
+    // un registro SSE (4 float) o AVX (8 float / 4 double) por operación.
+    // El resultado es una máscara de bits: bit k = la caja k pasa el test.
+    template <typename T, size_t N, size_t K>
+    struct AABBPacket {
+        static_assert(K == 4 || K == 8, "AABBPacket holds 4 or 8 boxes");
+
+        alignas(sizeof(T) * K) T lo[N][K];
+        alignas(sizeof(T) * K) T hi[N][K];
+        uint32_t valid = 0; // Máscara de cajas cargadas
+
+        constexpr AABBPacket() : lo{}, hi{} {}
+
+        // Carga hasta K cajas (las que falten quedan fuera de 'valid')
+        explicit AABBPacket(Span<const AABB<T, N>> boxes) : lo{}, hi{} {
+            const size_t count = boxes.size() < K ? boxes.size() : K;
+            for (size_t k = 0; k < count; ++k) {
+                for (size_t i = 0; i < N; ++i) {
+                    lo[i][k] = boxes[k].lo.data[i];
+                    hi[i][k] = boxes[k].hi.data[i];
+                }
+            }
+            valid = (uint32_t(1) << count) - 1;
+        }
+
+        constexpr AABB<T, N> box(size_t k) const {
+            assert(k < K && "AABBPacket index out of bounds");
+            AABB<T, N> b;
+            for (size_t i = 0; i < N; ++i) {
+                b.lo.data[i] = lo[i][k];
+                b.hi.data[i] = hi[i][k];
+            }
+            return b;
+        }
+
+        // Slab test de un rayo contra las K cajas. tNear (opcional, K
+        // valores) recibe el parámetro de entrada de cada caja.
+        uint32_t intersect(const Ray<T, N>& ray, T tMin, T tMax, T* tNear = nullptr) const {
+            alignas(sizeof(T) * K) T t0[K];
+            alignas(sizeof(T) * K) T t1[K];
+            for (size_t k = 0; k < K; ++k) {
+                t0[k] = tMin;
+                t1[k] = tMax;
+            }
+            for (size_t i = 0; i < N; ++i) {
+                const T o = ray.origin.data[i];
+                const T inv = ray.invDir.data[i];
+                for (size_t k = 0; k < K; ++k) {
+                    const T ta = (lo[i][k] - o) * inv;
+                    const T tb = (hi[i][k] - o) * inv;
+                    const bool ordered = (ta <= tb) | (tb <= ta); // Ver Ray
+                    const T n = ta < tb ? ta : tb;
+                    const T f = ta < tb ? tb : ta;
+                    t0[k] = ordered & (n > t0[k]) ? n : t0[k];
+                    t1[k] = ordered & (f < t1[k]) ? f : t1[k];
+                }
+            }
+            if (tNear) {
+                for (size_t k = 0; k < K; ++k) tNear[k] = t0[k];
+            }
+            return mask([&](size_t k) { return t0[k] <= t1[k]; });
+        }
+
+        uint32_t overlaps(const AABB<T, N>& b) const {
+            bool hit[K];
+            for (size_t k = 0; k < K; ++k) hit[k] = true;
+            for (size_t i = 0; i < N; ++i) {
+                const T bl = b.lo.data[i];
+                const T bh = b.hi.data[i];
+                for (size_t k = 0; k < K; ++k) {
+                    hit[k] &= (bl <= hi[i][k]) & (bh >= lo[i][k]);
+                }
+            }
+            return mask([&](size_t k) { return hit[k]; });
+        }
+
+        uint32_t contains(const Vector<T, N>& p) const {
+            bool inside[K];
+            for (size_t k = 0; k < K; ++k) inside[k] = true;
+            for (size_t i = 0; i < N; ++i) {
+                const T c = p.data[i];
+                for (size_t k = 0; k < K; ++k) {
+                    inside[k] &= (c >= lo[i][k]) & (c <= hi[i][k]);
+                }
+            }
+            return mask([&](size_t k) { return inside[k]; });
+        }
+
+    private:
+        template <typename Pred>
+        uint32_t mask(Pred&& pred) const {
+            uint32_t m = 0;
+            for (size_t k = 0; k < K; ++k) {
+                m |= uint32_t(pred(k)) << k;
+            }
+            return m & valid;
+        }
+    };
+
+    using AABBPacket4f = AABBPacket<float, 3, 4>;
+    using AABBPacket8f = AABBPacket<float, 3, 8>;
+    using AABBPacket4d = AABBPacket<double, 3, 4>;
+
+    template <typename CharT, typename Traits, typename T, size_t N>
+    std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const AABB<T, N>& b) {
+        os << "[" << b.lo << " - " << b.hi << "]";
+        return os;
+    }
+
+} // namespace TinyGeo
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace TinyGeo {
+
+    // Alineación por defecto: una línea de caché (64 bytes).
+    // Cubre cualquier registro SIMD actual (SSE=16, AVX=32, AVX-512=64)
+    // y evita que dos buffers distintos compartan línea (false sharing).
+    inline constexpr size_t kCacheLine = 64;
+
+    // Allocator compatible con la STL que entrega memoria alineada a 'Align'.
+    // Usa el operator new alineado de C++17, así que no depende de la plataforma.
+    template <typename T, size_t Align = kCacheLine>
+    class AlignedAllocator {
+    public:
+        static_assert((Align & (Align - 1)) == 0, "Alignment must be a power of two");
+        static_assert(Align >= alignof(T), "Alignment must be at least alignof(T)");
+
+        using value_type = T;
+        using is_always_equal = std::true_type;
+
+        // Rebind explícito: el parámetro 'Align' no es un tipo y
+        // allocator_traits no sabría deducirlo por sí solo.
+        template <typename U>
+        struct rebind { using other = AlignedAllocator<U, Align>; };
+
+        static constexpr size_t alignment = Align;
+
+        AlignedAllocator() noexcept = default;
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept {}
+
+        T* allocate(size_t n) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+        }
+
+        void deallocate(T* p, size_t) noexcept {
+            ::operator delete(p, std::align_val_t(Align));
+        }
+    };
+
+    template <typename T, typename U, size_t A>
+    bool operator==(const AlignedAllocator<T, A>&, const AlignedAllocator<U, A>&) noexcept { return true; }
+
+    template <typename T, typename U, size_t A>
+    bool operator!=(const AlignedAllocator<T, A>&, const AlignedAllocator<U, A>&) noexcept { return false; }
+
+} // namespace TinyGeo
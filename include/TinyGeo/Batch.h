@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "TinyGeo/Instrument.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+
+    // Kernels por lotes sobre arrays de Vector<T, N, S>.
+    //
+    // En lugar de llamar v.dot(w) elemento a elemento (una suma horizontal
+    // por par), estos loops procesan bloques de elementos consecutivos
+    // componente a componente. Así el compilador vectoriza *entre*
+    // elementos y no dentro de cada uno, y el coste de llamada desaparece.
+    //
+    // Las entradas pueden ser Span<V> o Span<const V>; usa CTAD para pasar
+    // contenedores directamente:  batch::dot(Span(a), Span(b), Span(out));
+    // Las salidas pueden coincidir con una entrada (operación in-place),
+    // pero no solaparse parcialmente.
+    //
+    // Con TINYGEO_INSTRUMENT cada llamada registra su latencia (Instrument.h);
+    // las versiones paralelas registran una muestra por chunk.
+namespace batch {
+namespace detail {
+
+    // Elementos por iteración del loop principal; el resto (n % kUnroll)
+    // se procesa con el mismo cuerpo en un loop escalar al final.
+    inline constexpr size_t kUnroll = 8;
+
+    template <typename V>
+    using Traits = VectorTraits<std::remove_const_t<V>>;
+
+    template <typename V>
+    using Scalar = typename Traits<V>::scalar_type;
+
+    template <typename VA, typename VB>
+    constexpr void checkPair() {
+        static_assert(Traits<VA>::isVector, "batch kernels require spans of TinyGeo::Vector");
+        static_assert(std::is_same_v<std::remove_const_t<VA>, std::remove_const_t<VB>>,
+                      "batch kernels require matching Vector types");
+    }
+
+    // Producto punto sobre todos los carriles (el padding vale cero):
+    // un loop de trip-count fijo que el compilador desenrolla por completo.
+    template <typename V>
+    inline Scalar<V> dotLanes(const V& a, const V& b) {
+        Scalar<V> sum = Scalar<V>(0);
+        for (size_t k = 0; k < Traits<V>::lanes; ++k) {
+            sum += a.data[k] * b.data[k];
+        }
+        return sum;
+    }
+
+    // Aplica body(i) a i en [0, n): bloques de kUnroll + resto
+    template <typename Body>
+    inline void forEachUnrolled(size_t n, Body&& body) {
+        size_t i = 0;
+        for (; i + kUnroll <= n; i += kUnroll) {
+            for (size_t u = 0; u < kUnroll; ++u) {
+                body(i + u);
+            }
+        }
+        for (; i < n; ++i) {
+            body(i);
+        }
+    }
+
+} // namespace detail
+
+    // out[i] = a[i] . b[i]
+    template <typename VA, typename VB, typename T>
+    void dot(Span<VA> a, Span<VB> b, Span<T> out) {
+        TINYGEO_TIME_SCOPE(BatchDot);
+        detail::checkPair<VA, VB>();
+        static_assert(std::is_same_v<T, detail::Scalar<VA>>, "Output scalar type mismatch");
+        assert(a.size() == b.size() && out.size() == a.size() && "Batch size mismatch");
+        const VA* pa = a.data();
+        const VB* pb = b.data();
+        T* po = out.data();
+        detail::forEachUnrolled(a.size(), [=](size_t i) {
+            po[i] = detail::dotLanes(pa[i], pb[i]);
+        });
+    }
+
+    // out[i] = |a[i]|^2
+    template <typename VA, typename T>
+    void normSq(Span<VA> a, Span<T> out) {
+        dot(a, a, out);
+    }
+
+    // out[i] = a[i] x b[i]   (solo N=3)
+    template <typename VA, typename VB, typename VO>
+    void cross(Span<VA> a, Span<VB> b, Span<VO> out) {
+        TINYGEO_TIME_SCOPE(BatchCross);
+        detail::checkPair<VA, VB>();
+        detail::checkPair<VA, VO>();
+        static_assert(detail::Traits<VA>::size == 3, "Cross product is only defined for 3D vectors (N=3)");
+        assert(a.size() == b.size() && out.size() == a.size() && "Batch size mismatch");
+        using T = detail::Scalar<VA>;
+        const VA* pa = a.data();
+        const VB* pb = b.data();
+        VO* po = out.data();
+        detail::forEachUnrolled(a.size(), [=](size_t i) {
+            const auto& u = pa[i].data;
+            const auto& v = pb[i].data;
+            const T x = u[1] * v[2] - u[2] * v[1];
+            const T y = u[2] * v[0] - u[0] * v[2];
+            const T z = u[0] * v[1] - u[1] * v[0];
+            po[i].data[0] = x;
+            po[i].data[1] = y;
+            po[i].data[2] = z;
+        });
+    }
+
+    // out[i] = in[i].normalized()
+    // Misma semántica que Vector::normalized(): longitudes < 1e-8 dan el
+    // vector cero. La elección es una selección, no un salto, para que el
+    // bloque siga vectorizándose.
+    template <typename VI, typename VO>
+    void normalize(Span<VI> in, Span<VO> out) {
+        TINYGEO_TIME_SCOPE(BatchNormalize);
+        detail::checkPair<VI, VO>();
+        assert(in.size() == out.size() && "Batch size mismatch");
+        using T = detail::Scalar<VI>;
+        constexpr size_t L = detail::Traits<VI>::lanes;
+        const VI* pi = in.data();
+        VO* po = out.data();
+        detail::forEachUnrolled(in.size(), [=](size_t i) {
+            const T len = std::sqrt(detail::dotLanes(pi[i], pi[i]));
+            const T inv = len < T(1e-8) ? T(0) : T(1) / len;
+            for (size_t k = 0; k < L; ++k) {
+                po[i].data[k] = pi[i].data[k] * inv;
+            }
+        });
+    }
+
+    // In-place: v[i] = v[i].normalized()
+    template <typename V>
+    void normalize(Span<V> v) {
+        normalize(v, v);
+    }
+
+    // y[i] += alpha * x[i]   (BLAS axpy)
+    template <typename VX, typename VY>
+    void axpy(detail::Scalar<VX> alpha, Span<VX> x, Span<VY> y) {
+        TINYGEO_TIME_SCOPE(BatchAxpy);
+        detail::checkPair<VX, VY>();
+        assert(x.size() == y.size() && "Batch size mismatch");
+        constexpr size_t L = detail::Traits<VX>::lanes;
+        const VX* px = x.data();
+        VY* py = y.data();
+        detail::forEachUnrolled(x.size(), [=](size_t i) {
+            for (size_t k = 0; k < L; ++k) {
+                py[i].data[k] += alpha * px[i].data[k];
+            }
+        });
+    }
+
+    // out[i] = a[i] + b[i]
+    template <typename VA, typename VB, typename VO>
+    void add(Span<VA> a, Span<VB> b, Span<VO> out) {
+        TINYGEO_TIME_SCOPE(BatchAdd);
+        detail::checkPair<VA, VB>();
+        detail::checkPair<VA, VO>();
+        assert(a.size() == b.size() && out.size() == a.size() && "Batch size mismatch");
+        constexpr size_t L = detail::Traits<VA>::lanes;
+        const VA* pa = a.data();
+        const VB* pb = b.data();
+        VO* po = out.data();
+        detail::forEachUnrolled(a.size(), [=](size_t i) {
+            for (size_t k = 0; k < L; ++k) {
+                po[i].data[k] = pa[i].data[k] + pb[i].data[k];
+            }
+        });
+    }
+
+    // out[i] = a[i] - b[i]
+    template <typename VA, typename VB, typename VO>
+    void sub(Span<VA> a, Span<VB> b, Span<VO> out) {
+        TINYGEO_TIME_SCOPE(BatchSub);
+        detail::checkPair<VA, VB>();
+        detail::checkPair<VA, VO>();
+        assert(a.size() == b.size() && out.size() == a.size() && "Batch size mismatch");
+        constexpr size_t L = detail::Traits<VA>::lanes;
+        const VA* pa = a.data();
+        const VB* pb = b.data();
+        VO* po = out.data();
+        detail::forEachUnrolled(a.size(), [=](size_t i) {
+            for (size_t k = 0; k < L; ++k) {
+                po[i].data[k] = pa[i].data[k] - pb[i].data[k];
+            }
+        });
+    }
+
+    // v[i] *= s
+    template <typename V>
+    void scale(Span<V> v, detail::Scalar<V> s) {
+        TINYGEO_TIME_SCOPE(BatchScale);
+        static_assert(detail::Traits<V>::isVector, "batch kernels require spans of TinyGeo::Vector");
+        constexpr size_t L = detail::Traits<V>::lanes;
+        V* pv = v.data();
+        detail::forEachUnrolled(v.size(), [=](size_t i) {
+            for (size_t k = 0; k < L; ++k) {
+                pv[i].data[k] *= s;
+            }
+        });
+    }
+
+} // namespace batch
+} // namespace TinyGeo
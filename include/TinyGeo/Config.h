@@ -0,0 +1,47 @@
+#pragma once
+
+// Macros de configuración compartidas por todos los headers de TinyGeo.
+
+// --- TINYGEO_IS_CONSTANT_EVALUATED() ---
+// true si la expresión se está evaluando en tiempo de compilación.
+// Permite que una función constexpr use un loop escalar en constexpr y
+// los intrínsecos SIMD en runtime. En C++17 no existe
+// std::is_constant_evaluated, pero GCC >= 9, Clang >= 9 y MSVC >= 19.25
+// exponen el mismo builtin. Sin él se asume runtime: el código sigue siendo
+// correcto, pero los tamaños con backend SIMD no podrán usarse en constexpr.
+#if defined(__cpp_lib_is_constant_evaluated)
+    #include <type_traits>
+    #define TINYGEO_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+    #define TINYGEO_HAS_CONSTANT_EVALUATED 1
+#elif defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+        #define TINYGEO_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+        #define TINYGEO_HAS_CONSTANT_EVALUATED 1
+    #endif
+#endif
+
+#if !defined(TINYGEO_IS_CONSTANT_EVALUATED)
+    #if defined(__GNUC__) && __GNUC__ >= 9
+        #define TINYGEO_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+        #define TINYGEO_HAS_CONSTANT_EVALUATED 1
+    #elif defined(_MSC_VER) && _MSC_VER >= 1925
+        #define TINYGEO_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+        #define TINYGEO_HAS_CONSTANT_EVALUATED 1
+    #else
+        #define TINYGEO_IS_CONSTANT_EVALUATED() false
+        #define TINYGEO_HAS_CONSTANT_EVALUATED 0
+    #endif
+#endif
+
+// --- TINYGEO_HOST_DEVICE ---
+// Marca funciones llamables desde host y desde kernels CUDA (ver Gpu.h).
+// Fuera de nvcc se expande a nada. Las funciones constexpr de Vector /
+// Matrix no lo necesitan: con --expt-relaxed-constexpr (que añade la opción
+// CMake TINYGEO_CUDA) nvcc ya las acepta en código de dispositivo.
+// En la pasada de dispositivo (__CUDA_ARCH__) Simd.h elige los kernels
+// escalares y los macros de Instrument.h no generan código.
+#if defined(__CUDACC__)
+    #define TINYGEO_HOST_DEVICE __host__ __device__
+#else
+    #define TINYGEO_HOST_DEVICE
+#endif
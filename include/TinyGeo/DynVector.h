@@ -0,0 +1,196 @@
+#pragma once
+
+// Vector de dimensión en tiempo de ejecución para N grande (embeddings de
+// 128-1024 dimensiones...). Vector<float, 512> vive en la pila y genera un
+// kernel por tamaño; DynVector<float> guarda sus componentes en el heap,
+// alineadas a una línea de caché, y comparte un único kernel para todo n.
+//
+// Misma API que Vector (aritmética, dot, norm, normalized...). Las
+// operaciones entre dos DynVector exigen el mismo size() (assert).
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <iosfwd>
+#include <vector>
+
+#include "TinyGeo/AlignedAllocator.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+#include "TinyGeo/detail/Kernels.h"
+
+namespace TinyGeo {
+
+    template <typename T, typename Alloc = AlignedAllocator<T>>
+    class DynVector {
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+
+        // --- 1. CONSTRUCTORES ---
+
+        DynVector() = default;
+
+        // n componentes a cero
+        explicit DynVector(size_t n, const Alloc& alloc = Alloc()) : data_(n, T(0), alloc) {}
+
+        DynVector(std::initializer_list<T> list, const Alloc& alloc = Alloc()) : data_(list, alloc) {}
+
+        explicit DynVector(Span<const T> values, const Alloc& alloc = Alloc())
+            : data_(values.begin(), values.end(), alloc) {}
+
+        // Desde un Vector de tamaño fijo (sin los carriles de padding)
+        template <size_t N, typename S>
+        explicit DynVector(const Vector<T, N, S>& v, const Alloc& alloc = Alloc())
+            : data_(v.data.begin(), v.data.begin() + N, alloc) {}
+
+        // --- 2. ARITMÉTICA: ASIGNACIÓN COMPUESTA ---
+        // Loops sin dependencias entre iteraciones: se vectorizan para todo n.
+
+        DynVector& operator+=(const DynVector& other) {
+            checkSize(other);
+            T* a = data();
+            const T* b = other.data();
+            const size_t n = size();
+            for (size_t i = 0; i < n; ++i) {
+                a[i] += b[i];
+            }
+            return *this;
+        }
+
+        DynVector& operator-=(const DynVector& other) {
+            checkSize(other);
+            T* a = data();
+            const T* b = other.data();
+            const size_t n = size();
+            for (size_t i = 0; i < n; ++i) {
+                a[i] -= b[i];
+            }
+            return *this;
+        }
+
+        DynVector& operator*=(T scalar) {
+            T* a = data();
+            const size_t n = size();
+            for (size_t i = 0; i < n; ++i) {
+                a[i] *= scalar;
+            }
+            return *this;
+        }
+
+        DynVector& operator/=(T scalar) {
+            assert(scalar != 0 && "Division by zero");
+            return *this *= T(1) / scalar;
+        }
+
+        // --- 3. ACCESORES ---
+
+        T& operator[](size_t index) {
+            assert(index < size() && "Index out of bounds");
+            return data_[index];
+        }
+
+        const T& operator[](size_t index) const {
+            assert(index < size() && "Index out of bounds");
+            return data_[index];
+        }
+
+        T* data() { return data_.data(); }
+        const T* data() const { return data_.data(); }
+
+        T* begin() { return data_.data(); }
+        T* end() { return data_.data() + data_.size(); }
+        const T* begin() const { return data_.data(); }
+        const T* end() const { return data_.data() + data_.size(); }
+
+        size_t size() const { return data_.size(); }
+        bool empty() const { return data_.empty(); }
+
+        // Nuevas componentes a cero
+        void resize(size_t n) { data_.resize(n, T(0)); }
+
+        // --- 4. GEOMETRÍA ---
+
+        // Varios acumuladores independientes (detail::dotBlocked): sin la
+        // cadena serie de sumas del loop con un solo acumulador.
+        T dot(const DynVector& other) const {
+            checkSize(other);
+            return detail::dotBlocked(data(), other.data(), size());
+        }
+
+        T normSq() const { return dot(*this); }
+
+        T norm() const { return std::sqrt(normSq()); }
+
+        // Misma regla que Vector::normalized(): longitud < 1e-8 da el vector cero
+        DynVector normalized() const {
+            const T len = norm();
+            if (len < T(1e-8)) {
+                return DynVector(size(), data_.get_allocator());
+            }
+            return *this / len;
+        }
+
+        void normalize() { *this = normalized(); }
+
+    private:
+        void checkSize(const DynVector& other) const {
+            assert(size() == other.size() && "DynVector size mismatch");
+            (void)other;
+        }
+
+        std::vector<T, Alloc> data_;
+    };
+
+    // --- 5. OPERADORES BINARIOS ---
+    // Igual que en Vector: 'lhs' por valor reutiliza su buffer cuando es un
+    // temporal (a + b + c reserva una sola vez).
+
+    template <typename T, typename A>
+    DynVector<T, A> operator+(DynVector<T, A> lhs, const DynVector<T, A>& rhs) {
+        lhs += rhs;
+        return lhs;
+    }
+
+    template <typename T, typename A>
+    DynVector<T, A> operator-(DynVector<T, A> lhs, const DynVector<T, A>& rhs) {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    template <typename T, typename A>
+    DynVector<T, A> operator*(DynVector<T, A> lhs, T scalar) {
+        lhs *= scalar;
+        return lhs;
+    }
+
+    template <typename T, typename A>
+    DynVector<T, A> operator*(T scalar, DynVector<T, A> rhs) {
+        rhs *= scalar;
+        return rhs;
+    }
+
+    template <typename T, typename A>
+    DynVector<T, A> operator/(DynVector<T, A> lhs, T scalar) {
+        lhs /= scalar;
+        return lhs;
+    }
+
+    template <typename T, typename A>
+    T dot(const DynVector<T, A>& a, const DynVector<T, A>& b) {
+        return a.dot(b);
+    }
+
+    template <typename CharT, typename Traits, typename T, typename A>
+    std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const DynVector<T, A>& v) {
+        os << "[";
+        for (size_t i = 0; i < v.size(); ++i) {
+            os << v[i];
+            if (i + 1 < v.size()) os << ", ";
+        }
+        os << "]";
+        return os;
+    }
+
+} // namespace TinyGeo
@@ -0,0 +1,159 @@
+#pragma once
+
+// Expression templates para aritmética encadenada de Vector.
+//
+// Solo se activan con TINYGEO_EXPRESSION_TEMPLATES (opción CMake del mismo
+// nombre). En ese modo los operadores binarios +, -, * y / no calculan nada:
+// devuelven un nodo ligero que describe la operación. El árbol completo se
+// evalúa en UN solo loop al asignarlo a un Vector:
+//
+//   Vector<float, 8> r = a + b * s - c / t; // 1 pasada, 0 temporales
+//
+// Cuidado: los nodos guardan referencias a los Vector hoja. No guardes una
+// expresión con 'auto' más allá de la vida de sus operandos; usa eval() o
+// asígnala a un Vector.
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace TinyGeo {
+
+    template <typename T, size_t N, typename Storage>
+    class Vector;
+
+namespace expr {
+
+    // Base CRTP común a todos los nodos.
+    // Cada nodo expone: value_type, size, result_type y operator[](i).
+    template <typename E>
+    struct VecExpr {
+        constexpr const E& self() const { return static_cast<const E&>(*this); }
+
+        // Fuerza la evaluación (útil para pasar el resultado a dot/cross).
+        // Es template porque E aún es incompleto cuando se instancia la base.
+        template <typename Self = E>
+        constexpr typename Self::result_type eval() const { return typename Self::result_type(self()); }
+    };
+
+    // Hoja: referencia a un Vector existente (no copia)
+    template <typename V>
+    struct Leaf : VecExpr<Leaf<V>> {
+        using value_type = typename V::value_type;
+        using result_type = V;
+        static constexpr size_t size = V::static_size;
+
+        const V& v;
+
+        constexpr explicit Leaf(const V& vec) : v(vec) {}
+        constexpr value_type operator[](size_t i) const { return v.data[i]; }
+    };
+
+    // --- Operaciones elementales ---
+    struct Add { template <typename T> static constexpr T apply(T a, T b) { return a + b; } };
+    struct Sub { template <typename T> static constexpr T apply(T a, T b) { return a - b; } };
+
+    // Nodo binario vector-vector
+    template <typename L, typename R, typename Op>
+    struct Binary : VecExpr<Binary<L, R, Op>> {
+        using value_type = typename L::value_type;
+        using result_type = typename L::result_type;
+        static constexpr size_t size = L::size;
+
+        L lhs;
+        R rhs;
+
+        constexpr Binary(const L& l, const R& r) : lhs(l), rhs(r) {}
+        constexpr value_type operator[](size_t i) const { return Op::apply(lhs[i], rhs[i]); }
+    };
+
+    // Nodo vector-escalar. La división se guarda como multiplicación por el
+    // inverso, igual que Vector::operator/= (1 división, N multiplicaciones).
+    template <typename E>
+    struct Scale : VecExpr<Scale<E>> {
+        using value_type = typename E::value_type;
+        using result_type = typename E::result_type;
+        static constexpr size_t size = E::size;
+
+        E operand;
+        value_type factor;
+
+        constexpr Scale(const E& e, value_type f) : operand(e), factor(f) {}
+        constexpr value_type operator[](size_t i) const { return operand[i] * factor; }
+    };
+
+    // --- Traits: qué tipos pueden participar en una expresión ---
+
+    template <typename X>
+    struct IsVector : std::false_type {};
+
+    template <typename T, size_t N, typename S>
+    struct IsVector<Vector<T, N, S>> : std::true_type {};
+
+    template <typename X>
+    inline constexpr bool isOperand =
+        IsVector<X>::value || std::is_base_of_v<VecExpr<X>, X>;
+
+    // Los Vector entran como Leaf (por referencia); los nodos, por valor.
+    template <typename X>
+    using Operand = std::conditional_t<IsVector<X>::value, Leaf<X>, X>;
+
+    template <typename X>
+    constexpr Operand<X> wrap(const X& x) {
+        if constexpr (IsVector<X>::value) {
+            return Leaf<X>(x);
+        } else {
+            return x;
+        }
+    }
+
+    // Dos operandos son compatibles si producen el mismo tipo de Vector.
+    // Especialización parcial (y no un '&&') para que result_type solo se
+    // consulte en operandos válidos: así 'std::string + "..."' sigue
+    // descartando estos operadores por SFINAE.
+    template <typename L, typename R, bool = isOperand<L> && isOperand<R>>
+    struct Compatible : std::false_type {};
+
+    template <typename L, typename R>
+    struct Compatible<L, R, true>
+        : std::is_same<typename Operand<L>::result_type, typename Operand<R>::result_type> {};
+
+    template <typename L, typename R>
+    inline constexpr bool compatible = Compatible<L, R>::value;
+
+    template <typename X>
+    using ScalarOf = typename Operand<X>::value_type;
+
+} // namespace expr
+
+    // --- OPERADORES (modo expression templates) ---
+    // Viven en TinyGeo para que ADL los encuentre tanto con Vector como con nodos.
+
+    template <typename L, typename R, typename = std::enable_if_t<expr::compatible<L, R>>>
+    constexpr expr::Binary<expr::Operand<L>, expr::Operand<R>, expr::Add> operator+(const L& lhs, const R& rhs) {
+        return {expr::wrap(lhs), expr::wrap(rhs)};
+    }
+
+    template <typename L, typename R, typename = std::enable_if_t<expr::compatible<L, R>>>
+    constexpr expr::Binary<expr::Operand<L>, expr::Operand<R>, expr::Sub> operator-(const L& lhs, const R& rhs) {
+        return {expr::wrap(lhs), expr::wrap(rhs)};
+    }
+
+    template <typename E, typename = std::enable_if_t<expr::isOperand<E>>>
+    constexpr expr::Scale<expr::Operand<E>> operator*(const E& lhs, expr::ScalarOf<E> scalar) {
+        return {expr::wrap(lhs), scalar};
+    }
+
+    template <typename E, typename = std::enable_if_t<expr::isOperand<E>>>
+    constexpr expr::Scale<expr::Operand<E>> operator*(expr::ScalarOf<E> scalar, const E& rhs) {
+        return {expr::wrap(rhs), scalar};
+    }
+
+    template <typename E, typename = std::enable_if_t<expr::isOperand<E>>>
+    constexpr expr::Scale<expr::Operand<E>> operator/(const E& lhs, expr::ScalarOf<E> scalar) {
+        assert(scalar != 0 && "Division by zero");
+        using T = expr::ScalarOf<E>;
+        return {expr::wrap(lhs), T(1) / scalar};
+    }
+
+} // namespace TinyGeo
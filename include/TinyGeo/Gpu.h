@@ -0,0 +1,413 @@
+#pragma once
+
+// Backend CUDA de los kernels por lotes (opción CMake TINYGEO_CUDA).
+//
+// Misma semántica que batch::dot / cross / normalize y transform /
+// transformPoints de Matrix.h, pero sobre buffers que viven en la GPU:
+//
+//   gpu::Stream stream;
+//   gpu::DeviceBuffer<Vector<float, 3>> d(points.size());
+//   d.upload(Span<const Vector<float, 3>>(points), stream); // asíncrono
+//   gpu::transformPoints(model, d.view(), d.view(), stream);
+//   d.download(Span<Vector<float, 3>>(points), stream);
+//   stream.synchronize();
+//
+// Todas las funciones encolan trabajo en el stream y vuelven enseguida.
+// Los errores de CUDA se lanzan como std::runtime_error (igual que la E/S).
+//
+// Para datos que no caben (o no merece la pena dejar) en la GPU,
+// gpu::streamed() trocea la entrada y solapa copia H->D, kernel y copia
+// D->H de chunks consecutivos en varios streams. El solape solo es real
+// con memoria host page-locked: usa gpu::PinnedAllocator en los vectores.
+//
+// Solo compila con nvcc; los builds sin TINYGEO_CUDA no incluyen este header.
+//
+// EXPERIMENTAL: el job cuda-build de CI compila este header y test_gpu.cu
+// con nvcc (contenedor nvidia/cuda), pero test_gpu aún no se ha ejecutado
+// en una GPU. Por eso TINYGEO_CUDA está OFF por defecto.
+
+#if !defined(__CUDACC__)
+    #error "TinyGeo/Gpu.h requires nvcc (enable the TINYGEO_CUDA CMake option)"
+#endif
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "TinyGeo/Config.h"
+#include "TinyGeo/Matrix.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+namespace gpu {
+
+    // --- 1. RECURSOS ---
+
+    inline void check(cudaError_t err, const char* what) {
+        if (err != cudaSuccess) {
+            throw std::runtime_error(std::string("TinyGeo CUDA: ") + what + ": " + cudaGetErrorString(err));
+        }
+    }
+
+    // Número de GPUs visibles (0 si no hay driver o dispositivo)
+    inline int deviceCount() {
+        int count = 0;
+        if (cudaGetDeviceCount(&count) != cudaSuccess) {
+            cudaGetLastError(); // Limpia el error pegajoso
+            return 0;
+        }
+        return count;
+    }
+
+    class Stream {
+    public:
+        Stream() { check(cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking), "cudaStreamCreate"); }
+        ~Stream() { cudaStreamDestroy(stream_); }
+
+        Stream(const Stream&) = delete;
+        Stream& operator=(const Stream&) = delete;
+
+        cudaStream_t native() const { return stream_; }
+
+        void synchronize() const { check(cudaStreamSynchronize(stream_), "cudaStreamSynchronize"); }
+
+    private:
+        cudaStream_t stream_ = nullptr;
+    };
+
+    // Vista (puntero de dispositivo, tamaño). Distinta de Span para que el
+    // tipo impida pasar memoria host a un kernel y viceversa.
+    template <typename T>
+    class DeviceSpan {
+    public:
+        DeviceSpan() = default;
+        TINYGEO_HOST_DEVICE DeviceSpan(T* ptr, size_t count) : ptr_(ptr), size_(count) {}
+
+        // DeviceSpan<T> -> DeviceSpan<const T>
+        template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+        TINYGEO_HOST_DEVICE DeviceSpan(const DeviceSpan<U>& other) : ptr_(other.data()), size_(other.size()) {}
+
+        TINYGEO_HOST_DEVICE T* data() const { return ptr_; }
+        TINYGEO_HOST_DEVICE size_t size() const { return size_; }
+
+        DeviceSpan subspan(size_t offset, size_t count) const {
+            assert(offset + count <= size_ && "Subspan out of bounds");
+            return DeviceSpan(ptr_ + offset, count);
+        }
+
+    private:
+        T* ptr_ = nullptr;
+        size_t size_ = 0;
+    };
+
+    // Buffer de dispositivo con propiedad (cudaMalloc / cudaFree). Solo movible.
+    template <typename T>
+    class DeviceBuffer {
+    public:
+        static_assert(std::is_trivially_copyable_v<T>, "DeviceBuffer elements are copied with cudaMemcpy");
+
+        DeviceBuffer() = default;
+
+        explicit DeviceBuffer(size_t n) : size_(n) {
+            if (n > 0) check(cudaMalloc(reinterpret_cast<void**>(&ptr_), n * sizeof(T)), "cudaMalloc");
+        }
+
+        ~DeviceBuffer() {
+            if (ptr_) cudaFree(ptr_);
+        }
+
+        DeviceBuffer(DeviceBuffer&& other) noexcept : ptr_(other.ptr_), size_(other.size_) {
+            other.ptr_ = nullptr;
+            other.size_ = 0;
+        }
+
+        DeviceBuffer& operator=(DeviceBuffer&& other) noexcept {
+            if (this != &other) {
+                if (ptr_) cudaFree(ptr_);
+                ptr_ = other.ptr_;
+                size_ = other.size_;
+                other.ptr_ = nullptr;
+                other.size_ = 0;
+            }
+            return *this;
+        }
+
+        DeviceBuffer(const DeviceBuffer&) = delete;
+        DeviceBuffer& operator=(const DeviceBuffer&) = delete;
+
+        T* data() { return ptr_; }
+        const T* data() const { return ptr_; }
+        size_t size() const { return size_; }
+
+        DeviceSpan<T> view() { return DeviceSpan<T>(ptr_, size_); }
+        DeviceSpan<const T> view() const { return DeviceSpan<const T>(ptr_, size_); }
+
+        // Copias asíncronas de los primeros host.size() elementos
+        void upload(Span<const T> host, const Stream& stream) {
+            assert(host.size() <= size_ && "Upload larger than device buffer");
+            check(cudaMemcpyAsync(ptr_, host.data(), host.size() * sizeof(T), cudaMemcpyHostToDevice, stream.native()),
+                  "cudaMemcpyAsync (host to device)");
+        }
+
+        void download(Span<T> host, const Stream& stream) const {
+            assert(host.size() <= size_ && "Download larger than device buffer");
+            check(cudaMemcpyAsync(host.data(), ptr_, host.size() * sizeof(T), cudaMemcpyDeviceToHost, stream.native()),
+                  "cudaMemcpyAsync (device to host)");
+        }
+
+    private:
+        T* ptr_ = nullptr;
+        size_t size_ = 0;
+    };
+
+    // Allocator STL de memoria host page-locked (cudaMallocHost): requisito
+    // para que las copias asíncronas se solapen con los kernels.
+    template <typename T>
+    class PinnedAllocator {
+    public:
+        using value_type = T;
+        using is_always_equal = std::true_type;
+
+        PinnedAllocator() noexcept = default;
+
+        template <typename U>
+        PinnedAllocator(const PinnedAllocator<U>&) noexcept {}
+
+        T* allocate(size_t n) {
+            void* p = nullptr;
+            check(cudaMallocHost(&p, n * sizeof(T)), "cudaMallocHost");
+            return static_cast<T*>(p);
+        }
+
+        void deallocate(T* p, size_t) noexcept { cudaFreeHost(p); }
+    };
+
+    template <typename T, typename U>
+    bool operator==(const PinnedAllocator<T>&, const PinnedAllocator<U>&) noexcept { return true; }
+
+    template <typename T, typename U>
+    bool operator!=(const PinnedAllocator<T>&, const PinnedAllocator<U>&) noexcept { return false; }
+
+namespace detail {
+
+    // --- 2. KERNELS ---
+    // Grid-stride loops: un hilo por elemento y como mucho kMaxBlocks bloques.
+
+    inline constexpr unsigned kBlockSize = 256;
+    inline constexpr size_t kMaxBlocks = 65535;
+
+    inline unsigned blocksFor(size_t n) {
+        return unsigned(std::min(kMaxBlocks, (n + kBlockSize - 1) / kBlockSize));
+    }
+
+    template <typename V>
+    using Scalar = typename VectorTraits<std::remove_const_t<V>>::scalar_type;
+
+    template <typename V>
+    inline constexpr size_t kLanes = VectorTraits<std::remove_const_t<V>>::lanes;
+
+    template <typename VA, typename VB>
+    constexpr void checkPair() {
+        static_assert(VectorTraits<std::remove_const_t<VA>>::isVector, "GPU kernels require spans of TinyGeo::Vector");
+        static_assert(std::is_same_v<std::remove_const_t<VA>, std::remove_const_t<VB>>,
+                      "GPU kernels require matching Vector types");
+    }
+
+    template <typename V>
+    __device__ Scalar<V> dotLanes(const V& a, const V& b) {
+        Scalar<V> sum = Scalar<V>(0);
+        for (size_t k = 0; k < kLanes<V>; ++k) {
+            sum += a.data[k] * b.data[k];
+        }
+        return sum;
+    }
+
+    // Carriles de padding a cero, como los kernels de CPU: dot / length y las
+    // cargas SIMD de Reduction.h suman todos los carriles
+    template <typename V>
+    __device__ void zeroPadding(V& v, size_t from) {
+        for (size_t k = from; k < kLanes<V>; ++k) {
+            v.data[k] = Scalar<V>(0);
+        }
+    }
+
+    template <typename V, typename T>
+    __global__ void dotKernel(const V* a, const V* b, T* out, size_t n) {
+        for (size_t i = blockIdx.x * size_t(blockDim.x) + threadIdx.x; i < n; i += size_t(gridDim.x) * blockDim.x) {
+            out[i] = dotLanes(a[i], b[i]);
+        }
+    }
+
+    template <typename V>
+    __global__ void crossKernel(const V* a, const V* b, V* out, size_t n) {
+        for (size_t i = blockIdx.x * size_t(blockDim.x) + threadIdx.x; i < n; i += size_t(gridDim.x) * blockDim.x) {
+            const auto& u = a[i].data;
+            const auto& v = b[i].data;
+            const Scalar<V> x = u[1] * v[2] - u[2] * v[1];
+            const Scalar<V> y = u[2] * v[0] - u[0] * v[2];
+            const Scalar<V> z = u[0] * v[1] - u[1] * v[0];
+            out[i].data[0] = x;
+            out[i].data[1] = y;
+            out[i].data[2] = z;
+            zeroPadding(out[i], 3);
+        }
+    }
+
+    template <typename V>
+    __global__ void normalizeKernel(const V* in, V* out, size_t n) {
+        using T = Scalar<V>;
+        for (size_t i = blockIdx.x * size_t(blockDim.x) + threadIdx.x; i < n; i += size_t(gridDim.x) * blockDim.x) {
+            const T len = sqrt(dotLanes(in[i], in[i]));
+            const T inv = len < T(1e-8) ? T(0) : T(1) / len;
+            for (size_t k = 0; k < kLanes<V>; ++k) {
+                out[i].data[k] = in[i].data[k] * inv;
+            }
+        }
+    }
+
+    // La matriz viaja por valor en los parámetros del kernel (memoria constante)
+    template <typename T, size_t R, size_t C>
+    __global__ void transformKernel(Matrix<T, R, C> m, const Vector<T, C>* in, Vector<T, R>* out, size_t n) {
+        for (size_t i = blockIdx.x * size_t(blockDim.x) + threadIdx.x; i < n; i += size_t(gridDim.x) * blockDim.x) {
+            const Vector<T, C> v = in[i]; // Copia local: in-place con R == C
+            for (size_t r = 0; r < R; ++r) {
+                T sum = T(0);
+                for (size_t c = 0; c < C; ++c) {
+                    sum += m.rows[r].data[c] * v.data[c];
+                }
+                out[i].data[r] = sum;
+            }
+            zeroPadding(out[i], R);
+        }
+    }
+
+    template <typename T>
+    __global__ void transformPointsKernel(Matrix<T, 4, 4> m, const Vector<T, 3>* in, Vector<T, 3>* out, size_t n) {
+        for (size_t i = blockIdx.x * size_t(blockDim.x) + threadIdx.x; i < n; i += size_t(gridDim.x) * blockDim.x) {
+            const T x = in[i].data[0], y = in[i].data[1], z = in[i].data[2];
+            for (size_t r = 0; r < 3; ++r) {
+                const auto& row = m.rows[r].data;
+                out[i].data[r] = row[0] * x + row[1] * y + row[2] * z + row[3];
+            }
+            zeroPadding(out[i], 3);
+        }
+    }
+
+    template <typename Kernel, typename... Args>
+    void launch(Kernel kernel, size_t n, const Stream& stream, Args... args) {
+        if (n == 0) return;
+        kernel<<<blocksFor(n), kBlockSize, 0, stream.native()>>>(args..., n);
+        check(cudaGetLastError(), "kernel launch");
+    }
+
+} // namespace detail
+
+    // --- 3. KERNELS POR LOTES (ASÍNCRONOS) ---
+    // Como en Batch.h, las entradas pueden ser DeviceSpan<V> o
+    // DeviceSpan<const V> y la salida puede coincidir con una entrada.
+
+    // out[i] = a[i] . b[i]
+    template <typename VA, typename VB, typename T>
+    void dot(DeviceSpan<VA> a, DeviceSpan<VB> b, DeviceSpan<T> out, const Stream& stream) {
+        using V = std::remove_const_t<VA>;
+        detail::checkPair<VA, VB>();
+        static_assert(std::is_same_v<T, detail::Scalar<V>>, "Output scalar type mismatch");
+        assert(a.size() == b.size() && out.size() == a.size() && "Batch size mismatch");
+        detail::launch(detail::dotKernel<V, T>, a.size(), stream, static_cast<const V*>(a.data()),
+                       static_cast<const V*>(b.data()), out.data());
+    }
+
+    // out[i] = a[i] x b[i]   (solo N=3)
+    template <typename VA, typename VB, typename VO>
+    void cross(DeviceSpan<VA> a, DeviceSpan<VB> b, DeviceSpan<VO> out, const Stream& stream) {
+        using V = std::remove_const_t<VA>;
+        detail::checkPair<VA, VB>();
+        detail::checkPair<VA, VO>();
+        static_assert(VectorTraits<V>::size == 3, "Cross product is only defined for 3D vectors (N=3)");
+        assert(a.size() == b.size() && out.size() == a.size() && "Batch size mismatch");
+        detail::launch(detail::crossKernel<V>, a.size(), stream, static_cast<const V*>(a.data()),
+                       static_cast<const V*>(b.data()), out.data());
+    }
+
+    // out[i] = in[i].normalized()  (longitud < 1e-8 da el vector cero)
+    template <typename VI, typename VO>
+    void normalize(DeviceSpan<VI> in, DeviceSpan<VO> out, const Stream& stream) {
+        using V = std::remove_const_t<VI>;
+        detail::checkPair<VI, VO>();
+        assert(in.size() == out.size() && "Batch size mismatch");
+        detail::launch(detail::normalizeKernel<V>, in.size(), stream, static_cast<const V*>(in.data()), out.data());
+    }
+
+    // out[i] = M * in[i]
+    template <typename T, size_t R, size_t C, typename VI>
+    void transform(const Matrix<T, R, C>& m, DeviceSpan<VI> in, DeviceSpan<Vector<T, R>> out, const Stream& stream) {
+        static_assert(std::is_same_v<std::remove_const_t<VI>, Vector<T, C>>, "Input must be Vector<T, C>");
+        assert(in.size() == out.size() && "Batch size mismatch");
+        detail::launch(detail::transformKernel<T, R, C>, in.size(), stream, m,
+                       static_cast<const Vector<T, C>*>(in.data()), out.data());
+    }
+
+    // out[i] = transformPoint(M, in[i])
+    template <typename T, typename VI>
+    void transformPoints(const Matrix<T, 4, 4>& m, DeviceSpan<VI> in, DeviceSpan<Vector<T, 3>> out,
+                         const Stream& stream) {
+        static_assert(std::is_same_v<std::remove_const_t<VI>, Vector<T, 3>>, "Input must be Vector<T, 3>");
+        assert(in.size() == out.size() && "Batch size mismatch");
+        detail::launch(detail::transformPointsKernel<T>, in.size(), stream, m,
+                       static_cast<const Vector<T, 3>*>(in.data()), out.data());
+    }
+
+    // --- 4. STREAMING HOST <-> DISPOSITIVO ---
+
+    struct StreamOptions {
+        size_t chunk = size_t(1) << 20; // Elementos por chunk
+        size_t streams = 3;             // Chunks en vuelo (copia in / kernel / copia out)
+    };
+
+    // out[i] = f(in[i]) para arrays host: cada chunk sube, se procesa y baja
+    // en su stream, mientras los demás streams copian el chunk anterior y el
+    // siguiente. enqueue(DeviceSpan<const VI>, DeviceSpan<VO>, const Stream&)
+    // lanza el kernel, p. ej.:
+    //
+    //   gpu::streamed(Span<const Vector<float, 3>>(in), Span<Vector<float, 3>>(out),
+    //                 [&](auto i, auto o, const gpu::Stream& s) { gpu::transformPoints(m, i, o, s); });
+    //
+    // Bloquea hasta que el último chunk ha vuelto al host.
+    template <typename VI, typename VO, typename Enqueue>
+    void streamed(Span<const VI> in, Span<VO> out, Enqueue&& enqueue, StreamOptions options = {}) {
+        assert(in.size() == out.size() && "Batch size mismatch");
+        assert(options.chunk > 0 && options.streams > 0 && "Invalid stream options");
+        const size_t n = in.size();
+        if (n == 0) return;
+
+        const size_t lanes = std::min(options.streams, (n + options.chunk - 1) / options.chunk);
+        const size_t chunk = std::min(options.chunk, n);
+        std::vector<Stream> streams(lanes);
+        std::vector<DeviceBuffer<VI>> dIn;
+        std::vector<DeviceBuffer<VO>> dOut;
+        for (size_t s = 0; s < lanes; ++s) {
+            dIn.emplace_back(chunk);
+            dOut.emplace_back(chunk);
+        }
+
+        // Los buffers de un stream se reutilizan cada 'lanes' chunks: el orden
+        // dentro del stream garantiza que la copia anterior ya terminó.
+        for (size_t begin = 0, c = 0; begin < n; begin += chunk, ++c) {
+            const size_t count = std::min(chunk, n - begin);
+            const size_t s = c % lanes;
+            dIn[s].upload(in.subspan(begin, count), streams[s]);
+            enqueue(DeviceSpan<const VI>(dIn[s].data(), count), DeviceSpan<VO>(dOut[s].data(), count), streams[s]);
+            dOut[s].download(out.subspan(begin, count), streams[s]);
+        }
+        for (const Stream& s : streams) s.synchronize();
+    }
+
+} // namespace gpu
+} // namespace TinyGeo
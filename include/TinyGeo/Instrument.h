@@ -0,0 +1,308 @@
+#pragma once
+
+// Instrumentación opcional de los caminos calientes.
+//
+// Con TINYGEO_INSTRUMENT (opción CMake del mismo nombre, OFF por defecto):
+//   TINYGEO_COUNT(c)          contador de llamadas (instrument::Counter::c)
+//   TINYGEO_COUNT_IF(cond, c) contador de un resultado de rama
+//   TINYGEO_TIME_SCOPE(t)     histograma de latencia del ámbito (Timer::t)
+// Sin la opción los tres macros son ((void)0): ni código ni estado. Tampoco
+// generan código en kernels CUDA (__CUDA_ARCH__), aunque la opción esté activa.
+//
+// Cada hilo escribe en su propio ThreadBuffer (sin locks ni RMW atómicos:
+// un único escritor hace load + store relaxed). El mutex del registro solo
+// se toma al registrar / retirar un hilo y en snapshot() / reset(). Los
+// datos de hilos ya terminados se conservan.
+//
+//   instrument::writePrometheus(std::cout, instrument::snapshot());
+//
+// En constexpr los contadores no se evalúan (ver TINYGEO_IS_CONSTANT_EVALUATED).
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "TinyGeo/Config.h"
+
+#if defined(TINYGEO_INSTRUMENT)
+    #include <algorithm>
+    #include <atomic>
+    #include <chrono>
+    #include <mutex>
+    #include <vector>
+#endif
+
+namespace TinyGeo {
+namespace instrument {
+
+    // --- 1. PUNTOS DE MEDIDA ---
+
+    enum class Counter : uint32_t {
+        VectorDivAssign,          // Vector::operator/=
+        VectorNormalized,         // Vector::normalized() / normalize()
+        VectorNormalizedZero,     // ... que devolvieron el vector cero
+        VectorFastNormalized,     // Vector::fastNormalized()
+        VectorFastNormalizedZero, // ... que devolvieron el vector cero
+        PredicateExact,           // Predicados que no pasaron el filtro (camino exacto)
+        PredicateExactFull,       // ... que tampoco resolvió la etapa B (exacto completo)
+        Count
+    };
+
+    enum class Timer : uint32_t {
+        BatchDot, // Incluye batch::normSq
+        BatchCross,
+        BatchNormalize,
+        BatchAxpy,
+        BatchAdd,
+        BatchSub,
+        BatchScale,
+        Count
+    };
+
+    inline constexpr size_t kCounters = size_t(Counter::Count);
+    inline constexpr size_t kTimers = size_t(Timer::Count);
+
+    inline const char* name(Counter c) {
+        static const char* const names[kCounters] = {
+            "vector_div_assign", "vector_normalized", "vector_normalized_zero",
+            "vector_fast_normalized", "vector_fast_normalized_zero", "predicate_exact",
+            "predicate_exact_full",
+        };
+        return names[size_t(c)];
+    }
+
+    inline const char* name(Timer t) {
+        static const char* const names[kTimers] = {
+            "batch_dot", "batch_cross", "batch_normalize", "batch_axpy", "batch_add", "batch_sub", "batch_scale",
+        };
+        return names[size_t(t)];
+    }
+
+    // Buckets logarítmicos: el b-ésimo cubre hasta kFirstBucketNs * 2^b ns
+    // (64 ns ... ~0.5 s); el último (+Inf) recoge el resto.
+    inline constexpr size_t kHistogramBuckets = 24;
+    inline constexpr uint64_t kFirstBucketNs = 64;
+
+    constexpr uint64_t bucketUpperNs(size_t b) { return kFirstBucketNs << b; }
+
+    constexpr size_t bucketFor(uint64_t ns) {
+        size_t b = 0;
+        while (b < kHistogramBuckets && ns > bucketUpperNs(b)) ++b;
+        return b;
+    }
+
+    // --- 2. SNAPSHOT ---
+
+    struct Histogram {
+        std::array<uint64_t, kHistogramBuckets + 1> buckets{}; // No acumulados
+        uint64_t count = 0;
+        uint64_t sumNs = 0;
+    };
+
+    struct Snapshot {
+        bool enabled = false; // false: compilado sin TINYGEO_INSTRUMENT
+        std::array<uint64_t, kCounters> counters{};
+        std::array<Histogram, kTimers> timers{};
+
+        uint64_t counter(Counter c) const { return counters[size_t(c)]; }
+        const Histogram& timer(Timer t) const { return timers[size_t(t)]; }
+    };
+
+#if defined(TINYGEO_INSTRUMENT)
+namespace detail {
+
+    struct ThreadBuffer {
+        std::atomic<uint64_t> counters[kCounters] = {};
+        struct {
+            std::atomic<uint64_t> buckets[kHistogramBuckets + 1] = {};
+            std::atomic<uint64_t> count{0};
+            std::atomic<uint64_t> sumNs{0};
+        } timers[kTimers];
+    };
+
+    // Solo el hilo dueño escribe: basta con load + store (sin lock prefix)
+    inline void bump(std::atomic<uint64_t>& a, uint64_t v) {
+        a.store(a.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+    }
+
+    inline void accumulate(Snapshot& s, const ThreadBuffer& b) {
+        for (size_t c = 0; c < kCounters; ++c) {
+            s.counters[c] += b.counters[c].load(std::memory_order_relaxed);
+        }
+        for (size_t t = 0; t < kTimers; ++t) {
+            Histogram& h = s.timers[t];
+            for (size_t k = 0; k <= kHistogramBuckets; ++k) {
+                h.buckets[k] += b.timers[t].buckets[k].load(std::memory_order_relaxed);
+            }
+            h.count += b.timers[t].count.load(std::memory_order_relaxed);
+            h.sumNs += b.timers[t].sumNs.load(std::memory_order_relaxed);
+        }
+    }
+
+    class Registry {
+    public:
+        static Registry& get() {
+            static Registry registry;
+            return registry;
+        }
+
+        void attach(ThreadBuffer* b) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            live_.push_back(b);
+        }
+
+        // Fin de un hilo: sus totales pasan a 'retired_'
+        void detach(ThreadBuffer* b) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            accumulate(retired_, *b);
+            live_.erase(std::find(live_.begin(), live_.end(), b));
+        }
+
+        Snapshot snapshot() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            Snapshot s = totals();
+            for (size_t c = 0; c < kCounters; ++c) s.counters[c] -= baseline_.counters[c];
+            for (size_t t = 0; t < kTimers; ++t) {
+                for (size_t k = 0; k <= kHistogramBuckets; ++k) {
+                    s.timers[t].buckets[k] -= baseline_.timers[t].buckets[k];
+                }
+                s.timers[t].count -= baseline_.timers[t].count;
+                s.timers[t].sumNs -= baseline_.timers[t].sumNs;
+            }
+            s.enabled = true;
+            return s;
+        }
+
+        // Los buffers de otros hilos no se tocan (tienen un único escritor):
+        // reset() fija una línea base que snapshot() descuenta.
+        void reset() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            baseline_ = totals();
+        }
+
+    private:
+        Snapshot totals() const {
+            Snapshot s = retired_;
+            for (const ThreadBuffer* b : live_) accumulate(s, *b);
+            return s;
+        }
+
+        std::mutex mutex_;
+        std::vector<ThreadBuffer*> live_;
+        Snapshot retired_;
+        Snapshot baseline_;
+    };
+
+    // El registro se construye antes que el primer buffer de hilo, así que
+    // sobrevive a todos ellos (también al del hilo principal).
+    struct ThreadHandle {
+        ThreadBuffer buffer;
+        ThreadHandle() { Registry::get().attach(&buffer); }
+        ~ThreadHandle() { Registry::get().detach(&buffer); }
+    };
+
+    inline ThreadBuffer& localBuffer() {
+        thread_local ThreadHandle handle;
+        return handle.buffer;
+    }
+
+    inline void count(Counter c) { bump(localBuffer().counters[size_t(c)], 1); }
+
+    inline void record(Timer t, uint64_t ns) {
+        auto& h = localBuffer().timers[size_t(t)];
+        bump(h.buckets[bucketFor(ns)], 1);
+        bump(h.count, 1);
+        bump(h.sumNs, ns);
+    }
+
+} // namespace detail
+
+    // Mide el ámbito en el que vive (steady_clock)
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(Timer t) : timer_(t), start_(std::chrono::steady_clock::now()) {}
+
+        ~ScopedTimer() {
+            const auto elapsed = std::chrono::steady_clock::now() - start_;
+            detail::record(timer_, uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        Timer timer_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    inline Snapshot snapshot() { return detail::Registry::get().snapshot(); }
+
+    inline void reset() { detail::Registry::get().reset(); }
+
+#else
+
+    inline Snapshot snapshot() { return {}; }
+
+    inline void reset() {}
+
+#endif // TINYGEO_INSTRUMENT
+
+    // --- 3. EXPORTACIÓN ---
+
+    // Formato de texto de Prometheus: <prefix>_ops_total{op=...} (counter) y
+    // <prefix>_kernel_duration_seconds{kernel=...} (histogram, buckets acumulados).
+    inline std::ostream& writePrometheus(std::ostream& os, const Snapshot& s, const std::string& prefix = "tinygeo") {
+        const std::string ops = prefix + "_ops_total";
+        os << "# HELP " << ops << " TinyGeo operation and branch counters.\n";
+        os << "# TYPE " << ops << " counter\n";
+        for (size_t c = 0; c < kCounters; ++c) {
+            os << ops << "{op=\"" << name(Counter(c)) << "\"} " << s.counters[c] << "\n";
+        }
+
+        const std::string hist = prefix + "_kernel_duration_seconds";
+        os << "# HELP " << hist << " TinyGeo batch kernel latency.\n";
+        os << "# TYPE " << hist << " histogram\n";
+        for (size_t t = 0; t < kTimers; ++t) {
+            const Histogram& h = s.timers[t];
+            const char* kernel = name(Timer(t));
+            uint64_t cumulative = 0;
+            for (size_t b = 0; b < kHistogramBuckets; ++b) {
+                cumulative += h.buckets[b];
+                os << hist << "_bucket{kernel=\"" << kernel << "\",le=\"" << double(bucketUpperNs(b)) * 1e-9 << "\"} "
+                   << cumulative << "\n";
+            }
+            os << hist << "_bucket{kernel=\"" << kernel << "\",le=\"+Inf\"} " << h.count << "\n";
+            os << hist << "_sum{kernel=\"" << kernel << "\"} " << double(h.sumNs) * 1e-9 << "\n";
+            os << hist << "_count{kernel=\"" << kernel << "\"} " << h.count << "\n";
+        }
+        return os;
+    }
+
+} // namespace instrument
+} // namespace TinyGeo
+
+// --- 4. MACROS ---
+#define TINYGEO_INSTRUMENT_CONCAT_(a, b) a##b
+#define TINYGEO_INSTRUMENT_CONCAT(a, b) TINYGEO_INSTRUMENT_CONCAT_(a, b)
+
+#if defined(TINYGEO_INSTRUMENT) && !defined(__CUDA_ARCH__)
+    #define TINYGEO_COUNT(counter)                                                               \
+        do {                                                                                     \
+            if (!TINYGEO_IS_CONSTANT_EVALUATED())                                                \
+                ::TinyGeo::instrument::detail::count(::TinyGeo::instrument::Counter::counter);  \
+        } while (0)
+    #define TINYGEO_COUNT_IF(cond, counter)                                                      \
+        do {                                                                                     \
+            if (!TINYGEO_IS_CONSTANT_EVALUATED() && (cond))                                      \
+                ::TinyGeo::instrument::detail::count(::TinyGeo::instrument::Counter::counter);  \
+        } while (0)
+    #define TINYGEO_TIME_SCOPE(timer)                                                            \
+        ::TinyGeo::instrument::ScopedTimer TINYGEO_INSTRUMENT_CONCAT(tinygeoTimer_, __LINE__)(  \
+            ::TinyGeo::instrument::Timer::timer)
+#else
+    #define TINYGEO_COUNT(counter) ((void)0)
+    #define TINYGEO_COUNT_IF(cond, counter) ((void)0)
+    #define TINYGEO_TIME_SCOPE(timer) ((void)0)
+#endif
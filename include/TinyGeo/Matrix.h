@@ -0,0 +1,341 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iosfwd>
+#include <utility>
+
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+
+namespace detail {
+
+    template <size_t, typename Row>
+    using MatrixRowArg = Row;
+
+    // Almacenamiento de Matrix. El constructor por filas tiene exactamente R
+    // parámetros Row (uno por índice), así que una cuenta de filas distinta
+    // no compila, y cada fila admite su propia lista entre llaves.
+    template <typename Row, size_t R, typename = std::make_index_sequence<R>>
+    struct MatrixRows;
+
+    template <typename Row, size_t R, size_t... I>
+    struct MatrixRows<Row, R, std::index_sequence<I...>> {
+        std::array<Row, R> rows;
+
+        constexpr MatrixRows() : rows{} {}
+        constexpr MatrixRows(const MatrixRowArg<I, Row>&... r) : rows{{r...}} {}
+    };
+
+} // namespace detail
+
+    // T: Tipo de dato (float, double)
+    // R: Filas, C: Columnas
+    //
+    // Almacenamiento fila-mayor: cada fila es un Vector<T, C>, así que
+    // M * v es una serie de dot() fila a fila y los kernels de Vector se
+    // reutilizan tal cual. En memoria son R * C escalares contiguos.
+    template <typename T, size_t R, size_t C>
+    class Matrix : public detail::MatrixRows<Vector<T, C>, R> {
+        using Storage = detail::MatrixRows<Vector<T, C>, R>;
+
+    public:
+        using value_type = T;
+        using Row = Vector<T, C>;
+        using Column = Vector<T, R>;
+
+        static constexpr size_t rowCount = R;
+        static constexpr size_t colCount = C;
+
+        // --- 1. ALMACENAMIENTO ---
+        // std::array<Row, R> rows (en detail::MatrixRows)
+        using Storage::rows;
+
+        // --- 2. CONSTRUCTORES ---
+
+        // Matriz cero
+        constexpr Matrix() : Storage() {}
+
+        // Por filas, exactamente R: Matrix3f m = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+        using Storage::Storage;
+
+        static constexpr Matrix identity() {
+            static_assert(R == C, "Identity is only defined for square matrices");
+            Matrix m;
+            for (size_t i = 0; i < R; ++i) {
+                m.rows[i][i] = T(1);
+            }
+            return m;
+        }
+
+        // --- 3. ACCESO ---
+
+        constexpr Row& operator[](size_t r) {
+            assert(r < R && "Row index out of bounds");
+            return rows[r];
+        }
+
+        constexpr const Row& operator[](size_t r) const {
+            assert(r < R && "Row index out of bounds");
+            return rows[r];
+        }
+
+        constexpr T& operator()(size_t r, size_t c) { return (*this)[r][c]; }
+        constexpr const T& operator()(size_t r, size_t c) const { return (*this)[r][c]; }
+
+        constexpr Column column(size_t c) const {
+            Column col;
+            for (size_t r = 0; r < R; ++r) {
+                col[r] = rows[r][c];
+            }
+            return col;
+        }
+
+        constexpr Matrix<T, C, R> transposed() const {
+            Matrix<T, C, R> t;
+            for (size_t r = 0; r < R; ++r) {
+                for (size_t c = 0; c < C; ++c) {
+                    t.rows[c][r] = rows[r][c];
+                }
+            }
+            return t;
+        }
+
+        // --- 4. ARITMÉTICA: ASIGNACIÓN COMPUESTA ---
+
+        constexpr Matrix& operator+=(const Matrix& other) {
+            for (size_t r = 0; r < R; ++r) rows[r] += other.rows[r];
+            return *this;
+        }
+
+        constexpr Matrix& operator-=(const Matrix& other) {
+            for (size_t r = 0; r < R; ++r) rows[r] -= other.rows[r];
+            return *this;
+        }
+
+        constexpr Matrix& operator*=(T scalar) {
+            for (size_t r = 0; r < R; ++r) rows[r] *= scalar;
+            return *this;
+        }
+    };
+
+    // Alias comunes
+    using Matrix3f = Matrix<float, 3, 3>;
+    using Matrix4f = Matrix<float, 4, 4>;
+    using Matrix3d = Matrix<double, 3, 3>;
+    using Matrix4d = Matrix<double, 4, 4>;
+
+namespace detail {
+
+    // Hasta 4x4 los productos se desenrollan por completo con un fold sobre
+    // index_sequence: no dependemos de lo que decida el optimizador.
+    inline constexpr size_t kMatrixUnrollMax = 4;
+
+    template <typename T, size_t C, size_t... K>
+    constexpr T dotUnrolled(const T* row, const T* v, std::index_sequence<K...>) {
+        return ((row[K] * v[K]) + ...);
+    }
+
+    // out = M * v, con M como array plano fila-mayor (R x C)
+    template <typename T, size_t R, size_t C, size_t... I>
+    constexpr void mulUnrolled(const T* m, const T* v, T* out, std::index_sequence<I...>) {
+        ((out[I] = dotUnrolled<T, C>(m + I * C, v, std::make_index_sequence<C>{})), ...);
+    }
+
+    template <typename T, size_t R, size_t C>
+    constexpr void mulMatVec(const T* m, const T* v, T* out) {
+        if constexpr (R <= kMatrixUnrollMax && C <= kMatrixUnrollMax) {
+            mulUnrolled<T, R, C>(m, v, out, std::make_index_sequence<R>{});
+        } else {
+            for (size_t r = 0; r < R; ++r) {
+                T sum = T(0);
+                for (size_t c = 0; c < C; ++c) {
+                    sum += m[r * C + c] * v[c];
+                }
+                out[r] = sum;
+            }
+        }
+    }
+
+    // Copia la matriz a un array plano local: en los loops de transform el
+    // compilador lo mantiene en registros (9 o 16 valores) mientras los
+    // puntos pasan en streaming.
+    template <typename T, size_t R, size_t C>
+    constexpr std::array<T, R * C> flatten(const Matrix<T, R, C>& m) {
+        std::array<T, R * C> flat{};
+        for (size_t r = 0; r < R; ++r) {
+            for (size_t c = 0; c < C; ++c) {
+                flat[r * C + c] = m.rows[r][c];
+            }
+        }
+        return flat;
+    }
+
+    // Tamaño de bloque (en elementos) del producto matriz-matriz grande:
+    // tres bloques de 32x32 floats (12 KiB) caben en L1.
+    inline constexpr size_t kMatrixBlock = 32;
+
+} // namespace detail
+
+    // --- 5. OPERADORES BINARIOS ---
+
+    template <typename T, size_t R, size_t C>
+    constexpr Matrix<T, R, C> operator+(Matrix<T, R, C> lhs, const Matrix<T, R, C>& rhs) {
+        lhs += rhs;
+        return lhs;
+    }
+
+    template <typename T, size_t R, size_t C>
+    constexpr Matrix<T, R, C> operator-(Matrix<T, R, C> lhs, const Matrix<T, R, C>& rhs) {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    template <typename T, size_t R, size_t C>
+    constexpr Matrix<T, R, C> operator*(Matrix<T, R, C> lhs, T scalar) {
+        lhs *= scalar;
+        return lhs;
+    }
+
+    template <typename T, size_t R, size_t C>
+    constexpr Matrix<T, R, C> operator*(T scalar, Matrix<T, R, C> rhs) {
+        rhs *= scalar;
+        return rhs;
+    }
+
+    // Matriz * Vector: (R x C) * C -> R
+    template <typename T, size_t R, size_t C>
+    constexpr Vector<T, R> operator*(const Matrix<T, R, C>& m, const Vector<T, C>& v) {
+        Vector<T, R> out;
+        const auto flat = detail::flatten(m);
+        detail::mulMatVec<T, R, C>(flat.data(), v.data.data(), out.data.data());
+        return out;
+    }
+
+    // Matriz * Matriz: (R x C) * (C x K) -> (R x K)
+    // Pequeñas: desenrollado total. Grandes: por bloques (i, k, j) para que
+    // las filas de 'b' y de la salida se reutilicen mientras están en caché.
+    template <typename T, size_t R, size_t C, size_t K>
+    constexpr Matrix<T, R, K> operator*(const Matrix<T, R, C>& a, const Matrix<T, C, K>& b) {
+        Matrix<T, R, K> out;
+        if constexpr (R <= detail::kMatrixUnrollMax && C <= detail::kMatrixUnrollMax &&
+                      K <= detail::kMatrixUnrollMax) {
+            for (size_t k = 0; k < K; ++k) {
+                const Vector<T, C> col = b.column(k);
+                for (size_t r = 0; r < R; ++r) {
+                    out.rows[r][k] = a.rows[r].dot(col);
+                }
+            }
+        } else {
+            constexpr size_t B = detail::kMatrixBlock;
+            for (size_t ii = 0; ii < R; ii += B) {
+                for (size_t kk = 0; kk < C; kk += B) {
+                    for (size_t jj = 0; jj < K; jj += B) {
+                        const size_t iEnd = std::min(ii + B, R);
+                        const size_t kEnd = std::min(kk + B, C);
+                        const size_t jEnd = std::min(jj + B, K);
+                        for (size_t i = ii; i < iEnd; ++i) {
+                            for (size_t k = kk; k < kEnd; ++k) {
+                                const T aik = a.rows[i][k];
+                                for (size_t j = jj; j < jEnd; ++j) {
+                                    out.rows[i][j] += aik * b.rows[k][j];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return out;
+    }
+
+    // --- 6. TRANSFORMACIÓN POR LOTES ---
+    // La matriz se carga una sola vez; los puntos pasan en streaming.
+
+    // out[i] = M * in[i]
+    template <typename T, size_t R, size_t C, typename VI, typename VO>
+    void transform(const Matrix<T, R, C>& m, Span<VI> in, Span<VO> out) {
+        static_assert(std::is_same_v<std::remove_const_t<VI>, Vector<T, C>>, "Input must be Vector<T, C>");
+        static_assert(std::is_same_v<VO, Vector<T, R>>, "Output must be Vector<T, R>");
+        assert(in.size() == out.size() && "Batch size mismatch");
+        const auto flat = detail::flatten(m);
+        const VI* pi = in.data();
+        VO* po = out.data();
+        const size_t n = in.size();
+        for (size_t i = 0; i < n; ++i) {
+            // Copia local: permite transformar in-place (in == out) con R == C
+            const Vector<T, C> v = pi[i];
+            detail::mulMatVec<T, R, C>(flat.data(), v.data.data(), po[i].data.data());
+        }
+    }
+
+    // In-place: v[i] = M * v[i]  (solo matrices cuadradas)
+    template <typename T, size_t N>
+    void transform(const Matrix<T, N, N>& m, Span<Vector<T, N>> v) {
+        transform(m, v, v);
+    }
+
+    // Punto 3D con una 4x4 afín: M * (p, 1). Se asume última fila (0, 0, 0, 1),
+    // así que no hay división perspectiva.
+    template <typename T>
+    constexpr Vector<T, 3> transformPoint(const Matrix<T, 4, 4>& m, const Vector<T, 3>& p) {
+        Vector<T, 3> out;
+        for (size_t r = 0; r < 3; ++r) {
+            out[r] = m.rows[r][0] * p[0] + m.rows[r][1] * p[1] + m.rows[r][2] * p[2] + m.rows[r][3];
+        }
+        return out;
+    }
+
+    // Dirección 3D con una 4x4: M * (d, 0). Ignora la traslación.
+    template <typename T>
+    constexpr Vector<T, 3> transformDirection(const Matrix<T, 4, 4>& m, const Vector<T, 3>& d) {
+        Vector<T, 3> out;
+        for (size_t r = 0; r < 3; ++r) {
+            out[r] = m.rows[r][0] * d[0] + m.rows[r][1] * d[1] + m.rows[r][2] * d[2];
+        }
+        return out;
+    }
+
+    // Vertex buffers: out[i] = transformPoint(M, in[i]).
+    // Los 12 coeficientes útiles se sacan a variables locales una vez; el
+    // loop interno no vuelve a leer la matriz de memoria.
+    template <typename T, typename VI>
+    void transformPoints(const Matrix<T, 4, 4>& m, Span<VI> in, Span<Vector<T, 3>> out) {
+        static_assert(std::is_same_v<std::remove_const_t<VI>, Vector<T, 3>>, "Input must be Vector<T, 3>");
+        assert(in.size() == out.size() && "Batch size mismatch");
+        const T m00 = m.rows[0][0], m01 = m.rows[0][1], m02 = m.rows[0][2], m03 = m.rows[0][3];
+        const T m10 = m.rows[1][0], m11 = m.rows[1][1], m12 = m.rows[1][2], m13 = m.rows[1][3];
+        const T m20 = m.rows[2][0], m21 = m.rows[2][1], m22 = m.rows[2][2], m23 = m.rows[2][3];
+        const VI* pi = in.data();
+        Vector<T, 3>* po = out.data();
+        const size_t n = in.size();
+        for (size_t i = 0; i < n; ++i) {
+            const T x = pi[i].data[0], y = pi[i].data[1], z = pi[i].data[2];
+            po[i].data[0] = m00 * x + m01 * y + m02 * z + m03;
+            po[i].data[1] = m10 * x + m11 * y + m12 * z + m13;
+            po[i].data[2] = m20 * x + m21 * y + m22 * z + m23;
+        }
+    }
+
+    template <typename T>
+    void transformPoints(const Matrix<T, 4, 4>& m, Span<Vector<T, 3>> points) {
+        transformPoints(m, points, points);
+    }
+
+    // --- 7. VISUALIZACIÓN ---
+    template <typename CharT, typename Traits, typename T, size_t R, size_t C>
+    std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const Matrix<T, R, C>& m) {
+        os << "[";
+        for (size_t r = 0; r < R; ++r) {
+            os << m.rows[r];
+            if (r < R - 1) os << ", ";
+        }
+        os << "]";
+        return os;
+    }
+
+} // namespace TinyGeo
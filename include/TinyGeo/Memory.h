@@ -0,0 +1,306 @@
+#pragma once
+
+// Memoria transitoria por frame.
+//
+//   Arena:          bloques enlazados + puntero "bump"; reset() en O(1).
+//   ArenaAllocator: allocator STL sobre una Arena (VectorSoA, std::vector,
+//                   KdTree / Bvh...). deallocate() solo recupera la
+//                   última reserva; el resto vuelve junto con reset().
+//   ArenaPool:      una Arena por hilo, sin contención entre hilos; reset()
+//                   las rebobina todas al final del frame.
+//
+//   ArenaPool frame;
+//   ...
+//   std::vector<Vector<float, 3>, ArenaAllocator<Vector<float, 3>>> tmp(frame);
+//   VectorSoA<float, 3, ArenaAllocator<float>> soa{ArenaAllocator<float>(frame)};
+//   ...
+//   frame.reset(); // Fin del frame: sin free() por buffer
+//
+// Ningún contenedor respaldado por una Arena debe usarse tras su reset().
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "TinyGeo/AlignedAllocator.h"
+
+namespace TinyGeo {
+
+    // Bump allocator. No es thread-safe: cada hilo usa la suya (ArenaPool).
+    class Arena {
+    public:
+        static constexpr size_t kDefaultBlockSize = 256 * 1024;
+
+        explicit Arena(size_t blockSize = kDefaultBlockSize) : blockSize_(std::max(blockSize, kCacheLine)) {}
+
+        ~Arena() {
+            Block* b = head_;
+            while (b) {
+                Block* next = b->next;
+                ::operator delete(b, std::align_val_t(kCacheLine));
+                b = next;
+            }
+        }
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        // Memoria sin inicializar de 'bytes' bytes alineada a 'align'
+        // (potencia de dos, como mucho una línea de caché).
+        void* allocate(size_t bytes, size_t align = kCacheLine) {
+            assert(align > 0 && (align & (align - 1)) == 0 && "Alignment must be a power of two");
+            assert(align <= kCacheLine && "Arena alignment is limited to a cache line");
+            if (current_) {
+                if (void* p = bump(current_, bytes, align)) return p;
+            }
+            // Reutiliza bloques retenidos de frames anteriores antes de pedir más
+            while (current_ && current_->next) {
+                current_ = current_->next;
+                offset_ = 0;
+                if (void* p = bump(current_, bytes, align)) return p;
+            }
+            return bump(grow(bytes), bytes, align);
+        }
+
+        // Solo recupera la última reserva (patrón pila); el resto espera a reset()
+        void deallocate(void* p, size_t bytes) noexcept {
+            if (current_ && static_cast<char*>(p) + bytes == current_->data() + offset_) {
+                offset_ = size_t(static_cast<char*>(p) - current_->data());
+            }
+        }
+
+        // Rebobina al primer bloque. Los bloques se conservan para el
+        // siguiente frame: tras el primero ya no hay llamadas al sistema.
+        void reset() noexcept {
+            current_ = head_;
+            offset_ = 0;
+        }
+
+        // Punto de rebobinado para memoria de ámbito anidado (ver ArenaScope)
+        struct Marker {
+            void* block;
+            size_t offset;
+        };
+
+        Marker mark() const noexcept { return {current_, offset_}; }
+
+        void rewind(const Marker& m) noexcept {
+            current_ = static_cast<Block*>(m.block);
+            offset_ = m.offset;
+            if (!current_) reset();
+        }
+
+        // Bytes reservados al sistema (suma de la capacidad de los bloques)
+        size_t capacity() const noexcept {
+            size_t total = 0;
+            for (const Block* b = head_; b; b = b->next) total += b->capacity;
+            return total;
+        }
+
+    private:
+        // Cabecera de una línea de caché: los datos empiezan alineados
+        struct alignas(kCacheLine) Block {
+            Block* next;
+            size_t capacity;
+
+            char* data() { return reinterpret_cast<char*>(this) + sizeof(Block); }
+        };
+
+        void* bump(Block* b, size_t bytes, size_t align) {
+            const size_t start = (offset_ + align - 1) & ~(align - 1);
+            if (start + bytes > b->capacity) return nullptr;
+            offset_ = start + bytes;
+            return b->data() + start;
+        }
+
+        // Nuevo bloque tras el actual (las reservas enormes reciben uno a medida)
+        Block* grow(size_t bytes) {
+            const size_t capacity = std::max(blockSize_, (bytes + kCacheLine - 1) & ~(kCacheLine - 1));
+            void* raw = ::operator new(sizeof(Block) + capacity, std::align_val_t(kCacheLine));
+            Block* b = new (raw) Block{nullptr, capacity};
+            if (current_) {
+                b->next = current_->next;
+                current_->next = b;
+            } else {
+                b->next = head_;
+                head_ = b;
+            }
+            current_ = b;
+            offset_ = 0;
+            return b;
+        }
+
+        size_t blockSize_;
+        Block* head_ = nullptr;
+        Block* current_ = nullptr;
+        size_t offset_ = 0;
+    };
+
+    // RAII: lo reservado dentro del ámbito se libera al salir (O(1))
+    class ArenaScope {
+    public:
+        explicit ArenaScope(Arena& arena) : arena_(arena), marker_(arena.mark()) {}
+        ~ArenaScope() { arena_.rewind(marker_); }
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+    private:
+        Arena& arena_;
+        Arena::Marker marker_;
+    };
+
+    // Una Arena por hilo. local() solo toma el mutex la primera vez que un
+    // hilo la usa con este pool; después es una búsqueda thread_local.
+    // reset() debe llamarse cuando ningún hilo esté reservando (fin de frame).
+    //
+    // La caché por hilo no crece sin límite con pools de vida corta (uno por
+    // frame o por tarea): cada fallo de caché, que ya es el camino lento,
+    // descarta las entradas de pools destruidos. Su tamaño queda acotado por
+    // los pools vivos que ese hilo ha usado.
+    class ArenaPool {
+    public:
+        explicit ArenaPool(size_t blockSize = Arena::kDefaultBlockSize) : id_(registerPool()), blockSize_(blockSize) {}
+
+        ~ArenaPool() { unregisterPool(id_); }
+
+        ArenaPool(const ArenaPool&) = delete;
+        ArenaPool& operator=(const ArenaPool&) = delete;
+
+        Arena& local() {
+            // Caché por hilo (id de pool -> Arena). Los ids no se reutilizan,
+            // así que las entradas de pools ya destruidos nunca coinciden.
+            thread_local std::vector<std::pair<uint64_t, Arena*>> cache;
+            for (const auto& entry : cache) {
+                if (entry.first == id_) return *entry.second;
+            }
+            pruneDead(cache);
+            Arena* arena;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                arenas_.push_back(std::make_unique<Arena>(blockSize_));
+                arena = arenas_.back().get();
+            }
+            cache.emplace_back(id_, arena);
+            return *arena;
+        }
+
+        void reset() noexcept {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& a : arenas_) a->reset();
+        }
+
+        size_t capacity() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            size_t total = 0;
+            for (const auto& a : arenas_) total += a->capacity();
+            return total;
+        }
+
+    private:
+        // Ids de los pools vivos, ordenados (se asignan bajo el mismo mutex).
+        // Nunca se destruye: pools estáticos pueden morir después.
+        struct Registry {
+            std::mutex mutex;
+            uint64_t nextId = 1;
+            std::vector<uint64_t> live;
+        };
+
+        static Registry& registry() {
+            static Registry* r = new Registry;
+            return *r;
+        }
+
+        static uint64_t registerPool() {
+            Registry& r = registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            r.live.push_back(r.nextId);
+            return r.nextId++;
+        }
+
+        static void unregisterPool(uint64_t id) noexcept {
+            Registry& r = registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            const auto it = std::lower_bound(r.live.begin(), r.live.end(), id);
+            if (it != r.live.end() && *it == id) r.live.erase(it);
+        }
+
+        static void pruneDead(std::vector<std::pair<uint64_t, Arena*>>& cache) {
+            if (cache.empty()) return;
+            Registry& r = registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            cache.erase(std::remove_if(cache.begin(), cache.end(),
+                                       [&](const auto& entry) {
+                                           return !std::binary_search(r.live.begin(), r.live.end(), entry.first);
+                                       }),
+                        cache.end());
+        }
+
+        const uint64_t id_;
+        const size_t blockSize_;
+        mutable std::mutex mutex_;
+        std::vector<std::unique_ptr<Arena>> arenas_;
+    };
+
+    // Arena propia del hilo actual (vive hasta que el hilo termina)
+    inline Arena& threadArena() {
+        thread_local Arena arena;
+        return arena;
+    }
+
+    // Allocator STL sobre una Arena. Alineado a 'Align' (por defecto una
+    // línea de caché, como AlignedAllocator) para los backends SIMD.
+    // Construido por defecto usa threadArena() del hilo que lo crea.
+    template <typename T, size_t Align = kCacheLine>
+    class ArenaAllocator {
+    public:
+        static_assert((Align & (Align - 1)) == 0, "Alignment must be a power of two");
+        static_assert(Align >= alignof(T), "Alignment must be at least alignof(T)");
+        static_assert(Align <= kCacheLine, "Arena alignment is limited to a cache line");
+
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        template <typename U>
+        struct rebind { using other = ArenaAllocator<U, Align>; };
+
+        static constexpr size_t alignment = Align;
+
+        ArenaAllocator() noexcept : arena_(&threadArena()) {}
+        ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+        ArenaAllocator(ArenaPool& pool) : arena_(&pool.local()) {}
+
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U, Align>& other) noexcept : arena_(other.arena()) {}
+
+        T* allocate(size_t n) { return static_cast<T*>(arena_->allocate(n * sizeof(T), Align)); }
+
+        void deallocate(T* p, size_t n) noexcept { arena_->deallocate(p, n * sizeof(T)); }
+
+        Arena* arena() const noexcept { return arena_; }
+
+    private:
+        Arena* arena_;
+    };
+
+    template <typename T, typename U, size_t A>
+    bool operator==(const ArenaAllocator<T, A>& a, const ArenaAllocator<U, A>& b) noexcept {
+        return a.arena() == b.arena();
+    }
+
+    template <typename T, typename U, size_t A>
+    bool operator!=(const ArenaAllocator<T, A>& a, const ArenaAllocator<U, A>& b) noexcept {
+        return !(a == b);
+    }
+
+} // namespace TinyGeo
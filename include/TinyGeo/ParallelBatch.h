@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+
+#include "TinyGeo/AlignedAllocator.h"
+#include "TinyGeo/Batch.h"
+#include "TinyGeo/ThreadPool.h"
+
+namespace TinyGeo {
+
+    // Políticas de ejecución para los kernels por lotes.
+    //   batch::normalize(execution::par, Span(points));          // pool global
+    //   batch::normalize(execution::on(myPool), Span(points));   // pool propio
+    //   batch::normalize(myPool, Span(points));                  // equivalente
+namespace execution {
+
+    struct ParallelPolicy {
+        ThreadPool* pool = nullptr; // nullptr = ThreadPool::global()
+
+        ThreadPool& resolve() const { return pool ? *pool : ThreadPool::global(); }
+    };
+
+    inline constexpr ParallelPolicy par{};
+
+    inline ParallelPolicy on(ThreadPool& pool) { return ParallelPolicy{&pool}; }
+
+} // namespace execution
+
+namespace batch {
+namespace detail {
+
+    // Tamaño de chunk: suficientes chunks para balancear (8 por hilo) pero
+    // acotados a [4 KiB, 64 KiB] de entrada, para que cada chunk quepa en
+    // L1/L2 mientras se procesa.
+    inline constexpr size_t kMinChunkBytes = 4 * 1024;
+    inline constexpr size_t kMaxChunkBytes = 64 * 1024;
+    inline constexpr size_t kChunksPerThread = 8;
+
+    // Elementos por chunk, redondeado a un múltiplo de
+    // lcm(sizeof(Out), kCacheLine) / sizeof(Out): cada chunk de salida cubre
+    // un número entero de líneas de caché (con Vector<float, 3>, 16
+    // elementos = 192 bytes = 3 líneas). Junto con alignmentHead() dos hilos
+    // no escriben en la misma línea (sin false sharing).
+    template <typename In, typename Out>
+    size_t chunkGrain(size_t count, const ThreadPool& pool) {
+        const size_t minGrain = std::max<size_t>(kMinChunkBytes / sizeof(In), 1);
+        const size_t maxGrain = std::max<size_t>(kMaxChunkBytes / sizeof(In), 1);
+        size_t grain = count / (pool.concurrency() * kChunksPerThread);
+        grain = std::min(std::max(grain, minGrain), maxGrain);
+        const size_t lineElems = std::lcm(sizeof(Out), kCacheLine) / sizeof(Out);
+        return (grain + lineElems - 1) / lineElems * lineElems;
+    }
+
+    // Elementos iniciales hasta que out + head queda en un límite de línea
+    // de caché. Ese prefijo (< lcm(sizeof(Out), kCacheLine) bytes) se procesa
+    // en el hilo llamador y el resto de fronteras de chunk caen en límites
+    // de línea. Si ningún prefijo alinea 'out' (dirección no múltiplo de
+    // gcd(sizeof(Out), kCacheLine)) devuelve 0: los chunks siguen siendo
+    // correctos, pero dos vecinos pueden compartir una línea en la frontera.
+    template <typename Out>
+    size_t alignmentHead(const Out* out, size_t count) {
+        const size_t misalign = size_t(reinterpret_cast<uintptr_t>(out) % kCacheLine);
+        const size_t lineElems = std::lcm(sizeof(Out), kCacheLine) / sizeof(Out);
+        for (size_t head = 0; head < lineElems; ++head) {
+            if ((misalign + head * sizeof(Out)) % kCacheLine == 0) return std::min(head, count);
+        }
+        return 0;
+    }
+
+    // Divide [0, count) en chunks y llama fn(begin, end) en paralelo
+    template <typename In, typename Out, typename Fn>
+    void parallelChunks(const execution::ParallelPolicy& policy, const Out* out, size_t count, Fn&& fn) {
+        ThreadPool& pool = policy.resolve();
+        const size_t head = alignmentHead(out, count);
+        if (head > 0) {
+            fn(size_t(0), head);
+        }
+        const size_t rest = count - head;
+        pool.parallelFor(rest, chunkGrain<In, Out>(rest, pool), [&](size_t b, size_t e) {
+            fn(head + b, head + e);
+        });
+    }
+
+} // namespace detail
+
+    // --- Versiones paralelas: misma semántica que las de Batch.h ---
+
+    template <typename VA, typename VB, typename T>
+    void dot(const execution::ParallelPolicy& policy, Span<VA> a, Span<VB> b, Span<T> out) {
+        assert(a.size() == b.size() && out.size() == a.size() && "Batch size mismatch");
+        detail::parallelChunks<VA>(policy, out.data(), a.size(), [&](size_t s, size_t e) {
+            dot(a.subspan(s, e - s), b.subspan(s, e - s), out.subspan(s, e - s));
+        });
+    }
+
+    template <typename VA, typename T>
+    void normSq(const execution::ParallelPolicy& policy, Span<VA> a, Span<T> out) {
+        dot(policy, a, a, out);
+    }
+
+    template <typename VA, typename VB, typename VO>
+    void cross(const execution::ParallelPolicy& policy, Span<VA> a, Span<VB> b, Span<VO> out) {
+        assert(a.size() == b.size() && out.size() == a.size() && "Batch size mismatch");
+        detail::parallelChunks<VA>(policy, out.data(), a.size(), [&](size_t s, size_t e) {
+            cross(a.subspan(s, e - s), b.subspan(s, e - s), out.subspan(s, e - s));
+        });
+    }
+
+    template <typename VI, typename VO>
+    void normalize(const execution::ParallelPolicy& policy, Span<VI> in, Span<VO> out) {
+        assert(in.size() == out.size() && "Batch size mismatch");
+        detail::parallelChunks<VI>(policy, out.data(), in.size(), [&](size_t s, size_t e) {
+            normalize(in.subspan(s, e - s), out.subspan(s, e - s));
+        });
+    }
+
+    template <typename V>
+    void normalize(const execution::ParallelPolicy& policy, Span<V> v) {
+        normalize(policy, v, v);
+    }
+
+    template <typename VX, typename VY>
+    void axpy(const execution::ParallelPolicy& policy, detail::Scalar<VX> alpha, Span<VX> x, Span<VY> y) {
+        assert(x.size() == y.size() && "Batch size mismatch");
+        detail::parallelChunks<VX>(policy, y.data(), x.size(), [&](size_t s, size_t e) {
+            axpy(alpha, x.subspan(s, e - s), y.subspan(s, e - s));
+        });
+    }
+
+    template <typename VA, typename VB, typename VO>
+    void add(const execution::ParallelPolicy& policy, Span<VA> a, Span<VB> b, Span<VO> out) {
+        assert(a.size() == b.size() && out.size() == a.size() && "Batch size mismatch");
+        detail::parallelChunks<VA>(policy, out.data(), a.size(), [&](size_t s, size_t e) {
+            add(a.subspan(s, e - s), b.subspan(s, e - s), out.subspan(s, e - s));
+        });
+    }
+
+    template <typename VA, typename VB, typename VO>
+    void sub(const execution::ParallelPolicy& policy, Span<VA> a, Span<VB> b, Span<VO> out) {
+        assert(a.size() == b.size() && out.size() == a.size() && "Batch size mismatch");
+        detail::parallelChunks<VA>(policy, out.data(), a.size(), [&](size_t s, size_t e) {
+            sub(a.subspan(s, e - s), b.subspan(s, e - s), out.subspan(s, e - s));
+        });
+    }
+
+    template <typename V>
+    void scale(const execution::ParallelPolicy& policy, Span<V> v, detail::Scalar<V> s) {
+        detail::parallelChunks<V>(policy, v.data(), v.size(), [&](size_t b, size_t e) {
+            scale(v.subspan(b, e - b), s);
+        });
+    }
+
+    // --- Atajos con un ThreadPool explícito ---
+
+    template <typename VA, typename VB, typename T>
+    void dot(ThreadPool& pool, Span<VA> a, Span<VB> b, Span<T> out) { dot(execution::on(pool), a, b, out); }
+
+    template <typename VA, typename T>
+    void normSq(ThreadPool& pool, Span<VA> a, Span<T> out) { normSq(execution::on(pool), a, out); }
+
+    template <typename VA, typename VB, typename VO>
+    void cross(ThreadPool& pool, Span<VA> a, Span<VB> b, Span<VO> out) { cross(execution::on(pool), a, b, out); }
+
+    template <typename VI, typename VO>
+    void normalize(ThreadPool& pool, Span<VI> in, Span<VO> out) { normalize(execution::on(pool), in, out); }
+
+    template <typename V>
+    void normalize(ThreadPool& pool, Span<V> v) { normalize(execution::on(pool), v); }
+
+    template <typename VX, typename VY>
+    void axpy(ThreadPool& pool, detail::Scalar<VX> alpha, Span<VX> x, Span<VY> y) { axpy(execution::on(pool), alpha, x, y); }
+
+    template <typename VA, typename VB, typename VO>
+    void add(ThreadPool& pool, Span<VA> a, Span<VB> b, Span<VO> out) { add(execution::on(pool), a, b, out); }
+
+    template <typename VA, typename VB, typename VO>
+    void sub(ThreadPool& pool, Span<VA> a, Span<VB> b, Span<VO> out) { sub(execution::on(pool), a, b, out); }
+
+    template <typename V>
+    void scale(ThreadPool& pool, Span<V> v, detail::Scalar<V> s) { scale(execution::on(pool), v, s); }
+
+} // namespace batch
+} // namespace TinyGeo
@@ -0,0 +1,486 @@
+#pragma once
+
+// Procesamiento en streaming de registros Vector<T, N> por chunks, para
+// datos que no caben en memoria.
+//
+//   using V = Vector<float, 3>;
+//   stream::FileSource<V> in("scan.tgpc", stream::Format::PointCloud);
+//   stream::FileSink<V> out("clean.tgpc", stream::Format::PointCloud);
+//   AABB3f box;
+//   stream::Pipeline<V>(64 * 1024)
+//       .filter([](const V& p) { return p.normSq() > 0.0f; })
+//       .normalize()
+//       .bounds(box)
+//       .run(in, out);
+//
+// run() usa tres buffers de chunk que rotan entre un hilo lector, el hilo
+// llamador (que aplica las etapas) y un hilo escritor: la lectura del
+// chunk i+1 y la escritura del i-1 se solapan con el cálculo del chunk i.
+// La memoria es 3 * chunkSize registros sea cual sea el tamaño de la entrada.
+//
+// Fuente: cualquier tipo con 'size_t read(Span<V>)' (0 = fin de datos).
+// Sumidero: cualquier tipo con 'void write(Span<const V>)'.
+// Una excepción de la fuente, el sumidero o una etapa detiene los tres
+// hilos y se relanza desde run().
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "TinyGeo/AABB.h"
+#include "TinyGeo/AlignedAllocator.h"
+#include "TinyGeo/Batch.h"
+#include "TinyGeo/PointCloudIO.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+namespace stream {
+
+    // Raw: registros V sin cabecera. PointCloud: formato .tgpc AoS (PointCloudIO.h)
+    enum class Format { Raw, PointCloud };
+
+namespace detail {
+
+    [[noreturn]] inline void fail(const std::string& what, int err) {
+        throw std::runtime_error("TinyGeo stream: " + what + ": " + std::strerror(err));
+    }
+
+    // read() completo: reintenta lecturas parciales (sockets, pipes) y EINTR
+    inline size_t readFully(int fd, char* dst, size_t bytes) {
+        size_t done = 0;
+        while (done < bytes) {
+            const ssize_t r = ::read(fd, dst + done, bytes - done);
+            if (r == 0) break;
+            if (r < 0) {
+                if (errno == EINTR) continue;
+                fail("read failed", errno);
+            }
+            done += size_t(r);
+        }
+        return done;
+    }
+
+    inline void writeFully(int fd, const char* src, size_t bytes) {
+        size_t done = 0;
+        while (done < bytes) {
+            const ssize_t w = ::write(fd, src + done, bytes - done);
+            if (w < 0) {
+                if (errno == EINTR) continue;
+                fail("write failed", errno);
+            }
+            done += size_t(w);
+        }
+    }
+
+    // Cola bloqueante de índices de buffer; close() despierta a todos
+    class Channel {
+    public:
+        void push(size_t value) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                items_.push_back(value);
+            }
+            ready_.notify_one();
+        }
+
+        // false si el canal está cerrado y vacío
+        bool pop(size_t& out) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ready_.wait(lock, [this] { return closed_ || !items_.empty(); });
+            if (items_.empty()) return false;
+            out = items_.front();
+            items_.pop_front();
+            return true;
+        }
+
+        void close() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                closed_ = true;
+            }
+            ready_.notify_all();
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        std::deque<size_t> items_;
+        bool closed_ = false;
+    };
+
+} // namespace detail
+
+    // --- FUENTES ---
+
+    // Registros V desde un descriptor (archivo, pipe o socket)
+    template <typename V>
+    class FdSource {
+    public:
+        explicit FdSource(int fd) : fd_(fd) {}
+
+        size_t read(Span<V> out) {
+            const size_t bytes = detail::readFully(fd_, reinterpret_cast<char*>(out.data()), out.size() * sizeof(V));
+            if (bytes % sizeof(V) != 0) {
+                throw std::runtime_error("TinyGeo stream: input ends in the middle of a record");
+            }
+            return bytes / sizeof(V);
+        }
+
+    protected:
+        int fd_;
+    };
+
+    // Archivo en disco; con Format::PointCloud valida la cabecera .tgpc
+    template <typename V>
+    class FileSource : public FdSource<V> {
+    public:
+        explicit FileSource(const std::string& path, Format format = Format::Raw)
+            : FdSource<V>(::open(path.c_str(), O_RDONLY)) {
+            if (this->fd_ < 0) detail::fail("cannot open '" + path + "'", errno);
+            if (format == Format::PointCloud) {
+                try {
+                    readHeader(path);
+                } catch (...) {
+                    ::close(this->fd_);
+                    throw;
+                }
+            }
+        }
+
+        ~FileSource() { ::close(this->fd_); }
+
+        FileSource(const FileSource&) = delete;
+        FileSource& operator=(const FileSource&) = delete;
+
+        // Puntos restantes según la cabecera (solo Format::PointCloud)
+        uint64_t remaining() const { return remaining_; }
+
+        size_t read(Span<V> out) {
+            if (limited_) {
+                if (out.size() > remaining_) out = out.subspan(0, size_t(remaining_));
+                const size_t n = FdSource<V>::read(out);
+                remaining_ -= n;
+                return n;
+            }
+            return FdSource<V>::read(out);
+        }
+
+    private:
+        void readHeader(const std::string& path) {
+            io::PointCloudHeader h{};
+            if (detail::readFully(this->fd_, reinterpret_cast<char*>(&h), sizeof(h)) != sizeof(h)) {
+                throw std::runtime_error("TinyGeo stream: '" + path + "' is too small for a header");
+            }
+            io::detail::validateHeader(path, h);
+            io::detail::expectAoS<V>(path, h);
+            if (::lseek(this->fd_, off_t(h.dataOffset), SEEK_SET) < 0) detail::fail("seek failed", errno);
+            remaining_ = h.count;
+            limited_ = true;
+        }
+
+        uint64_t remaining_ = 0;
+        bool limited_ = false;
+    };
+
+    // Memoria existente (pruebas, o datos ya cargados)
+    template <typename V>
+    class SpanSource {
+    public:
+        explicit SpanSource(Span<const V> data) : data_(data) {}
+
+        size_t read(Span<V> out) {
+            const size_t n = std::min(out.size(), data_.size() - pos_);
+            std::copy(data_.data() + pos_, data_.data() + pos_ + n, out.data());
+            pos_ += n;
+            return n;
+        }
+
+    private:
+        Span<const V> data_;
+        size_t pos_ = 0;
+    };
+
+    // --- SUMIDEROS ---
+
+    template <typename V>
+    class FdSink {
+    public:
+        explicit FdSink(int fd) : fd_(fd) {}
+
+        void write(Span<const V> chunk) {
+            detail::writeFully(fd_, reinterpret_cast<const char*>(chunk.data()), chunk.size() * sizeof(V));
+        }
+
+    protected:
+        int fd_;
+    };
+
+    // Archivo en disco. Con Format::PointCloud escribe la cabecera .tgpc al
+    // abrir y la completa (número de puntos) en close() o en el destructor.
+    template <typename V>
+    class FileSink : public FdSink<V> {
+    public:
+        explicit FileSink(const std::string& path, Format format = Format::Raw)
+            : FdSink<V>(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)), format_(format) {
+            if (this->fd_ < 0) detail::fail("cannot create '" + path + "'", errno);
+            if (format_ == Format::PointCloud) {
+                // Si la cabecera falla el destructor no llega a ejecutarse
+                try {
+                    writeHeader(0);
+                    const char zeros[kCacheLine] = {};
+                    detail::writeFully(this->fd_, zeros, size_t(header(0).dataOffset) - sizeof(io::PointCloudHeader));
+                } catch (...) {
+                    ::close(this->fd_);
+                    throw;
+                }
+            }
+        }
+
+        ~FileSink() {
+            try {
+                close();
+            } catch (...) {
+                // El destructor no puede lanzar: llama a close() para ver el error
+            }
+        }
+
+        FileSink(const FileSink&) = delete;
+        FileSink& operator=(const FileSink&) = delete;
+
+        void write(Span<const V> chunk) {
+            FdSink<V>::write(chunk);
+            written_ += chunk.size();
+        }
+
+        void close() {
+            if (this->fd_ < 0) return;
+            const int fd = std::exchange(this->fd_, -1);
+            if (format_ == Format::PointCloud) {
+                if (::lseek(fd, 0, SEEK_SET) < 0) {
+                    ::close(fd);
+                    detail::fail("seek failed", errno);
+                }
+                const io::PointCloudHeader h = header(written_);
+                try {
+                    detail::writeFully(fd, reinterpret_cast<const char*>(&h), sizeof(h));
+                } catch (...) {
+                    ::close(fd);
+                    throw;
+                }
+            }
+            if (::close(fd) != 0) detail::fail("close failed", errno);
+        }
+
+        uint64_t written() const { return written_; }
+
+    private:
+        static io::PointCloudHeader header(uint64_t count) {
+            using T = typename V::value_type;
+            return io::detail::makeHeader(io::scalarTypeOf<T>(), uint32_t(V::static_size), uint32_t(sizeof(V)),
+                                          io::Layout::AoS, count, 0);
+        }
+
+        void writeHeader(uint64_t count) {
+            const io::PointCloudHeader h = header(count);
+            detail::writeFully(this->fd_, reinterpret_cast<const char*>(&h), sizeof(h));
+        }
+
+        Format format_;
+        uint64_t written_ = 0;
+    };
+
+    // Acumula en memoria (pruebas, o resultados pequeños tras un filtro)
+    template <typename V>
+    class VectorSink {
+    public:
+        void write(Span<const V> chunk) { data.insert(data.end(), chunk.begin(), chunk.end()); }
+
+        std::vector<V> data;
+    };
+
+    // Descarta todo (pipelines que solo reducen, p.ej. bounds())
+    template <typename V>
+    struct NullSink {
+        void write(Span<const V>) {}
+    };
+
+    // --- PIPELINE ---
+
+    struct PipelineStats {
+        uint64_t read = 0;    // Registros leídos de la fuente
+        uint64_t written = 0; // Registros entregados al sumidero
+        uint64_t chunks = 0;
+    };
+
+    template <typename V>
+    class Pipeline {
+        using T = typename V::value_type;
+        static constexpr size_t N = V::static_size;
+
+    public:
+        static constexpr size_t kDefaultChunkSize = 64 * 1024;
+
+        // Cada etapa procesa un chunk in-place y devuelve cuántos registros
+        // siguen (los filtros compactan el chunk).
+        using Stage = std::function<size_t(Span<V>)>;
+
+        explicit Pipeline(size_t chunkSize = kDefaultChunkSize) : chunkSize_(chunkSize) {
+            assert(chunkSize > 0 && "Chunk size must be positive");
+        }
+
+        size_t chunkSize() const { return chunkSize_; }
+
+        // Etapa genérica sobre el chunk completo
+        Pipeline& stage(Stage s) {
+            stages_.push_back(std::move(s));
+            return *this;
+        }
+
+        // v = fn(v) para cada registro
+        template <typename Fn>
+        Pipeline& transform(Fn fn) {
+            return stage([fn](Span<V> chunk) {
+                for (V& v : chunk) v = fn(v);
+                return chunk.size();
+            });
+        }
+
+        Pipeline& normalize() {
+            return stage([](Span<V> chunk) {
+                batch::normalize(chunk);
+                return chunk.size();
+            });
+        }
+
+        // Conserva los registros con pred(v) == true (orden estable)
+        template <typename Pred>
+        Pipeline& filter(Pred pred) {
+            return stage([pred](Span<V> chunk) {
+                size_t kept = 0;
+                for (size_t i = 0; i < chunk.size(); ++i) {
+                    if (pred(chunk.data()[i])) chunk.data()[kept++] = chunk.data()[i];
+                }
+                return kept;
+            });
+        }
+
+        // Expande 'box' con cada registro que llega a esta etapa. La caja se
+        // lee tras run(); no se reinicia, así que varias pasadas acumulan.
+        Pipeline& bounds(AABB<T, N>& box) {
+            return stage([&box](Span<V> chunk) {
+                AABB<T, N> local;
+                for (const V& v : chunk) local.expand(Vector<T, N>(v));
+                box.expand(local);
+                return chunk.size();
+            });
+        }
+
+        template <typename Source>
+        PipelineStats run(Source& source) {
+            NullSink<V> sink;
+            return run(source, sink);
+        }
+
+        template <typename Source, typename Sink>
+        PipelineStats run(Source& source, Sink& sink) {
+            std::vector<V, AlignedAllocator<V>> buffers[kBuffers];
+            size_t counts[kBuffers] = {};
+            detail::Channel freeQ, filledQ, doneQ;
+            for (size_t i = 0; i < kBuffers; ++i) {
+                buffers[i].resize(chunkSize_);
+                freeQ.push(i);
+            }
+
+            std::mutex errorMutex;
+            std::exception_ptr error;
+            auto abort = [&](std::exception_ptr e) {
+                {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) error = e;
+                }
+                freeQ.close();
+                filledQ.close();
+                doneQ.close();
+            };
+
+            PipelineStats stats;
+            std::thread reader([&] {
+                try {
+                    size_t idx;
+                    while (freeQ.pop(idx)) {
+                        const size_t n = source.read(Span<V>(buffers[idx].data(), chunkSize_));
+                        if (n == 0) break;
+                        counts[idx] = n;
+                        stats.read += n;
+                        filledQ.push(idx);
+                    }
+                    filledQ.close();
+                } catch (...) {
+                    abort(std::current_exception());
+                }
+            });
+
+            std::thread writer([&] {
+                try {
+                    size_t idx;
+                    while (doneQ.pop(idx)) {
+                        sink.write(Span<const V>(buffers[idx].data(), counts[idx]));
+                        stats.written += counts[idx];
+                        freeQ.push(idx);
+                    }
+                } catch (...) {
+                    abort(std::current_exception());
+                }
+            });
+
+            try {
+                size_t idx;
+                while (filledQ.pop(idx)) {
+                    size_t n = counts[idx];
+                    for (const Stage& s : stages_) {
+                        if (n == 0) break;
+                        n = s(Span<V>(buffers[idx].data(), n));
+                    }
+                    counts[idx] = n;
+                    ++stats.chunks;
+                    doneQ.push(idx);
+                }
+                doneQ.close();
+            } catch (...) {
+                abort(std::current_exception());
+            }
+
+            writer.join();
+            freeQ.close(); // El lector puede estar esperando un buffer libre
+            reader.join();
+            if (error) std::rethrow_exception(error);
+            return stats;
+        }
+
+    private:
+        // Lector, cálculo y escritor trabajan cada uno sobre su buffer
+        static constexpr size_t kBuffers = 3;
+
+        size_t chunkSize_;
+        std::vector<Stage> stages_;
+    };
+
+} // namespace stream
+} // namespace TinyGeo
@@ -0,0 +1,338 @@
+#pragma once
+
+// Formato binario de nubes de puntos (.tgpc) y carga por mmap sin copia.
+//
+//   [cabecera de 64 bytes][padding hasta dataOffset][datos]
+//
+// Los datos son la imagen en memoria de los Vector: en AoS un array de
+// Vector<T, N, S> (stride = sizeof del Vector, padding incluido); en SoA
+// N carriles de laneStride escalares cada uno. dataOffset y laneStride se
+// alinean a 'alignment', y mmap devuelve direcciones alineadas a página,
+// así que los datos mapeados cumplen la alineación que piden los backends
+// SIMD sin copiarlos.
+//
+//   writePointCloud("scan.tgpc", Span<const Vector<float, 3>>(points));
+//   MappedPointCloud cloud("scan.tgpc");
+//   Span<const Vector<float, 3>> pts = cloud.points<float, 3>(); // sin parseo
+//
+// Los errores de E/S y de formato lanzan std::runtime_error.
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(_WIN32)
+#error "PointCloudIO.h: memory mapping is only implemented for POSIX systems"
+#endif
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "TinyGeo/AlignedAllocator.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+#include "TinyGeo/VectorSoA.h"
+
+namespace TinyGeo {
+namespace io {
+
+    enum class ScalarType : uint32_t { Float32 = 1, Float64 = 2, Int16 = 3 };
+    enum class Layout : uint32_t { AoS = 0, SoA = 1 };
+
+    template <typename T>
+    constexpr ScalarType scalarTypeOf() {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_same_v<T, int16_t>,
+                      "Point clouds store float, double or int16 scalars");
+        if constexpr (std::is_same_v<T, float>) return ScalarType::Float32;
+        else if constexpr (std::is_same_v<T, double>) return ScalarType::Float64;
+        else return ScalarType::Int16;
+    }
+
+    inline constexpr char kMagic[4] = {'T', 'G', 'P', 'C'};
+    inline constexpr uint32_t kVersion = 1;
+    inline constexpr uint32_t kByteOrderMark = 0x01020304u; // Detecta endianness distinta
+
+    // Cabecera en disco: 64 bytes, todos los campos con tamaño fijo
+    struct PointCloudHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t byteOrder;
+        ScalarType scalarType;
+        uint32_t dimension;   // N
+        uint32_t stride;      // AoS: bytes por punto; SoA: sizeof(T)
+        Layout layout;
+        uint32_t alignment;   // Alineación de dataOffset (y de cada carril SoA)
+        uint64_t count;       // Número de puntos
+        uint64_t dataOffset;  // Bytes desde el inicio del archivo
+        uint64_t laneStride;  // SoA: escalares entre carriles; AoS: 0
+        uint8_t reserved[8];
+    };
+    static_assert(sizeof(PointCloudHeader) == 64, "Header must stay 64 bytes");
+
+namespace detail {
+
+    [[noreturn]] inline void fail(const std::string& path, const std::string& what) {
+        throw std::runtime_error("TinyGeo point cloud '" + path + "': " + what);
+    }
+
+    inline constexpr uint64_t alignUp(uint64_t value, uint64_t align) {
+        return (value + align - 1) / align * align;
+    }
+
+    inline PointCloudHeader makeHeader(ScalarType type, uint32_t dimension, uint32_t stride,
+                                       Layout layout, uint64_t count, uint64_t laneStride) {
+        PointCloudHeader h{};
+        std::memcpy(h.magic, kMagic, sizeof(kMagic));
+        h.version = kVersion;
+        h.byteOrder = kByteOrderMark;
+        h.scalarType = type;
+        h.dimension = dimension;
+        h.stride = stride;
+        h.layout = layout;
+        h.alignment = uint32_t(kCacheLine);
+        h.count = count;
+        h.dataOffset = alignUp(sizeof(PointCloudHeader), kCacheLine);
+        h.laneStride = laneStride;
+        return h;
+    }
+
+    // Cabecera + relleno hasta dataOffset
+    inline std::ofstream openForWrite(const std::string& path, const PointCloudHeader& h) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) fail(path, std::string("cannot open for writing: ") + std::strerror(errno));
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        const char zeros[kCacheLine] = {};
+        out.write(zeros, std::streamsize(h.dataOffset - sizeof(h)));
+        return out;
+    }
+
+    inline void finish(std::ofstream& out, const std::string& path) {
+        out.flush();
+        if (!out) fail(path, "write failed");
+    }
+
+    // Campos independientes del tipo de elemento
+    inline void validateHeader(const std::string& path, const PointCloudHeader& h) {
+        if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0) fail(path, "bad magic");
+        if (h.version != kVersion) fail(path, "unsupported version " + std::to_string(h.version));
+        if (h.byteOrder != kByteOrderMark) fail(path, "byte order mismatch");
+        if (h.layout != Layout::AoS && h.layout != Layout::SoA) fail(path, "unknown layout");
+        if (h.dataOffset < sizeof(PointCloudHeader)) fail(path, "data offset inside the header");
+        if (h.alignment == 0 || (h.alignment & (h.alignment - 1)) != 0) fail(path, "alignment is not a power of two");
+        if (h.dataOffset % h.alignment != 0) fail(path, "data offset is not aligned");
+    }
+
+    // Los datos que anuncia la cabecera caben en 'fileSize' bytes. Se
+    // compara por división: con productos una cabecera manipulada podría
+    // desbordar uint64 y pasar la comprobación.
+    inline void checkPayload(const std::string& path, const PointCloudHeader& h, uint64_t fileSize) {
+        if (h.dataOffset > fileSize) fail(path, "data offset past the end of the file");
+        if (h.stride == 0) fail(path, "zero stride");
+        if (h.dimension == 0) fail(path, "zero dimension");
+        const uint64_t available = fileSize - h.dataOffset;
+        if (h.layout == Layout::AoS) {
+            if (h.count > available / h.stride) fail(path, "truncated file");
+        } else {
+            if (h.laneStride < h.count) fail(path, "lane stride too small");
+            if (h.laneStride > available / h.stride / h.dimension) fail(path, "truncated file");
+        }
+    }
+
+    template <typename T, size_t N>
+    void expectType(const std::string& path, const PointCloudHeader& h, Layout layout) {
+        if (h.scalarType != scalarTypeOf<T>()) fail(path, "scalar type mismatch");
+        if (h.dimension != N) {
+            fail(path, "dimension " + std::to_string(h.dimension) + " does not match N = " + std::to_string(N));
+        }
+        if (h.layout != layout) fail(path, layout == Layout::AoS ? "file is SoA, not AoS" : "file is AoS, not SoA");
+        if (h.alignment < alignof(T)) fail(path, "alignment smaller than alignof(T)");
+    }
+
+    // Registros AoS que son exactamente V (padding incluido)
+    template <typename V>
+    void expectAoS(const std::string& path, const PointCloudHeader& h) {
+        expectType<typename V::value_type, V::static_size>(path, h, Layout::AoS);
+        if (h.stride != sizeof(V)) {
+            fail(path, "stride " + std::to_string(h.stride) + " does not match sizeof(Vector) " + std::to_string(sizeof(V)));
+        }
+    }
+
+} // namespace detail
+
+    // --- ESCRITURA ---
+
+    // AoS: los bytes de los Vector tal cual (un único write)
+    template <typename T, size_t N, typename S>
+    void writePointCloud(const std::string& path, Span<const Vector<T, N, S>> points) {
+        using V = Vector<T, N, S>;
+        const PointCloudHeader h = detail::makeHeader(scalarTypeOf<T>(), uint32_t(N), uint32_t(sizeof(V)),
+                                                      Layout::AoS, points.size(), 0);
+        std::ofstream out = detail::openForWrite(path, h);
+        out.write(reinterpret_cast<const char*>(points.data()), std::streamsize(points.size() * sizeof(V)));
+        detail::finish(out, path);
+    }
+
+    // SoA: un carril por eje, cada uno alineado a línea de caché
+    template <typename T, size_t N, typename Alloc>
+    void writePointCloud(const std::string& path, const VectorSoA<T, N, Alloc>& points) {
+        const uint64_t laneStride = detail::alignUp(points.size(), kCacheLine / sizeof(T));
+        const PointCloudHeader h = detail::makeHeader(scalarTypeOf<T>(), uint32_t(N), uint32_t(sizeof(T)),
+                                                      Layout::SoA, points.size(), laneStride);
+        std::ofstream out = detail::openForWrite(path, h);
+        const char zeros[kCacheLine] = {};
+        for (size_t k = 0; k < N; ++k) {
+            out.write(reinterpret_cast<const char*>(points.lane(k)), std::streamsize(points.size() * sizeof(T)));
+            out.write(zeros, std::streamsize((laneStride - points.size()) * sizeof(T)));
+        }
+        detail::finish(out, path);
+    }
+
+    // --- LECTURA ---
+
+    // Vista SoA de solo lectura sobre memoria ajena (p.ej. un mmap)
+    template <typename T, size_t N>
+    class SoAView {
+    public:
+        SoAView() = default;
+        SoAView(const T* base, size_t count, size_t laneStride) : base_(base), size_(count), stride_(laneStride) {}
+
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        Span<const T> lane(size_t k) const {
+            assert(k < N && "Lane index out of bounds");
+            return Span<const T>(base_ + k * stride_, size_);
+        }
+
+        Vector<T, N> get(size_t index) const {
+            assert(index < size_ && "SoAView index out of bounds");
+            Vector<T, N> v;
+            for (size_t k = 0; k < N; ++k) {
+                v.data[k] = base_[k * stride_ + index];
+            }
+            return v;
+        }
+
+    private:
+        const T* base_ = nullptr;
+        size_t size_ = 0;
+        size_t stride_ = 0;
+    };
+
+    // Archivo mapeado en memoria (solo lectura). Las páginas se cargan al
+    // tocarlas; advise() permite pedir lectura anticipada al kernel.
+    class MappedPointCloud {
+    public:
+        enum class Access { Normal, Sequential, Random, WillNeed };
+
+        explicit MappedPointCloud(const std::string& path) : path_(path) {
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) detail::fail(path, std::string("cannot open: ") + std::strerror(errno));
+
+            struct stat st {};
+            if (::fstat(fd, &st) != 0) {
+                const int err = errno;
+                ::close(fd);
+                detail::fail(path, std::string("cannot stat: ") + std::strerror(err));
+            }
+            size_ = size_t(st.st_size);
+            if (size_ < sizeof(PointCloudHeader)) {
+                ::close(fd);
+                detail::fail(path, "file too small for a header");
+            }
+
+            void* base = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            const int err = errno;
+            ::close(fd); // El mapeo sigue vivo sin el descriptor
+            if (base == MAP_FAILED) detail::fail(path, std::string("mmap failed: ") + std::strerror(err));
+            base_ = base;
+
+            try {
+                detail::validateHeader(path_, header());
+                detail::checkPayload(path_, header(), size_);
+            } catch (...) {
+                unmap();
+                throw;
+            }
+        }
+
+        ~MappedPointCloud() { unmap(); }
+
+        MappedPointCloud(MappedPointCloud&& other) noexcept
+            : path_(std::move(other.path_)),
+              base_(std::exchange(other.base_, nullptr)),
+              size_(std::exchange(other.size_, 0)) {}
+
+        MappedPointCloud& operator=(MappedPointCloud&& other) noexcept {
+            if (this != &other) {
+                unmap();
+                path_ = std::move(other.path_);
+                base_ = std::exchange(other.base_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        MappedPointCloud(const MappedPointCloud&) = delete;
+        MappedPointCloud& operator=(const MappedPointCloud&) = delete;
+
+        const PointCloudHeader& header() const { return *static_cast<const PointCloudHeader*>(base_); }
+        size_t size() const { return size_t(header().count); }
+        size_t fileSize() const { return size_; }
+
+        // Vista AoS directa. Lanza si el archivo no contiene exactamente
+        // Vector<T, N, S> (tipo, dimensión, stride, layout o alineación).
+        template <typename T, size_t N, typename S = PackedStorage>
+        Span<const Vector<T, N, S>> points() const {
+            using V = Vector<T, N, S>;
+            detail::expectAoS<V>(path_, header());
+            const char* data = bytes() + header().dataOffset;
+            if (reinterpret_cast<uintptr_t>(data) % alignof(V) != 0) {
+                detail::fail(path_, "data is not aligned for this Vector type");
+            }
+            return Span<const V>(reinterpret_cast<const V*>(data), size());
+        }
+
+        // Vista SoA directa (archivos escritos desde un VectorSoA)
+        template <typename T, size_t N>
+        SoAView<T, N> lanes() const {
+            detail::expectType<T, N>(path_, header(), Layout::SoA);
+            if (header().stride != sizeof(T)) detail::fail(path_, "SoA stride does not match sizeof(T)");
+            const char* raw = bytes() + header().dataOffset;
+            if (reinterpret_cast<uintptr_t>(raw) % alignof(T) != 0) {
+                detail::fail(path_, "data is not aligned for this scalar type");
+            }
+            const T* data = reinterpret_cast<const T*>(raw);
+            return SoAView<T, N>(data, size(), size_t(header().laneStride));
+        }
+
+        void advise(Access access) const {
+            static constexpr int kAdvice[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED};
+            ::madvise(base_, size_, kAdvice[int(access)]);
+        }
+
+    private:
+        const char* bytes() const { return static_cast<const char*>(base_); }
+
+        void unmap() noexcept {
+            if (base_) {
+                ::munmap(base_, size_);
+                base_ = nullptr;
+            }
+        }
+
+        std::string path_;
+        void* base_ = nullptr;
+        size_t size_ = 0;
+    };
+
+} // namespace io
+} // namespace TinyGeo
@@ -0,0 +1,541 @@
+#pragma once
+
+// Predicados geométricos robustos (Shewchuk, "Adaptive Precision
+// Floating-Point Arithmetic and Fast Robust Geometric Predicates").
+//
+//   orient2d(a, b, c)       > 0 si a, b, c giran en sentido antihorario
+//   orient3d(a, b, c, d)    > 0 si d está por debajo del plano de a, b, c
+//                           (a, b, c antihorario vistos desde arriba)
+//   incircle(a, b, c, d)    > 0 si d está dentro del círculo de a, b, c (ccw)
+//   insphere(a, b, c, d, e) > 0 si e está dentro de la esfera de a, b, c, d
+//                           (con orient3d(a, b, c, d) > 0)
+//
+// El signo es siempre exacto; la magnitud es una aproximación del
+// determinante. Cada predicado evalúa primero la expresión en coma flotante
+// (el mismo coste que cross / dot) y la acepta si supera la cota de error
+// de la etapa A de Shewchuk (epsilon por el permanente del determinante).
+// Si el filtro falla (entradas casi degeneradas):
+//   etapa B  determinante exacto de las diferencias ya redondeadas. Exacto
+//            si las diferencias no perdieron bits (rejillas, puntos
+//            cocirculares de coordenadas cortas); si no, vale si supera su
+//            propia cota, más estrecha
+//   etapa D  determinante exacto completo
+// La etapa C del artículo (corrección con las colas de las diferencias) no
+// está: lo que B no resuelve pasa directamente a D. Las expansiones tienen
+// capacidad fija en la pila (Expansion<Cap>), sin reservas de memoria.
+// bench_vector mide el coste por caso (Predicate/...).
+//
+// Todo se evalúa en double (float e int se convierten sin pérdida). Requiere
+// IEEE 754 con redondeo al par y sin -ffast-math; las coordenadas deben
+// estar lejos del overflow (|x| < ~1e50 para insphere).
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "TinyGeo/Instrument.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+namespace detail {
+
+    // --- 1. ARITMÉTICA DE EXPANSIONES ---
+    // Una expansión es una suma exacta de doubles que no se solapan,
+    // ordenados por magnitud creciente (el último domina el signo).
+
+    inline constexpr double kEpsilon = 1.1102230246251565e-16; // 2^-53
+    inline constexpr double kSplitter = 134217729.0;            // 2^27 + 1
+
+    // x + y == a + b exactamente (requiere |a| >= |b|)
+    inline void fastTwoSum(double a, double b, double& x, double& y) {
+        x = a + b;
+        y = b - (x - a);
+    }
+
+    inline void twoSum(double a, double b, double& x, double& y) {
+        x = a + b;
+        const double bv = x - a;
+        const double av = x - bv;
+        y = (a - av) + (b - bv);
+    }
+
+    inline void twoDiff(double a, double b, double& x, double& y) {
+        x = a - b;
+        const double bv = a - x;
+        const double av = x + bv;
+        y = (a - av) + (bv - b);
+    }
+
+    inline void split(double a, double& hi, double& lo) {
+        const double c = kSplitter * a;
+        hi = c - (c - a);
+        lo = a - hi;
+    }
+
+    // x + y == a * b exactamente (Dekker)
+    inline void twoProduct(double a, double b, double& x, double& y) {
+        x = a * b;
+        double ahi, alo, bhi, blo;
+        split(a, ahi, alo);
+        split(b, bhi, blo);
+        const double err1 = x - ahi * bhi;
+        const double err2 = err1 - alo * bhi;
+        const double err3 = err2 - ahi * blo;
+        y = alo * blo - err3;
+    }
+
+    // Tail de x = fl(a - b): a - b == x + tail exactamente
+    inline double diffTail(double a, double b, double x) {
+        const double bv = a - x;
+        const double av = x + bv;
+        return (a - av) + (bv - b);
+    }
+
+    // fast_expansion_sum_zeroelim sobre buffers crudos: h = e + f, devuelve
+    // los términos de h. h no puede solapar f; sí puede empezar f.size()
+    // posiciones antes de e (Expansion::add): cada término escrito deja
+    // libre al menos uno leído, así que nunca se pisa uno pendiente.
+    inline size_t expansionSum(const double* e, size_t en, const double* f, size_t fn, double* h) {
+        if (en == 0 || fn == 0) {
+            const double* src = en == 0 ? f : e;
+            const size_t n = en == 0 ? fn : en;
+            for (size_t i = 0; i < n; ++i) h[i] = src[i];
+            return n;
+        }
+        size_t ei = 0, fi = 0, hn = 0;
+        auto takeE = [&] {
+            // Siguiente término de menor magnitud
+            if (fi == fn) return true;
+            if (ei == en) return false;
+            const double enow = e[ei], fnow = f[fi];
+            return (fnow > enow) == (fnow > -enow);
+        };
+        double q = takeE() ? e[ei++] : f[fi++];
+        bool first = true;
+        while (ei < en || fi < fn) {
+            const double next = takeE() ? e[ei++] : f[fi++];
+            double qn, hh;
+            if (first) {
+                fastTwoSum(next, q, qn, hh);
+                first = false;
+            } else {
+                twoSum(q, next, qn, hh);
+            }
+            q = qn;
+            if (hh != 0.0) h[hn++] = hh;
+        }
+        if (q != 0.0) h[hn++] = q;
+        return hn;
+    }
+
+    // scale_expansion_zeroelim: h = e * b (hasta 2 * en términos)
+    inline size_t scaleExpansion(const double* e, size_t en, double b, double* h) {
+        if (en == 0 || b == 0.0) return 0;
+        size_t hn = 0;
+        double q, hh;
+        twoProduct(e[0], b, q, hh);
+        if (hh != 0.0) h[hn++] = hh;
+        for (size_t i = 1; i < en; ++i) {
+            double p1, p0, sum;
+            twoProduct(e[i], b, p1, p0);
+            twoSum(q, p0, sum, hh);
+            if (hh != 0.0) h[hn++] = hh;
+            fastTwoSum(p1, sum, q, hh);
+            if (hh != 0.0) h[hn++] = hh;
+        }
+        if (q != 0.0) h[hn++] = q;
+        return hn;
+    }
+
+    // Expansión de como mucho Cap términos, en la pila. Cada operador
+    // devuelve la capacidad máxima de su resultado (e + f: A + B, e * b: 2A,
+    // e * f: 2AB), así que el tamaño de cada determinante se fija en
+    // compilación y no hay reservas de memoria.
+    template <size_t Cap>
+    class Expansion {
+    public:
+        static constexpr size_t capacity = Cap;
+
+        Expansion() = default;
+
+        explicit Expansion(double v) {
+            static_assert(Cap >= 1, "Expansion needs room for one term");
+            if (v != 0.0) terms_[size_++] = v;
+        }
+
+        // a - b exacto (dos términos)
+        static Expansion difference(double a, double b) {
+            static_assert(Cap >= 2, "Expansion::difference needs two terms");
+            double x, y;
+            twoDiff(a, b, x, y);
+            Expansion e;
+            if (y != 0.0) e.terms_[e.size_++] = y;
+            if (x != 0.0) e.terms_[e.size_++] = x;
+            return e;
+        }
+
+        size_t size() const { return size_; }
+        const double* data() const { return terms_; }
+        double* data() { return terms_; }
+
+        void resize(size_t n) {
+            assert(n <= Cap && "Expansion capacity exceeded");
+            size_ = n;
+        }
+
+        // Signo exacto (-1, 0, 1)
+        int sign() const { return size_ == 0 ? 0 : (terms_[size_ - 1] > 0.0 ? 1 : -1); }
+
+        // Aproximación del valor con el signo exacto
+        double estimate() const {
+            double sum = 0.0;
+            for (size_t i = 0; i < size_; ++i) sum += terms_[i];
+            const int s = sign();
+            return (sum > 0.0 ? 1 : (sum < 0.0 ? -1 : 0)) == s ? sum : terms_[size_ - 1];
+        }
+
+        void negate() {
+            for (size_t i = 0; i < size_; ++i) terms_[i] = -terms_[i];
+        }
+
+        // *this += f sin buffer auxiliar: los términos propios se desplazan
+        // f.size() posiciones y la suma se escribe desde el principio
+        template <size_t B>
+        void add(const Expansion<B>& f) {
+            assert(size_ + f.size() <= Cap && "Expansion capacity exceeded");
+            const size_t fn = f.size();
+            for (size_t i = size_; i-- > 0;) terms_[i + fn] = terms_[i];
+            size_ = expansionSum(terms_ + fn, size_, f.data(), fn, terms_);
+        }
+
+    private:
+        double terms_[Cap];
+        size_t size_ = 0;
+    };
+
+    template <size_t A, size_t B>
+    Expansion<A + B> operator+(const Expansion<A>& e, const Expansion<B>& f) {
+        Expansion<A + B> h;
+        h.resize(expansionSum(e.data(), e.size(), f.data(), f.size(), h.data()));
+        return h;
+    }
+
+    template <size_t A>
+    Expansion<A> operator-(Expansion<A> e) {
+        e.negate();
+        return e;
+    }
+
+    template <size_t A, size_t B>
+    Expansion<A + B> operator-(const Expansion<A>& e, const Expansion<B>& f) {
+        return e + (-f);
+    }
+
+    template <size_t A>
+    Expansion<2 * A> operator*(const Expansion<A>& e, double b) {
+        Expansion<2 * A> h;
+        h.resize(scaleExpansion(e.data(), e.size(), b, h.data()));
+        return h;
+    }
+
+    // Suma de f * e_i, recorriendo el operando de menor capacidad
+    template <size_t A, size_t B>
+    Expansion<2 * A * B> operator*(const Expansion<A>& e, const Expansion<B>& f) {
+        if constexpr (A > B) {
+            return f * e;
+        } else {
+            Expansion<2 * A * B> h;
+            for (size_t i = 0; i < e.size(); ++i) h.add(f * e.data()[i]);
+            return h;
+        }
+    }
+
+    // --- 2. DETERMINANTES ---
+    // Un único cuerpo por predicado, instanciado con R = double (filtro),
+    // R = Expansion<1> (etapa B, diferencias redondeadas) y R = Expansion<2>
+    // (etapa D, diferencias exactas). Con expansiones cada subexpresión
+    // tiene su propia capacidad, de ahí los auto.
+
+    template <typename R>
+    auto orient2dDet(const R& acx, const R& acy, const R& bcx, const R& bcy) {
+        return acx * bcy - acy * bcx;
+    }
+
+    template <typename R>
+    auto orient3dDet(const R& adx, const R& ady, const R& adz, const R& bdx, const R& bdy, const R& bdz, const R& cdx,
+                     const R& cdy, const R& cdz) {
+        return adz * (bdx * cdy - cdx * bdy) + bdz * (cdx * ady - adx * cdy) + cdz * (adx * bdy - bdx * ady);
+    }
+
+    template <typename R>
+    auto incircleDet(const R& adx, const R& ady, const R& bdx, const R& bdy, const R& cdx, const R& cdy) {
+        const auto alift = adx * adx + ady * ady;
+        const auto blift = bdx * bdx + bdy * bdy;
+        const auto clift = cdx * cdx + cdy * cdy;
+        return alift * (bdx * cdy - cdx * bdy) + blift * (cdx * ady - adx * cdy) + clift * (adx * bdy - bdx * ady);
+    }
+
+    // Coordenadas relativas a e: p[3 * k + i] = coordenada i de a, b, c, d
+    template <typename R>
+    auto insphereDet(const R* p) {
+        const R& aex = p[0]; const R& aey = p[1]; const R& aez = p[2];
+        const R& bex = p[3]; const R& bey = p[4]; const R& bez = p[5];
+        const R& cex = p[6]; const R& cey = p[7]; const R& cez = p[8];
+        const R& dex = p[9]; const R& dey = p[10]; const R& dez = p[11];
+        const auto ab = aex * bey - bex * aey;
+        const auto bc = bex * cey - cex * bey;
+        const auto cd = cex * dey - dex * cey;
+        const auto da = dex * aey - aex * dey;
+        const auto ac = aex * cey - cex * aey;
+        const auto bd = bex * dey - dex * bey;
+        const auto abc = aez * bc - bez * ac + cez * ab;
+        const auto bcd = bez * cd - cez * bd + dez * bc;
+        const auto cda = cez * da + dez * ac + aez * cd;
+        const auto dab = dez * ab + aez * bd + bez * da;
+        const auto alift = aex * aex + aey * aey + aez * aez;
+        const auto blift = bex * bex + bey * bey + bez * bez;
+        const auto clift = cex * cex + cey * cey + cez * cez;
+        const auto dlift = dex * dex + dey * dey + dez * dez;
+        return (dlift * abc - clift * dab) + (blift * cda - alift * bcd);
+    }
+
+    // Etapa D de insphere sobre las coordenadas originales: el 5x5 de filas
+    // (x, y, z, |p|^2, 1), igual al 4x4 de insphereDet. Con diferencias de
+    // dos términos el 4x4 llegaría a 36864 términos; con coordenadas de uno
+    // no pasa de 5760 (~46 KB de pila, como insphereexact de Shewchuk).
+    using Coord = Expansion<1>;
+
+    inline Expansion<24> det3(const Coord* u, const Coord* v, const Coord* w) {
+        return u[0] * (v[1] * w[2] - w[1] * v[2]) - v[0] * (u[1] * w[2] - w[1] * u[2]) +
+               w[0] * (u[1] * v[2] - v[1] * u[2]);
+    }
+
+    inline Expansion<6> lift(const Coord* u) { return u[0] * u[0] + u[1] * u[1] + u[2] * u[2]; }
+
+    inline Expansion<5760> insphereExact(const double (&pts)[5][3]) {
+        Coord c[5][3];
+        for (size_t k = 0; k < 5; ++k) {
+            for (size_t i = 0; i < 3; ++i) c[k][i] = Coord(pts[k][i]);
+        }
+        // Desarrollo por la columna de unos (fila k fuera) y luego por la de
+        // |p|^2 (fila j fuera): det = sum_j lift(j) * sum_k s(j, k) * det3
+        // de las tres filas restantes. Solo hay 10 det3 distintos.
+        Expansion<24> minors[5][5];
+        for (size_t j = 0; j < 5; ++j) {
+            for (size_t k = j + 1; k < 5; ++k) {
+                const Coord* rows[3];
+                for (size_t r = 0, n = 0; r < 5; ++r) {
+                    if (r != j && r != k) rows[n++] = c[r];
+                }
+                minors[j][k] = det3(rows[0], rows[1], rows[2]);
+            }
+        }
+        Expansion<5760> det;
+        for (size_t j = 0; j < 5; ++j) {
+            Expansion<96> sum;
+            for (size_t k = 0; k < 5; ++k) {
+                if (k == j) continue;
+                Expansion<24> m = j < k ? minors[j][k] : minors[k][j];
+                // (-1)^k por la columna de unos, (-1)^(pos + 1) por la de
+                // |p|^2, con pos la posición de j entre las cuatro filas
+                const size_t pos = j < k ? j : j - 1;
+                if ((k + pos + 1) % 2 == 1) m.negate();
+                sum.add(m);
+            }
+            det.add(lift(c[j]) * sum);
+        }
+        return det;
+    }
+
+    // Cotas de la etapa A (Shewchuk): error <= bound * permanente
+    inline constexpr double kOrient2dBound = (3.0 + 16.0 * kEpsilon) * kEpsilon;
+    inline constexpr double kOrient3dBound = (7.0 + 56.0 * kEpsilon) * kEpsilon;
+    inline constexpr double kIncircleBound = (10.0 + 96.0 * kEpsilon) * kEpsilon;
+    inline constexpr double kInsphereBound = (16.0 + 224.0 * kEpsilon) * kEpsilon;
+
+    // Cotas de la etapa B, sobre el mismo permanente
+    inline constexpr double kOrient2dBoundB = (2.0 + 12.0 * kEpsilon) * kEpsilon;
+    inline constexpr double kOrient3dBoundB = (3.0 + 28.0 * kEpsilon) * kEpsilon;
+    inline constexpr double kIncircleBoundB = (4.0 + 48.0 * kEpsilon) * kEpsilon;
+    inline constexpr double kInsphereBoundB = (5.0 + 72.0 * kEpsilon) * kEpsilon;
+
+    // Etapa B: el determinante exacto de las diferencias ya redondeadas
+    // (d[i] = fl(lhs[i] - rhs[i]), un término cada una). Es el resultado
+    // exacto si ninguna diferencia perdió bits, lo habitual en entradas en
+    // rejilla o con pocos bits; si no, vale cuando supera boundB. Devuelve
+    // false si hay que pasar a la etapa D.
+    template <size_t K, typename Det>
+    bool stageB(const double (&lhs)[K], const double (&rhs)[K], double boundB, Det&& det, double& result) {
+        Expansion<1> d[K];
+        bool exact = true;
+        for (size_t i = 0; i < K; ++i) {
+            const double x = lhs[i] - rhs[i];
+            exact &= diffTail(lhs[i], rhs[i], x) == 0.0;
+            d[i] = Expansion<1>(x);
+        }
+        result = det(d).estimate();
+        return exact || result >= boundB || -result >= boundB;
+    }
+
+    // Etapa D: el mismo determinante sobre las diferencias exactas
+    template <size_t K, typename Det>
+    double stageD(const double (&lhs)[K], const double (&rhs)[K], Det&& det) {
+        Expansion<2> d[K];
+        for (size_t i = 0; i < K; ++i) d[i] = Expansion<2>::difference(lhs[i], rhs[i]);
+        return det(d).estimate();
+    }
+
+    template <typename V>
+    double coord(const V& v, size_t i) {
+        static_assert(std::is_arithmetic_v<typename VectorTraits<V>::scalar_type>, "Predicates need arithmetic T");
+        return double(v.data[i]);
+    }
+
+} // namespace detail
+
+    // --- 3. PREDICADOS ---
+
+    template <typename T, typename S>
+    double orient2d(const Vector<T, 2, S>& a, const Vector<T, 2, S>& b, const Vector<T, 2, S>& c) {
+        using detail::coord;
+        const double ax = coord(a, 0), ay = coord(a, 1);
+        const double bx = coord(b, 0), by = coord(b, 1);
+        const double cx = coord(c, 0), cy = coord(c, 1);
+
+        const double left = (ax - cx) * (by - cy);
+        const double right = (ay - cy) * (bx - cx);
+        const double det = left - right;
+        // Signos opuestos (o cero): la resta no cancela y det es correcto
+        if ((left > 0.0 && right <= 0.0) || (left < 0.0 && right >= 0.0) || left == 0.0) return det;
+        const double permanent = std::abs(left + right);
+        const double bound = detail::kOrient2dBound * permanent;
+        if (det >= bound || -det >= bound) return det;
+
+        TINYGEO_COUNT(PredicateExact);
+        const double lhs[4] = {ax, ay, bx, by}, rhs[4] = {cx, cy, cx, cy};
+        auto body = [](const auto& d) { return detail::orient2dDet(d[0], d[1], d[2], d[3]); };
+        double result;
+        if (detail::stageB(lhs, rhs, detail::kOrient2dBoundB * permanent, body, result)) return result;
+        TINYGEO_COUNT(PredicateExactFull);
+        return detail::stageD(lhs, rhs, body);
+    }
+
+    template <typename T, typename S>
+    double orient3d(const Vector<T, 3, S>& a, const Vector<T, 3, S>& b, const Vector<T, 3, S>& c,
+                    const Vector<T, 3, S>& d) {
+        using detail::coord;
+        double ad[3], bd[3], cd[3];
+        for (size_t i = 0; i < 3; ++i) {
+            ad[i] = coord(a, i) - coord(d, i);
+            bd[i] = coord(b, i) - coord(d, i);
+            cd[i] = coord(c, i) - coord(d, i);
+        }
+        const double bdxcdy = bd[0] * cd[1], cdxbdy = cd[0] * bd[1];
+        const double cdxady = cd[0] * ad[1], adxcdy = ad[0] * cd[1];
+        const double adxbdy = ad[0] * bd[1], bdxady = bd[0] * ad[1];
+        const double det = ad[2] * (bdxcdy - cdxbdy) + bd[2] * (cdxady - adxcdy) + cd[2] * (adxbdy - bdxady);
+        const double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * std::abs(ad[2]) +
+                                 (std::abs(cdxady) + std::abs(adxcdy)) * std::abs(bd[2]) +
+                                 (std::abs(adxbdy) + std::abs(bdxady)) * std::abs(cd[2]);
+        const double bound = detail::kOrient3dBound * permanent;
+        if (det > bound || -det > bound) return det;
+
+        TINYGEO_COUNT(PredicateExact);
+        double lhs[9], rhs[9];
+        for (size_t i = 0; i < 3; ++i) {
+            lhs[i] = coord(a, i);
+            lhs[3 + i] = coord(b, i);
+            lhs[6 + i] = coord(c, i);
+            rhs[i] = rhs[3 + i] = rhs[6 + i] = coord(d, i);
+        }
+        auto body = [](const auto& e) {
+            return detail::orient3dDet(e[0], e[1], e[2], e[3], e[4], e[5], e[6], e[7], e[8]);
+        };
+        double result;
+        if (detail::stageB(lhs, rhs, detail::kOrient3dBoundB * permanent, body, result)) return result;
+        TINYGEO_COUNT(PredicateExactFull);
+        return detail::stageD(lhs, rhs, body);
+    }
+
+    template <typename T, typename S>
+    double incircle(const Vector<T, 2, S>& a, const Vector<T, 2, S>& b, const Vector<T, 2, S>& c,
+                    const Vector<T, 2, S>& d) {
+        using detail::coord;
+        const double adx = coord(a, 0) - coord(d, 0), ady = coord(a, 1) - coord(d, 1);
+        const double bdx = coord(b, 0) - coord(d, 0), bdy = coord(b, 1) - coord(d, 1);
+        const double cdx = coord(c, 0) - coord(d, 0), cdy = coord(c, 1) - coord(d, 1);
+
+        const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+        const double cdxady = cdx * ady, adxcdy = adx * cdy;
+        const double adxbdy = adx * bdy, bdxady = bdx * ady;
+        const double alift = adx * adx + ady * ady;
+        const double blift = bdx * bdx + bdy * bdy;
+        const double clift = cdx * cdx + cdy * cdy;
+        const double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+        const double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * alift +
+                                 (std::abs(cdxady) + std::abs(adxcdy)) * blift +
+                                 (std::abs(adxbdy) + std::abs(bdxady)) * clift;
+        const double bound = detail::kIncircleBound * permanent;
+        if (det > bound || -det > bound) return det;
+
+        TINYGEO_COUNT(PredicateExact);
+        const double lhs[6] = {coord(a, 0), coord(a, 1), coord(b, 0), coord(b, 1), coord(c, 0), coord(c, 1)};
+        const double rhs[6] = {coord(d, 0), coord(d, 1), coord(d, 0), coord(d, 1), coord(d, 0), coord(d, 1)};
+        auto body = [](const auto& e) { return detail::incircleDet(e[0], e[1], e[2], e[3], e[4], e[5]); };
+        double result;
+        if (detail::stageB(lhs, rhs, detail::kIncircleBoundB * permanent, body, result)) return result;
+        TINYGEO_COUNT(PredicateExactFull);
+        return detail::stageD(lhs, rhs, body);
+    }
+
+    template <typename T, typename S>
+    double insphere(const Vector<T, 3, S>& a, const Vector<T, 3, S>& b, const Vector<T, 3, S>& c,
+                    const Vector<T, 3, S>& d, const Vector<T, 3, S>& e) {
+        using detail::coord;
+        const Vector<T, 3, S>* pts[5] = {&a, &b, &c, &d, &e};
+        double p[12];
+        for (size_t k = 0; k < 4; ++k) {
+            for (size_t i = 0; i < 3; ++i) p[3 * k + i] = coord(*pts[k], i) - coord(e, i);
+        }
+        const double det = detail::insphereDet(p);
+
+        // Permanente: el mismo desarrollo con todos los productos en valor absoluto
+        double q[4][3];
+        for (size_t k = 0; k < 4; ++k) {
+            for (size_t i = 0; i < 3; ++i) q[k][i] = std::abs(p[3 * k + i]);
+        }
+        auto pair = [&](size_t u, size_t v) { return q[u][0] * q[v][1] + q[v][0] * q[u][1]; };
+        const double ab = pair(0, 1), bc = pair(1, 2), cd = pair(2, 3);
+        const double da = pair(3, 0), ac = pair(0, 2), bd = pair(1, 3);
+        const double abc = q[0][2] * bc + q[1][2] * ac + q[2][2] * ab;
+        const double bcd = q[1][2] * cd + q[2][2] * bd + q[3][2] * bc;
+        const double cda = q[2][2] * da + q[3][2] * ac + q[0][2] * cd;
+        const double dab = q[3][2] * ab + q[0][2] * bd + q[1][2] * da;
+        auto lift = [&](size_t k) { return q[k][0] * q[k][0] + q[k][1] * q[k][1] + q[k][2] * q[k][2]; };
+        const double permanent = lift(3) * abc + lift(2) * dab + lift(1) * cda + lift(0) * bcd;
+        const double bound = detail::kInsphereBound * permanent;
+        if (det > bound || -det > bound) return det;
+
+        TINYGEO_COUNT(PredicateExact);
+        double lhs[12], rhs[12];
+        for (size_t k = 0; k < 4; ++k) {
+            for (size_t i = 0; i < 3; ++i) {
+                lhs[3 * k + i] = coord(*pts[k], i);
+                rhs[3 * k + i] = coord(e, i);
+            }
+        }
+        double result;
+        if (detail::stageB(lhs, rhs, detail::kInsphereBoundB * permanent,
+                           [](const auto& x) { return detail::insphereDet(x); }, result)) {
+            return result;
+        }
+        TINYGEO_COUNT(PredicateExactFull);
+        double raw[5][3];
+        for (size_t k = 0; k < 5; ++k) {
+            for (size_t i = 0; i < 3; ++i) raw[k][i] = coord(*pts[k], i);
+        }
+        return detail::insphereExact(raw).estimate();
+    }
+
+} // namespace TinyGeo
@@ -0,0 +1,339 @@
+#pragma once
+
+// Formatos compactos para almacenamiento y transporte.
+//
+//   Half (binary16):      float -> 16 bits. Redondeo al par más cercano;
+//                         error relativo <= 2^-11 (~4.9e-4) en [6.1e-5, 65504];
+//                         por debajo, denormales con error absoluto <= 2^-25.
+//                         Fuera de rango satura a +-inf. Con F16C (-mf16c,
+//                         implícito en TINYGEO_SIMD=AVX2) los lotes usan
+//                         vcvtps2ph / vcvtph2ps, con el mismo resultado bit a bit.
+//   OctNormal (2 x 16):   normal unitaria en proyección octaédrica con dos
+//                         snorm16 (4 bytes frente a 12/16). Error angular
+//                         máximo < 0.005 grados (~8.7e-5 rad).
+//   PositionQuantizer:    posiciones relativas a un AABB con Bits por eje.
+//                         Error por eje <= extent / (2 (2^Bits - 1)) (ver
+//                         maxError()) más el redondeo de T en la conversión
+//                         (pocos ulp de la coordenada y del código). Con
+//                         N * Bits <= 32 el código se empaqueta en un
+//                         uint32_t (3 x 10 bits: 4 bytes); si no, un uint16_t
+//                         por eje (3 x 16 bits: 6 bytes).
+//
+// Los kernels batch:: son loops sin dependencias entre elementos ni ramas en
+// el cuerpo, pensados para que el compilador vectorice entre elementos.
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "TinyGeo/AABB.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+
+#if defined(__F16C__) && !defined(TINYGEO_FORCE_SCALAR)
+    #include <immintrin.h>
+    #define TINYGEO_HAS_F16C 1
+#else
+    #define TINYGEO_HAS_F16C 0
+#endif
+
+namespace TinyGeo {
+namespace detail {
+
+    inline uint32_t floatBits(float f) {
+        uint32_t u;
+        std::memcpy(&u, &f, sizeof(u));
+        return u;
+    }
+
+    inline float bitsFloat(uint32_t u) {
+        float f;
+        std::memcpy(&f, &u, sizeof(f));
+        return f;
+    }
+
+} // namespace detail
+
+    // --- 1. HALF FLOAT ---
+
+    // float -> binary16 con redondeo al par (RNE). NaN se conserva como NaN.
+    inline uint16_t toHalf(float value) {
+        constexpr uint32_t kInf32 = 255u << 23;
+        constexpr uint32_t kHalfOverflow = (127u + 16u) << 23; // 2^16: fuera de rango
+        constexpr uint32_t kHalfMinNormal = 113u << 23;        // 2^-14
+        constexpr uint32_t kDenormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        uint32_t u = detail::floatBits(value);
+        const uint32_t sign = u & 0x80000000u;
+        u ^= sign;
+
+        uint32_t h;
+        if (u >= kHalfOverflow) {
+            h = u > kInf32 ? 0x7e00u : 0x7c00u;
+        } else if (u < kHalfMinNormal) {
+            // Denormal o cero: la suma alinea la mantisa y la FPU redondea
+            const float f = detail::bitsFloat(u) + detail::bitsFloat(kDenormMagic);
+            h = detail::floatBits(f) - kDenormMagic;
+        } else {
+            // Re-sesgo del exponente + redondeo al par de los 13 bits perdidos
+            const uint32_t odd = (u >> 13) & 1u;
+            u += (uint32_t(15 - 127) << 23) + 0xfffu + odd;
+            h = u >> 13;
+        }
+        return uint16_t(h | (sign >> 16));
+    }
+
+    // binary16 -> float (exacto)
+    inline float fromHalf(uint16_t half) {
+        constexpr uint32_t kMagic = (254u - 15u) << 23;
+        constexpr uint32_t kWasInfNan = (127u + 16u) << 23;
+
+        uint32_t u = uint32_t(half & 0x7fffu) << 13;
+        float f = detail::bitsFloat(u) * detail::bitsFloat(kMagic);
+        u = detail::floatBits(f);
+        if (f >= detail::bitsFloat(kWasInfNan)) u |= 255u << 23;
+        u |= uint32_t(half & 0x8000u) << 16;
+        return detail::bitsFloat(u);
+    }
+
+    // --- 2. NORMALES OCTAÉDRICAS ---
+
+    // Dos snorm16 en [-32767, 32767] sobre el octaedro desplegado
+    struct OctNormal {
+        int16_t x;
+        int16_t y;
+    };
+
+    static_assert(sizeof(OctNormal) == 4, "OctNormal must pack into 4 bytes");
+
+namespace detail {
+
+    inline constexpr float kSnorm16 = 32767.0f;
+
+    // Signo sin cero: la proyección pliega ambos semiplanos por igual
+    template <typename T>
+    inline T signNotZero(T v) {
+        return v >= T(0) ? T(1) : T(-1);
+    }
+
+    inline int16_t toSnorm16(float v) {
+        v = v < -1.0f ? -1.0f : (v > 1.0f ? 1.0f : v);
+        return int16_t(std::lrint(v * kSnorm16));
+    }
+
+    // n (no necesariamente unitaria, no nula) -> OctNormal
+    template <typename T>
+    inline OctNormal encodeOct(T nx, T ny, T nz) {
+        const T inv = T(1) / (std::abs(nx) + std::abs(ny) + std::abs(nz));
+        T px = nx * inv;
+        T py = ny * inv;
+        // Hemisferio inferior: se pliega sobre las esquinas del rombo
+        const T fx = (T(1) - std::abs(py)) * signNotZero(px);
+        const T fy = (T(1) - std::abs(px)) * signNotZero(py);
+        const bool lower = nz < T(0);
+        px = lower ? fx : px;
+        py = lower ? fy : py;
+        return {toSnorm16(float(px)), toSnorm16(float(py))};
+    }
+
+    template <typename T>
+    inline void decodeOct(OctNormal o, T& nx, T& ny, T& nz) {
+        T x = T(o.x) / T(kSnorm16);
+        T y = T(o.y) / T(kSnorm16);
+        const T z = T(1) - std::abs(x) - std::abs(y);
+        const T t = z < T(0) ? -z : T(0);
+        x += x >= T(0) ? -t : t;
+        y += y >= T(0) ? -t : t;
+        const T inv = T(1) / std::sqrt(x * x + y * y + z * z);
+        nx = x * inv;
+        ny = y * inv;
+        nz = z * inv;
+    }
+
+} // namespace detail
+
+    template <typename T, typename S>
+    OctNormal encodeOctahedral(const Vector<T, 3, S>& n) {
+        return detail::encodeOct(n.data[0], n.data[1], n.data[2]);
+    }
+
+    // Normal unitaria decodificada
+    template <typename T = float>
+    Vector<T, 3> decodeOctahedral(OctNormal o) {
+        Vector<T, 3> n;
+        detail::decodeOct(o, n.data[0], n.data[1], n.data[2]);
+        return n;
+    }
+
+    // --- 3. POSICIONES CUANTIZADAS ---
+
+    // Cuantización uniforme de Bits por eje dentro de 'box'. Los puntos
+    // fuera de la caja se saturan a su borde.
+    template <typename T, size_t N, unsigned Bits>
+    class PositionQuantizer {
+    public:
+        static_assert(Bits >= 1 && Bits <= 16, "PositionQuantizer supports 1 to 16 bits per axis");
+        static_assert(std::is_floating_point_v<T>, "PositionQuantizer requires a floating-point Vector");
+
+        static constexpr bool kPacked = N * Bits <= 32;
+        static constexpr uint32_t kMaxCode = (uint32_t(1) << Bits) - 1;
+
+        // Un uint32_t empaquetado (eje 0 en los bits bajos) o un uint16_t por eje
+        using Code = std::conditional_t<kPacked, uint32_t, std::array<uint16_t, N>>;
+
+        explicit PositionQuantizer(const AABB<T, N>& box) : box_(box) {
+            assert(!box.isEmpty() && "PositionQuantizer requires a non-empty box");
+            for (size_t i = 0; i < N; ++i) {
+                const T extent = box.hi.data[i] - box.lo.data[i];
+                // Eje degenerado: todo cae en el código 0 y se decodifica a lo
+                scale_[i] = extent > T(0) ? T(kMaxCode) / extent : T(0);
+                step_[i] = extent / T(kMaxCode);
+            }
+        }
+
+        const AABB<T, N>& bounds() const { return box_; }
+
+        // Cota del error de reconstrucción por eje (medio paso de cuantización)
+        Vector<T, N> maxError() const {
+            Vector<T, N> e;
+            for (size_t i = 0; i < N; ++i) e.data[i] = step_[i] * T(0.5);
+            return e;
+        }
+
+        template <typename S>
+        Code encode(const Vector<T, N, S>& p) const {
+            Code c{};
+            for (size_t i = 0; i < N; ++i) {
+                const uint32_t q = quantize(p.data[i], i);
+                if constexpr (kPacked) {
+                    c |= q << (i * Bits);
+                } else {
+                    c[i] = uint16_t(q);
+                }
+            }
+            return c;
+        }
+
+        Vector<T, N> decode(const Code& c) const {
+            Vector<T, N> p;
+            for (size_t i = 0; i < N; ++i) {
+                p.data[i] = box_.lo.data[i] + T(component(c, i)) * step_[i];
+            }
+            return p;
+        }
+
+        // Código entero del eje i
+        static uint32_t component(const Code& c, size_t i) {
+            if constexpr (kPacked) {
+                return (c >> (i * Bits)) & kMaxCode;
+            } else {
+                return c[i];
+            }
+        }
+
+    private:
+        // Redondeo al más cercano con saturación (sin ramas: min/max)
+        uint32_t quantize(T v, size_t i) const {
+            T t = (v - box_.lo.data[i]) * scale_[i] + T(0.5);
+            t = t < T(0) ? T(0) : t;
+            t = t > T(kMaxCode) ? T(kMaxCode) : t;
+            return uint32_t(t);
+        }
+
+        AABB<T, N> box_;
+        T scale_[N];
+        T step_[N];
+    };
+
+    // 3 x 10 bits en un uint32_t (4 bytes) y 3 x 16 bits (6 bytes)
+    using PositionQuantizer10 = PositionQuantizer<float, 3, 10>;
+    using PositionQuantizer16 = PositionQuantizer<float, 3, 16>;
+
+namespace batch {
+
+    // --- 4. KERNELS POR LOTES ---
+
+    // out[i] = toHalf(in[i])
+    inline void toHalf(Span<const float> in, Span<uint16_t> out) {
+        assert(in.size() == out.size() && "Batch size mismatch");
+        const float* pi = in.data();
+        uint16_t* po = out.data();
+        const size_t n = in.size();
+        size_t i = 0;
+#if TINYGEO_HAS_F16C
+        for (; i + 8 <= n; i += 8) {
+            const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(pi + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(po + i), h);
+        }
+#endif
+        for (; i < n; ++i) po[i] = TinyGeo::toHalf(pi[i]);
+    }
+
+    // out[i] = fromHalf(in[i])
+    inline void fromHalf(Span<const uint16_t> in, Span<float> out) {
+        assert(in.size() == out.size() && "Batch size mismatch");
+        const uint16_t* pi = in.data();
+        float* po = out.data();
+        const size_t n = in.size();
+        size_t i = 0;
+#if TINYGEO_HAS_F16C
+        for (; i + 8 <= n; i += 8) {
+            const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pi + i));
+            _mm256_storeu_ps(po + i, _mm256_cvtph_ps(h));
+        }
+#endif
+        for (; i < n; ++i) po[i] = TinyGeo::fromHalf(pi[i]);
+    }
+
+    template <typename VI>
+    void encodeOctahedral(Span<VI> normals, Span<OctNormal> out) {
+        using V = std::remove_const_t<VI>;
+        static_assert(VectorTraits<V>::size == 3, "Octahedral encoding requires 3D normals");
+        assert(normals.size() == out.size() && "Batch size mismatch");
+        const VI* pi = normals.data();
+        OctNormal* po = out.data();
+        const size_t n = normals.size();
+        for (size_t i = 0; i < n; ++i) {
+            po[i] = detail::encodeOct(pi[i].data[0], pi[i].data[1], pi[i].data[2]);
+        }
+    }
+
+    template <typename T, typename S>
+    void decodeOctahedral(Span<const OctNormal> in, Span<Vector<T, 3, S>> normals) {
+        assert(in.size() == normals.size() && "Batch size mismatch");
+        const OctNormal* pi = in.data();
+        Vector<T, 3, S>* po = normals.data();
+        const size_t n = in.size();
+        for (size_t i = 0; i < n; ++i) {
+            detail::decodeOct(pi[i], po[i].data[0], po[i].data[1], po[i].data[2]);
+        }
+    }
+
+    template <typename T, size_t N, unsigned Bits, typename VI>
+    void encode(const PositionQuantizer<T, N, Bits>& quantizer, Span<VI> points,
+                Span<typename PositionQuantizer<T, N, Bits>::Code> out) {
+        static_assert(std::is_same_v<typename VectorTraits<std::remove_const_t<VI>>::scalar_type, T>,
+                      "Point scalar type mismatch");
+        assert(points.size() == out.size() && "Batch size mismatch");
+        const VI* pi = points.data();
+        auto* po = out.data();
+        const size_t n = points.size();
+        for (size_t i = 0; i < n; ++i) po[i] = quantizer.encode(pi[i]);
+    }
+
+    template <typename T, size_t N, unsigned Bits, typename VO>
+    void decode(const PositionQuantizer<T, N, Bits>& quantizer,
+                Span<const typename PositionQuantizer<T, N, Bits>::Code> in, Span<VO> points) {
+        assert(in.size() == points.size() && "Batch size mismatch");
+        const auto* pi = in.data();
+        VO* po = points.data();
+        const size_t n = in.size();
+        for (size_t i = 0; i < n; ++i) po[i] = quantizer.decode(pi[i]);
+    }
+
+} // namespace batch
+} // namespace TinyGeo
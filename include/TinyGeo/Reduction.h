@@ -0,0 +1,210 @@
+#pragma once
+
+// Reducciones (dot, normSq, sum) con política de precisión explícita.
+//
+//   reduction::naive     un acumulador en T: el loop clásico. Error O(n eps).
+//   reduction::widened   productos y suma en double (float -> double; double
+//                        se queda en double). Devuelve el tipo ancho.
+//   reduction::pairwise  bloques de kPairwiseBlock con 8 acumuladores,
+//                        combinados en árbol: error O(log n eps) en T.
+//   reduction::kahan     suma compensada en 32 carriles independientes:
+//                        error O(eps) casi independiente de n, en T.
+//
+//   float d = dot(reduction::pairwise, a, b);    // Vector o DynVector
+//   double w = normSq(reduction::widened, v);
+//   float s = reduction::sum(reduction::kahan, Span<const float>(xs));
+//
+// Todos (salvo naive) reparten la suma en carriles independientes, así que
+// se vectorizan sin -ffast-math: pairwise y kahan procesan 8 float por
+// registro AVX, widened solo 4 double. En float, pairwise cuesta lo mismo
+// que el dot por bloques de detail::dotBlocked y kahan unas 4 operaciones
+// por elemento; ambos son más rápidos que promocionar a double (casos
+// ReductionDot / ReductionSum de bench/bench_vector.cpp).
+
+#include <cstddef>
+#include <type_traits>
+
+#include "TinyGeo/DynVector.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+#include "TinyGeo/detail/Kernels.h"
+
+namespace TinyGeo {
+namespace reduction {
+
+    struct NaivePolicy {};
+    struct WidenedPolicy {};
+    struct PairwisePolicy {};
+    struct KahanPolicy {};
+
+    inline constexpr NaivePolicy naive{};
+    inline constexpr WidenedPolicy widened{};
+    inline constexpr PairwisePolicy pairwise{};
+    inline constexpr KahanPolicy kahan{};
+
+    // Tipo que devuelve una reducción de T con la política P
+    template <typename P, typename T>
+    using Result = std::conditional_t<std::is_same_v<P, WidenedPolicy> && std::is_same_v<T, float>, double, T>;
+
+namespace detail {
+
+    using TinyGeo::detail::kDotAccumulators;
+
+    // Hojas de la reducción pairwise: lo bastante grandes para amortizar la
+    // combinación, lo bastante pequeñas para que el error por hoja sea bajo.
+    inline constexpr size_t kPairwiseBlock = 256;
+
+    // Cada paso de Kahan son 4 sumas dependientes: con 32 carriles (4
+    // registros AVX de float) hay trabajo independiente que cubre la latencia.
+    inline constexpr size_t kKahanLanes = 32;
+
+    template <typename P>
+    inline constexpr bool isPolicy = std::is_same_v<P, NaivePolicy> || std::is_same_v<P, WidenedPolicy> ||
+                                     std::is_same_v<P, PairwisePolicy> || std::is_same_v<P, KahanPolicy>;
+
+    // term(i): el i-ésimo sumando (a[i] * b[i] para dot, a[i] para sum),
+    // ya convertido al tipo acumulador Acc.
+    template <typename Acc, typename Term>
+    constexpr Acc accumulateLanes(size_t n, Term&& term) {
+        Acc acc[kDotAccumulators] = {};
+        size_t i = 0;
+        for (; i + kDotAccumulators <= n; i += kDotAccumulators) {
+            for (size_t k = 0; k < kDotAccumulators; ++k) {
+                acc[k] += term(i + k);
+            }
+        }
+        for (size_t k = 0; k < kDotAccumulators && i + k < n; ++k) {
+            acc[k] += term(i + k);
+        }
+        for (size_t width = kDotAccumulators / 2; width > 0; width /= 2) {
+            for (size_t k = 0; k < width; ++k) {
+                acc[k] += acc[k + width];
+            }
+        }
+        return acc[0];
+    }
+
+    // [first, last) partido por la mitad (en múltiplos de bloque) hasta
+    // llegar a hojas de kPairwiseBlock
+    template <typename T, typename Term>
+    constexpr T pairwise(size_t first, size_t last, Term&& term) {
+        const size_t n = last - first;
+        if (n <= kPairwiseBlock) {
+            return accumulateLanes<T>(n, [&](size_t i) { return term(first + i); });
+        }
+        const size_t half = ((n / kPairwiseBlock + 1) / 2) * kPairwiseBlock;
+        return pairwise<T>(first, first + half, term) + pairwise<T>(first + half, last, term);
+    }
+
+    // Kahan por carril: cada uno arrastra su término de compensación.
+    // Las sumas finales de los carriles se combinan también compensadas
+    // (Neumaier).
+    template <typename T, typename Term>
+    constexpr T kahan(size_t n, Term&& term) {
+        T sum[kKahanLanes] = {};
+        T comp[kKahanLanes] = {};
+        size_t i = 0;
+        for (; i + kKahanLanes <= n; i += kKahanLanes) {
+            for (size_t k = 0; k < kKahanLanes; ++k) {
+                const T y = T(term(i + k)) - comp[k];
+                const T t = sum[k] + y;
+                comp[k] = (t - sum[k]) - y;
+                sum[k] = t;
+            }
+        }
+        for (size_t k = 0; k < kKahanLanes && i + k < n; ++k) {
+            const T y = T(term(i + k)) - comp[k];
+            const T t = sum[k] + y;
+            comp[k] = (t - sum[k]) - y;
+            sum[k] = t;
+        }
+
+        T total = T(0);
+        T c = T(0);
+        for (size_t k = 0; k < kKahanLanes; ++k) {
+            const T x = sum[k] - comp[k];
+            const T t = total + x;
+            const T ax = x < T(0) ? -x : x;
+            const T at = total < T(0) ? -total : total;
+            c += at >= ax ? (total - t) + x : (x - t) + total;
+            total = t;
+        }
+        return total + c;
+    }
+
+    template <typename P, typename T, typename Term>
+    constexpr Result<P, T> reduce(P, size_t n, Term&& term) {
+        static_assert(isPolicy<P>, "Unknown reduction policy");
+        if constexpr (std::is_same_v<P, NaivePolicy>) {
+            T sum = T(0);
+            for (size_t i = 0; i < n; ++i) {
+                sum += term(i);
+            }
+            return sum;
+        } else if constexpr (std::is_same_v<P, WidenedPolicy>) {
+            using W = Result<P, T>;
+            return accumulateLanes<W>(n, [&](size_t i) { return W(term(i)); });
+        } else if constexpr (std::is_same_v<P, PairwisePolicy>) {
+            return pairwise<T>(0, n, term);
+        } else {
+            return kahan<T>(n, term);
+        }
+    }
+
+} // namespace detail
+
+    // --- 1. KERNELS SOBRE ARRAYS ---
+
+    // a . b sobre n escalares
+    template <typename P, typename T>
+    constexpr Result<P, T> dot(P policy, const T* a, const T* b, size_t n) {
+        if constexpr (std::is_same_v<P, WidenedPolicy>) {
+            // Producto ya en el tipo ancho: el redondeo de a * b también se evita
+            using W = Result<P, T>;
+            return detail::accumulateLanes<W>(n, [&](size_t i) { return W(a[i]) * W(b[i]); });
+        } else {
+            return detail::reduce<P, T>(policy, n, [&](size_t i) { return a[i] * b[i]; });
+        }
+    }
+
+    // Suma de n escalares
+    template <typename P, typename T>
+    constexpr Result<P, T> sum(P policy, const T* a, size_t n) {
+        return detail::reduce<P, T>(policy, n, [&](size_t i) { return a[i]; });
+    }
+
+    template <typename P, typename T>
+    constexpr Result<P, std::remove_const_t<T>> sum(P policy, Span<T> values) {
+        return sum(policy, static_cast<const std::remove_const_t<T>*>(values.data()), values.size());
+    }
+
+} // namespace reduction
+
+    // --- 2. VECTOR / DYNVECTOR ---
+    // Los carriles de padding valen cero: se recorren todos sin coste extra
+    // de corrección.
+
+    template <typename P, typename T, size_t N, typename S,
+              typename = std::enable_if_t<reduction::detail::isPolicy<P>>>
+    constexpr reduction::Result<P, T> dot(P policy, const Vector<T, N, S>& a, const Vector<T, N, S>& b) {
+        return reduction::dot(policy, a.data.data(), b.data.data(), a.data.size());
+    }
+
+    template <typename P, typename T, size_t N, typename S,
+              typename = std::enable_if_t<reduction::detail::isPolicy<P>>>
+    constexpr reduction::Result<P, T> normSq(P policy, const Vector<T, N, S>& v) {
+        return dot(policy, v, v);
+    }
+
+    template <typename P, typename T, typename A, typename = std::enable_if_t<reduction::detail::isPolicy<P>>>
+    reduction::Result<P, T> dot(P policy, const DynVector<T, A>& a, const DynVector<T, A>& b) {
+        assert(a.size() == b.size() && "DynVector size mismatch");
+        return reduction::dot(policy, a.data(), b.data(), a.size());
+    }
+
+    template <typename P, typename T, typename A, typename = std::enable_if_t<reduction::detail::isPolicy<P>>>
+    reduction::Result<P, T> normSq(P policy, const DynVector<T, A>& v) {
+        return dot(policy, v, v);
+    }
+
+} // namespace TinyGeo
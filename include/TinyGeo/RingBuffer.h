@@ -0,0 +1,252 @@
+#pragma once
+
+// Cola circular acotada sin mutex para varios productores y varios
+// consumidores (MPMC; con un solo consumidor es MPSC sin coste extra),
+// pensada para ingesta de muestras Vector en lotes.
+//
+//   RingBuffer<Vector<float, 3>> ring(1 << 16);
+//
+//   // Productor: reserva un rango, escribe en él y lo publica
+//   auto w = ring.reserve(batch.size());
+//   w.copyFrom(Span<const V>(batch));   // o escribir en w.first / w.second
+//   ring.commit(w);
+//
+//   // Consumidor: vista sin copia de lo publicado
+//   auto r = ring.acquire(4096);
+//   batch::normalize(r.first, out...); // Span<const V>, directo a batch::
+//   batch::normalize(r.second, ...);
+//   ring.release(r);
+//
+// Un rango puede cruzar el final del almacenamiento: por eso reservas y
+// vistas son dos Span (second vacío si no hay vuelta).
+//
+// Cuatro cursores de 64 bits que solo crecen, cada uno en su línea de caché:
+//   head_ (reservado) >= committed_ (publicado) >= read_ (tomado) >= tail_ (liberado)
+// Reservar y tomar son un CAS sobre head_ / read_. Publicar y liberar se
+// hacen en orden de reserva: commit() espera a que las reservas anteriores
+// se publiquen (igual release()). Una reserva pendiente retrasa por tanto
+// la publicación de las posteriores, pero nunca bloquea a los consumidores
+// ni las reservas de otros productores mientras haya espacio.
+//
+// Requisito de progreso: toda reserva no vacía debe terminar en commit()
+// (y toda vista no vacía en release()), también en caminos de error. Una
+// reserva abandonada deja committed_ parado para siempre: los commit()
+// posteriores esperan indefinidamente y, al llenarse la cola, también
+// reserve(). Si un productor puede fallar tras reservar, que publique la
+// reserva igualmente (con datos marcados como inválidos).
+//
+// Reservas de más de capacity() elementos nunca cabrían: tryReserve() y
+// reserve() devuelven una reserva vacía en lugar de esperar; push() trocea
+// la entrada en reservas de a lo sumo capacity().
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "TinyGeo/AlignedAllocator.h"
+#include "TinyGeo/Span.h"
+
+namespace TinyGeo {
+
+    template <typename V>
+    class RingBuffer {
+        static_assert(std::is_trivially_copyable_v<V>, "RingBuffer requires trivially copyable elements");
+
+    public:
+        using value_type = V;
+
+        // Rango de la cola: [begin, begin + size()) en cursores absolutos,
+        // repartido en dos trozos contiguos del almacenamiento.
+        template <typename E>
+        struct Range {
+            Span<E> first;
+            Span<E> second;
+            uint64_t begin = 0;
+
+            size_t size() const { return first.size() + second.size(); }
+            bool empty() const { return size() == 0; }
+
+            E& operator[](size_t i) const {
+                assert(i < size() && "Range index out of bounds");
+                return i < first.size() ? first[i] : second[i - first.size()];
+            }
+
+            // fn(Span<E>) por cada trozo no vacío
+            template <typename Fn>
+            void forEachSpan(Fn&& fn) const {
+                if (!first.empty()) fn(first);
+                if (!second.empty()) fn(second);
+            }
+
+            // Solo reservas: copia 'values' (values.size() == size())
+            void copyFrom(Span<const V> values) const {
+                assert(values.size() == size() && "Range size mismatch");
+                std::copy(values.begin(), values.begin() + first.size(), first.begin());
+                std::copy(values.begin() + first.size(), values.end(), second.begin());
+            }
+
+            void copyTo(Span<V> out) const {
+                assert(out.size() == size() && "Range size mismatch");
+                std::copy(first.begin(), first.end(), out.begin());
+                std::copy(second.begin(), second.end(), out.begin() + first.size());
+            }
+        };
+
+        using Reservation = Range<V>;
+        using ReadView = Range<const V>;
+
+        // --- 1. CONSTRUCCIÓN ---
+
+        // Capacidad redondeada a potencia de dos (índice = cursor & mask)
+        explicit RingBuffer(size_t capacity) : buffer_(roundUpPow2(capacity)), mask_(buffer_.size() - 1) {
+            assert(capacity > 0 && "RingBuffer capacity must be positive");
+        }
+
+        RingBuffer(const RingBuffer&) = delete;
+        RingBuffer& operator=(const RingBuffer&) = delete;
+
+        size_t capacity() const { return buffer_.size(); }
+
+        // Publicados y aún no tomados (aproximado con hilos activos)
+        size_t size() const {
+            const uint64_t r = read_.load(std::memory_order_relaxed);
+            const uint64_t c = committed_.load(std::memory_order_relaxed);
+            return c > r ? size_t(c - r) : 0;
+        }
+
+        // --- 2. PRODUCTORES ---
+
+        // Reserva exactamente n huecos o ninguno (cola llena o n > capacity())
+        Reservation tryReserve(size_t n) {
+            if (n > capacity()) return Reservation{};
+            uint64_t h = head_.load(std::memory_order_relaxed);
+            do {
+                // acquire: los consumidores terminaron de leer lo liberado
+                const uint64_t t = tail_.load(std::memory_order_acquire);
+                if (h + n - t > capacity()) return Reservation{};
+            } while (!head_.compare_exchange_weak(h, h + n, std::memory_order_relaxed));
+            return makeRange<V>(h, n);
+        }
+
+        // Espera hasta que haya n huecos (vacía sin esperar si n > capacity())
+        Reservation reserve(size_t n) {
+            if (n > capacity()) return Reservation{};
+            for (unsigned spins = 0;; ++spins) {
+                Reservation r = tryReserve(n);
+                if (r.size() == n) return r;
+                backoff(spins);
+            }
+        }
+
+        // Publica la reserva para los consumidores (en orden de reserva)
+        void commit(const Reservation& r) {
+            if (r.empty()) return;
+            waitFor(committed_, r.begin);
+            committed_.store(r.begin + r.size(), std::memory_order_release);
+        }
+
+        bool tryPush(Span<const V> values) {
+            if (values.empty()) return true;
+            const Reservation r = tryReserve(values.size());
+            if (r.empty()) return false;
+            r.copyFrom(values);
+            commit(r);
+            return true;
+        }
+
+        // Bloques de a lo sumo capacity(): cada uno se publica por separado
+        void push(Span<const V> values) {
+            while (!values.empty()) {
+                const size_t n = std::min(values.size(), capacity());
+                const Reservation r = reserve(n);
+                r.copyFrom(values.subspan(0, n));
+                commit(r);
+                values = values.subspan(n, values.size() - n);
+            }
+        }
+
+        // --- 3. CONSUMIDORES ---
+
+        // Toma hasta maxCount elementos publicados (vacío si no hay ninguno).
+        // La vista apunta al almacenamiento de la cola hasta release().
+        ReadView tryAcquire(size_t maxCount) {
+            uint64_t r = read_.load(std::memory_order_relaxed);
+            size_t n;
+            do {
+                // acquire: las escrituras del productor son visibles
+                const uint64_t c = committed_.load(std::memory_order_acquire);
+                n = size_t(std::min<uint64_t>(c - r, maxCount));
+                if (n == 0) return ReadView{};
+            } while (!read_.compare_exchange_weak(r, r + n, std::memory_order_relaxed));
+            return makeRange<const V>(r, n);
+        }
+
+        // Espera hasta que haya al menos un elemento
+        ReadView acquire(size_t maxCount) {
+            for (unsigned spins = 0;; ++spins) {
+                ReadView v = tryAcquire(maxCount);
+                if (!v.empty() || maxCount == 0) return v;
+                backoff(spins);
+            }
+        }
+
+        // Devuelve los huecos de la vista a los productores (en orden de toma)
+        void release(const ReadView& v) {
+            if (v.empty()) return;
+            waitFor(tail_, v.begin);
+            tail_.store(v.begin + v.size(), std::memory_order_release);
+        }
+
+        // Copia hasta out.size() elementos; devuelve cuántos
+        size_t tryPop(Span<V> out) {
+            const ReadView v = tryAcquire(out.size());
+            v.copyTo(out.subspan(0, v.size()));
+            release(v);
+            return v.size();
+        }
+
+    private:
+        static size_t roundUpPow2(size_t n) {
+            size_t p = 1;
+            while (p < n) p <<= 1;
+            return p;
+        }
+
+        template <typename E>
+        Range<E> makeRange(uint64_t begin, size_t n) {
+            const size_t start = size_t(begin & mask_);
+            const size_t head = std::min(n, capacity() - start);
+            Range<E> r;
+            r.first = Span<E>(buffer_.data() + start, head);
+            r.second = Span<E>(buffer_.data(), n - head);
+            r.begin = begin;
+            return r;
+        }
+
+        // Unas vueltas activas y luego ceder el núcleo: con más hilos que
+        // núcleos el que debe avanzar puede estar sin CPU
+        static void backoff(unsigned spins) {
+            if (spins >= kSpinsBeforeYield) std::this_thread::yield();
+        }
+
+        static void waitFor(const std::atomic<uint64_t>& cursor, uint64_t value) {
+            for (unsigned spins = 0; cursor.load(std::memory_order_acquire) != value; ++spins) backoff(spins);
+        }
+
+        static constexpr unsigned kSpinsBeforeYield = 64;
+
+        std::vector<V, AlignedAllocator<V>> buffer_;
+        const size_t mask_;
+
+        alignas(kCacheLine) std::atomic<uint64_t> head_{0};
+        alignas(kCacheLine) std::atomic<uint64_t> committed_{0};
+        alignas(kCacheLine) std::atomic<uint64_t> read_{0};
+        alignas(kCacheLine) std::atomic<uint64_t> tail_{0};
+    };
+
+} // namespace TinyGeo
@@ -0,0 +1,268 @@
+#pragma once
+
+// Despacho en tiempo de ejecución hacia instanciaciones Vector<T, N>, para
+// buffers cuyo tipo de escalar y dimensión solo se conocen al leer la
+// cabecera de un archivo.
+//
+//   io::MappedPointCloud cloud("scan.tgpc");
+//   dispatch::visitPoints(cloud, [&](auto points) { // Span<const Vector<T, N>>
+//       using V = typename decltype(points)::value_type;
+//       ...kernels de batch:: sobre 'points'...
+//   });
+//
+//   dispatch::visit(shape, [](auto k) {             // Kernel<T, N>
+//       using T = typename decltype(k)::scalar_type;
+//       constexpr size_t N = decltype(k)::size;
+//       ...
+//   });
+//
+// Como std::visit: el callable se instancia para cada combinación de
+// ScalarType (float, double, int16) y N (2, 3, 4), todas deben devolver el
+// mismo tipo, y una forma no soportada lanza std::runtime_error.
+//
+// ISA: en x86 con GCC/Clang la llamada pasa por un trampolín compilado con
+// target("avx2,fma,f16c,bmi2") y flatten si la CPU (CPUID) lo permite. Todo
+// lo que el callable invoca se inlinea ahí y se recompila para AVX2: los
+// loops de Batch.h, Statistics.h... se vectorizan a 256 bits con FMA aunque
+// el binario se compile para el baseline (TINYGEO_SIMD=SSE2). Las
+// operaciones de Vector con intrínsecos mantienen el backend de Simd.h.
+// La variable de entorno TINYGEO_ISA=baseline fuerza el camino genérico.
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "TinyGeo/PointCloudIO.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__CUDACC__)
+    #define TINYGEO_HAS_ISA_DISPATCH 1
+    #define TINYGEO_TARGET_AVX2 __attribute__((target("avx2,fma,f16c,bmi2"), flatten))
+#endif
+
+namespace TinyGeo {
+namespace dispatch {
+
+    // --- 1. DETECCIÓN DE CPU ---
+
+    enum class Isa : uint8_t {
+        Baseline, // Lo que fijan las opciones de compilación
+        AVX2,     // AVX2 + FMA + F16C + BMI2 (Haswell / Zen en adelante)
+    };
+
+    inline const char* isaName(Isa isa) { return isa == Isa::AVX2 ? "avx2" : "baseline"; }
+
+    struct CpuFeatures {
+        bool sse2 = false;
+        bool avx = false;
+        bool avx2 = false;
+        bool fma = false;
+        bool f16c = false;
+        bool bmi2 = false;
+        bool avx512f = false;
+    };
+
+namespace detail {
+
+    inline CpuFeatures detectCpu() {
+        CpuFeatures f;
+#if defined(TINYGEO_HAS_ISA_DISPATCH)
+        // libgcc comprueba también XGETBV: AVX solo cuenta si el SO guarda
+        // los registros YMM
+        __builtin_cpu_init();
+        f.sse2 = __builtin_cpu_supports("sse2");
+        f.avx = __builtin_cpu_supports("avx");
+        f.avx2 = __builtin_cpu_supports("avx2");
+        f.fma = __builtin_cpu_supports("fma");
+        f.f16c = __builtin_cpu_supports("f16c");
+        f.bmi2 = __builtin_cpu_supports("bmi2");
+        f.avx512f = __builtin_cpu_supports("avx512f");
+#endif
+        return f;
+    }
+
+} // namespace detail
+
+    // CPUID una sola vez por proceso
+    inline const CpuFeatures& cpuFeatures() {
+        static const CpuFeatures features = detail::detectCpu();
+        return features;
+    }
+
+    inline bool isSupported(Isa isa) {
+        if (isa == Isa::Baseline) return true;
+#if defined(TINYGEO_HAS_ISA_DISPATCH)
+        const CpuFeatures& f = cpuFeatures();
+        return f.avx2 && f.fma && f.f16c && f.bmi2;
+#else
+        return false;
+#endif
+    }
+
+    inline Isa bestIsa() { return isSupported(Isa::AVX2) ? Isa::AVX2 : Isa::Baseline; }
+
+namespace detail {
+
+    // bestIsa(), salvo TINYGEO_ISA=baseline en el entorno
+    inline Isa initialIsa() {
+        const char* env = std::getenv("TINYGEO_ISA");
+        if (env && std::strcmp(env, "baseline") == 0) return Isa::Baseline;
+        return bestIsa();
+    }
+
+    inline std::atomic<Isa>& activeIsaSlot() {
+        static std::atomic<Isa> isa{initialIsa()};
+        return isa;
+    }
+
+} // namespace detail
+
+    // ISA con la que visit() ejecuta los kernels
+    inline Isa activeIsa() { return detail::activeIsaSlot().load(std::memory_order_relaxed); }
+
+    // Pruebas y comparativas. La ISA debe estar soportada por la CPU.
+    inline void setActiveIsa(Isa isa) {
+        assert(isSupported(isa) && "ISA not supported by this CPU");
+        detail::activeIsaSlot().store(isSupported(isa) ? isa : Isa::Baseline, std::memory_order_relaxed);
+    }
+
+namespace detail {
+
+#if defined(TINYGEO_HAS_ISA_DISPATCH)
+    template <typename Fn>
+    TINYGEO_TARGET_AVX2 std::invoke_result_t<Fn&> runAvx2(Fn& fn) {
+        return fn();
+    }
+#endif
+
+} // namespace detail
+
+    // fn() compilado para 'isa'
+    template <typename Fn>
+    std::invoke_result_t<Fn&> runWithIsa(Isa isa, Fn&& fn) {
+#if defined(TINYGEO_HAS_ISA_DISPATCH)
+        if (isa == Isa::AVX2) return detail::runAvx2(fn);
+#else
+        (void)isa;
+#endif
+        return fn();
+    }
+
+    // --- 2. FORMA DE LOS DATOS ---
+
+    // Descriptor en tiempo de ejecución de un Vector<T, N>
+    struct Shape {
+        io::ScalarType type = io::ScalarType::Float32;
+        uint32_t dimension = 3;
+    };
+
+    // Etiqueta que recibe el callable de visit()
+    template <typename T, size_t N>
+    struct Kernel {
+        using scalar_type = T;
+        using vector_type = Vector<T, N>;
+        static constexpr size_t size = N;
+    };
+
+    inline constexpr uint32_t kMinDimension = 2;
+    inline constexpr uint32_t kMaxDimension = 4;
+
+    inline bool isSupported(const Shape& shape) {
+        const bool type = shape.type == io::ScalarType::Float32 || shape.type == io::ScalarType::Float64 ||
+                          shape.type == io::ScalarType::Int16;
+        return type && shape.dimension >= kMinDimension && shape.dimension <= kMaxDimension;
+    }
+
+    inline Shape shapeOf(const io::PointCloudHeader& h) { return Shape{h.scalarType, h.dimension}; }
+
+    template <typename T, size_t N>
+    constexpr Shape shapeOf() {
+        return Shape{io::scalarTypeOf<T>(), uint32_t(N)};
+    }
+
+namespace detail {
+
+    template <typename Fn>
+    using VisitResult = std::invoke_result_t<Fn&, Kernel<float, 3>>;
+
+    [[noreturn]] inline void unsupported(const Shape& shape) {
+        throw std::runtime_error("TinyGeo dispatch: unsupported shape (scalar type " +
+                                 std::to_string(uint32_t(shape.type)) + ", dimension " +
+                                 std::to_string(shape.dimension) + ")");
+    }
+
+    template <typename T, typename Fn>
+    VisitResult<Fn> visitDimension(const Shape& shape, Fn& fn) {
+        switch (shape.dimension) {
+        case 2: return fn(Kernel<T, 2>{});
+        case 3: return fn(Kernel<T, 3>{});
+        case 4: return fn(Kernel<T, 4>{});
+        default: unsupported(shape);
+        }
+    }
+
+    template <typename Fn>
+    VisitResult<Fn> visitShape(const Shape& shape, Fn& fn) {
+        switch (shape.type) {
+        case io::ScalarType::Float32: return visitDimension<float>(shape, fn);
+        case io::ScalarType::Float64: return visitDimension<double>(shape, fn);
+        case io::ScalarType::Int16: return visitDimension<int16_t>(shape, fn);
+        }
+        unsupported(shape);
+    }
+
+} // namespace detail
+
+    // --- 3. VISITANTES ---
+
+    // fn(Kernel<T, N>{}) para la forma 'shape', con la ISA activa
+    template <typename Fn>
+    detail::VisitResult<Fn> visit(const Shape& shape, Fn&& fn) {
+        if (!isSupported(shape)) detail::unsupported(shape);
+        return runWithIsa(activeIsa(), [&]() -> detail::VisitResult<Fn> { return detail::visitShape(shape, fn); });
+    }
+
+    // Buffer AoS sin tipo: fn(Span<const Vector<T, N>>). 'data' debe estar
+    // alineado para T y contener count registros empaquetados (N escalares).
+    template <typename Fn>
+    auto visitPoints(const Shape& shape, const void* data, size_t count, Fn&& fn) {
+        return visit(shape, [&](auto k) {
+            using V = typename decltype(k)::vector_type;
+            static_assert(sizeof(V) == decltype(k)::size * sizeof(typename decltype(k)::scalar_type),
+                          "visitPoints requires packed Vector records");
+            assert(reinterpret_cast<uintptr_t>(data) % alignof(V) == 0 && "Point buffer is misaligned");
+            return fn(Span<const V>(static_cast<const V*>(data), count));
+        });
+    }
+
+    // Igual, con acceso de escritura: fn(Span<Vector<T, N>>)
+    template <typename Fn>
+    auto visitPoints(const Shape& shape, void* data, size_t count, Fn&& fn) {
+        return visit(shape, [&](auto k) {
+            using V = typename decltype(k)::vector_type;
+            static_assert(sizeof(V) == decltype(k)::size * sizeof(typename decltype(k)::scalar_type),
+                          "visitPoints requires packed Vector records");
+            assert(reinterpret_cast<uintptr_t>(data) % alignof(V) == 0 && "Point buffer is misaligned");
+            return fn(Span<V>(static_cast<V*>(data), count));
+        });
+    }
+
+    // Archivo .tgpc AoS: la forma sale de la cabecera; points<T, N>() valida
+    // stride, layout y alineación (y lanza si no cuadran)
+    template <typename Fn>
+    auto visitPoints(const io::MappedPointCloud& cloud, Fn&& fn) {
+        return visit(shapeOf(cloud.header()), [&](auto k) {
+            using K = decltype(k);
+            return fn(cloud.points<typename K::scalar_type, K::size>());
+        });
+    }
+
+} // namespace dispatch
+} // namespace TinyGeo
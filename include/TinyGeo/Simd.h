@@ -0,0 +1,107 @@
+#pragma once
+
+// Selección del backend SIMD en tiempo de compilación.
+//
+// El backend se elige según lo que el compilador declara disponible
+// (__SSE2__, __AVX2__, __ARM_NEON...), que a su vez depende de los flags
+// (-mavx2, /arch:AVX2...) que fija la opción CMake TINYGEO_SIMD.
+// Definir TINYGEO_FORCE_SCALAR desactiva todos los backends; la pasada de
+// dispositivo de nvcc (__CUDA_ARCH__) usa siempre los kernels escalares.
+//
+// Tras incluir este header exactamente uno de estos macros vale 1:
+//   TINYGEO_SIMD_AVX2   -> SSE2 + AVX2/FMA (float 3/4, double 2/4)
+//   TINYGEO_SIMD_SSE2   -> SSE2            (float 3/4, double 2)
+//   TINYGEO_SIMD_NEON   -> AArch64 NEON    (float 3/4, double 2)
+//   TINYGEO_SIMD_SCALAR -> solo kernels escalares
+
+#include "TinyGeo/Config.h"
+#include "TinyGeo/detail/Kernels.h"
+
+#if defined(TINYGEO_FORCE_SCALAR) || defined(__CUDA_ARCH__)
+    #define TINYGEO_SIMD_SCALAR 1
+#elif defined(__AVX2__)
+    #define TINYGEO_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define TINYGEO_SIMD_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define TINYGEO_SIMD_NEON 1
+#else
+    #define TINYGEO_SIMD_SCALAR 1
+#endif
+
+#if defined(TINYGEO_SIMD_SSE2) || defined(TINYGEO_SIMD_AVX2)
+    #include "TinyGeo/detail/KernelsSSE.h"
+#endif
+
+#if defined(TINYGEO_SIMD_AVX2)
+    #include "TinyGeo/detail/KernelsAVX2.h"
+#endif
+
+#if defined(TINYGEO_SIMD_NEON)
+    #include "TinyGeo/detail/KernelsNEON.h"
+#endif
+
+namespace TinyGeo {
+namespace detail {
+
+    // Punto de entrada único que usa Vector: en constexpr va a los kernels
+    // escalares (los intrínsecos no son evaluables en compilación), en
+    // runtime al backend activo.
+    template <typename T, size_t N>
+    struct Dispatch {
+        static constexpr void add(T* a, const T* b) {
+            if (TINYGEO_IS_CONSTANT_EVALUATED()) {
+                ScalarKernels<T, N>::add(a, b);
+            } else {
+                Kernels<T, N>::add(a, b);
+            }
+        }
+
+        static constexpr void sub(T* a, const T* b) {
+            if (TINYGEO_IS_CONSTANT_EVALUATED()) {
+                ScalarKernels<T, N>::sub(a, b);
+            } else {
+                Kernels<T, N>::sub(a, b);
+            }
+        }
+
+        static constexpr void scale(T* a, T s) {
+            if (TINYGEO_IS_CONSTANT_EVALUATED()) {
+                ScalarKernels<T, N>::scale(a, s);
+            } else {
+                Kernels<T, N>::scale(a, s);
+            }
+        }
+
+        static constexpr T dot(const T* a, const T* b) {
+            if (TINYGEO_IS_CONSTANT_EVALUATED()) {
+                return ScalarKernels<T, N>::dot(a, b);
+            }
+            return Kernels<T, N>::dot(a, b);
+        }
+
+        static constexpr void cross(const T* a, const T* b, T* out) {
+            if (TINYGEO_IS_CONSTANT_EVALUATED()) {
+                ScalarKernels<T, N>::cross(a, b, out);
+            } else {
+                Kernels<T, N>::cross(a, b, out);
+            }
+        }
+    };
+
+} // namespace detail
+
+    // Nombre del backend activo (útil en logs y benchmarks)
+    constexpr const char* simdBackendName() {
+#if defined(TINYGEO_SIMD_AVX2)
+        return "AVX2";
+#elif defined(TINYGEO_SIMD_SSE2)
+        return "SSE2";
+#elif defined(TINYGEO_SIMD_NEON)
+        return "NEON";
+#else
+        return "Scalar";
+#endif
+    }
+
+} // namespace TinyGeo
@@ -0,0 +1,518 @@
+#pragma once
+
+// Curvas de Morton (Z-order) y de Hilbert sobre Vector<T, 2/3> y
+// reordenación de arrays de puntos a lo largo de ellas.
+//
+// Cada punto se cuantiza dentro de una AABB a kCurveBits<N> bits por eje
+// (32 en 2D, 21 en 3D) y se codifica en una clave de 64 bits. Ordenar por
+// la clave deja juntos en memoria los puntos cercanos en el espacio: las
+// consultas espaciales y la construcción de Bvh / KdTree tocan menos líneas
+// de caché. Hilbert conserva mejor la localidad (celdas consecutivas son
+// siempre vecinas); Morton es más barato de calcular.
+//
+//   std::vector<uint32_t> perm = mortonSort(execution::par, Span(points));
+//   // points[i] es ahora el antiguo points[perm[i]]
+//
+// El entrelazado de bits usa PDEP con BMI2 (__BMI2__, activado por
+// TINYGEO_SIMD=AVX2) y si no, máscaras mágicas. En AMD anteriores a Zen 3
+// PDEP está microcodificado y es más lento: TINYGEO_NO_PDEP lo desactiva.
+//
+// radixSort() es un LSD radix sort estable de 8 bits por pasada sobre las
+// claves, paralelo por chunks (histograma por chunk + scatter sin locks).
+// Las pasadas en las que todas las claves comparten el dígito se saltan.
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "TinyGeo/AABB.h"
+#include "TinyGeo/ParallelBatch.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Statistics.h"
+#include "TinyGeo/ThreadPool.h"
+#include "TinyGeo/Vector.h"
+#include "TinyGeo/VectorSoA.h"
+
+#if defined(__BMI2__) && !defined(TINYGEO_NO_PDEP)
+    #include <immintrin.h>
+    #define TINYGEO_HAS_PDEP 1
+#endif
+
+namespace TinyGeo {
+
+    // Bits de cuantización por eje: la clave entera cabe en 64 bits
+    template <size_t N>
+    inline constexpr unsigned kCurveBits = N == 2 ? 32u : 21u;
+
+namespace detail {
+
+    // --- 1. ENTRELAZADO DE BITS ---
+
+    inline constexpr uint64_t kSpread2Mask = 0x5555555555555555ull; // Bits 0, 2, 4...
+    inline constexpr uint64_t kSpread3Mask = 0x1249249249249249ull; // Bits 0, 3, 6...
+
+    // Bit i de x -> bit 2i (máscaras mágicas, sin BMI2)
+    constexpr uint64_t spreadBits2Portable(uint32_t v) {
+        uint64_t x = v;
+        x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+        x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+        x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+        x = (x | (x << 2)) & 0x3333333333333333ull;
+        x = (x | (x << 1)) & kSpread2Mask;
+        return x;
+    }
+
+    // Bit i de x (21 bits) -> bit 3i
+    constexpr uint64_t spreadBits3Portable(uint32_t v) {
+        uint64_t x = v & 0x1FFFFFu;
+        x = (x | (x << 32)) & 0x001F00000000FFFFull;
+        x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+        x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+        x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+        x = (x | (x << 2)) & kSpread3Mask;
+        return x;
+    }
+
+    constexpr uint64_t spreadBits2(uint32_t v) {
+#if defined(TINYGEO_HAS_PDEP)
+        if (!TINYGEO_IS_CONSTANT_EVALUATED()) return _pdep_u64(v, kSpread2Mask);
+#endif
+        return spreadBits2Portable(v);
+    }
+
+    constexpr uint64_t spreadBits3(uint32_t v) {
+#if defined(TINYGEO_HAS_PDEP)
+        if (!TINYGEO_IS_CONSTANT_EVALUATED()) return _pdep_u64(v & 0x1FFFFFu, kSpread3Mask);
+#endif
+        return spreadBits3Portable(v);
+    }
+
+    // Hilbert por la transpuesta de Skilling ("Programming the Hilbert
+    // curve", 2004): deshace rotaciones/reflexiones de alto a bajo nivel y
+    // aplica el código Gray. El índice es la transpuesta entrelazada con
+    // X[0] como bit más significativo de cada grupo.
+    template <size_t N>
+    constexpr void hilbertTranspose(uint32_t (&x)[N]) {
+        constexpr uint32_t top = uint32_t(1) << (kCurveBits<N> - 1);
+        for (uint32_t q = top; q > 1; q >>= 1) {
+            const uint32_t p = q - 1;
+            for (size_t i = 0; i < N; ++i) {
+                if (x[i] & q) {
+                    x[0] ^= p; // Invierte
+                } else {
+                    const uint32_t t = (x[0] ^ x[i]) & p; // Intercambia
+                    x[0] ^= t;
+                    x[i] ^= t;
+                }
+            }
+        }
+        for (size_t i = 1; i < N; ++i) x[i] ^= x[i - 1];
+        uint32_t t = 0;
+        for (uint32_t q = top; q > 1; q >>= 1) {
+            if (x[N - 1] & q) t ^= q - 1;
+        }
+        for (size_t i = 0; i < N; ++i) x[i] ^= t;
+    }
+
+    // Cuantización a la rejilla de la curva: [lo, hi] -> [0, 2^bits - 1] por eje
+    template <typename T, size_t N>
+    class CurveGrid {
+    public:
+        explicit CurveGrid(const AABB<T, N>& bounds) {
+            constexpr double cells = double(uint64_t(1) << kCurveBits<N>);
+            for (size_t i = 0; i < N; ++i) {
+                lo_[i] = double(bounds.lo.data[i]);
+                const double extent = double(bounds.hi.data[i]) - lo_[i];
+                scale_[i] = extent > 0.0 ? cells / extent : 0.0;
+            }
+        }
+
+        uint32_t cell(T v, size_t axis) const {
+            constexpr double maxCell = double((uint64_t(1) << kCurveBits<N>) - 1);
+            const double c = (double(v) - lo_[axis]) * scale_[axis];
+            // Fuera de la caja se satura al borde (también NaN -> 0)
+            return c > 0.0 ? uint32_t(std::min(c, maxCell)) : 0u;
+        }
+
+    private:
+        double lo_[N];
+        double scale_[N];
+    };
+
+} // namespace detail
+
+    // --- 2. CLAVES SOBRE CELDAS ENTERAS ---
+
+    constexpr uint64_t mortonKey(uint32_t x, uint32_t y) {
+        return detail::spreadBits2(x) | (detail::spreadBits2(y) << 1);
+    }
+
+    // x, y, z < 2^21
+    constexpr uint64_t mortonKey(uint32_t x, uint32_t y, uint32_t z) {
+        return detail::spreadBits3(x) | (detail::spreadBits3(y) << 1) | (detail::spreadBits3(z) << 2);
+    }
+
+    constexpr uint64_t hilbertKey(uint32_t x, uint32_t y) {
+        uint32_t t[2] = {x, y};
+        detail::hilbertTranspose(t);
+        return detail::spreadBits2(t[1]) | (detail::spreadBits2(t[0]) << 1);
+    }
+
+    // x, y, z < 2^21
+    constexpr uint64_t hilbertKey(uint32_t x, uint32_t y, uint32_t z) {
+        uint32_t t[3] = {x & 0x1FFFFFu, y & 0x1FFFFFu, z & 0x1FFFFFu};
+        detail::hilbertTranspose(t);
+        return detail::spreadBits3(t[2]) | (detail::spreadBits3(t[1]) << 1) | (detail::spreadBits3(t[0]) << 2);
+    }
+
+    enum class Curve { Morton, Hilbert };
+
+namespace detail {
+
+    template <Curve C, typename T, size_t N, typename Point>
+    uint64_t curveKey(const CurveGrid<T, N>& grid, const Point& p) {
+        static_assert(N == 2 || N == 3, "Space-filling curves are defined for 2D and 3D vectors");
+        if constexpr (N == 2) {
+            const uint32_t x = grid.cell(p[0], 0), y = grid.cell(p[1], 1);
+            return C == Curve::Morton ? mortonKey(x, y) : hilbertKey(x, y);
+        } else {
+            const uint32_t x = grid.cell(p[0], 0), y = grid.cell(p[1], 1), z = grid.cell(p[2], 2);
+            return C == Curve::Morton ? mortonKey(x, y, z) : hilbertKey(x, y, z);
+        }
+    }
+
+    template <Curve C, typename T, size_t N, typename VI>
+    void encodeRange(const CurveGrid<T, N>& grid, const VI* points, uint64_t* keys, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            keys[i] = curveKey<C, T, N>(grid, points[i].data);
+        }
+    }
+
+    template <Curve C, typename T, size_t N, typename A>
+    void encodeRange(const CurveGrid<T, N>& grid, const VectorSoA<T, N, A>& soa, uint64_t* keys, size_t begin,
+                     size_t end) {
+        const T* lanes[N];
+        for (size_t k = 0; k < N; ++k) lanes[k] = soa.lane(k);
+        for (size_t i = begin; i < end; ++i) {
+            T p[N];
+            for (size_t k = 0; k < N; ++k) p[k] = lanes[k][i];
+            keys[i] = curveKey<C, T, N>(grid, p);
+        }
+    }
+
+    template <Curve C, typename T, size_t N, typename VI>
+    void encode(ThreadPool* pool, const AABB<T, N>& bounds, Span<VI> points, Span<uint64_t> keys) {
+        static_assert(std::is_same_v<std::remove_const_t<VI>, Vector<T, N>>, "Points must be Vector<T, N>");
+        assert(points.size() == keys.size() && "Batch size mismatch");
+        const CurveGrid<T, N> grid(bounds);
+        const VI* p = points.data();
+        uint64_t* k = keys.data();
+        if (pool) {
+            batch::detail::parallelChunks<VI>(execution::on(*pool), k, points.size(),
+                                              [&](size_t b, size_t e) { encodeRange<C>(grid, p, k, b, e); });
+        } else {
+            encodeRange<C>(grid, p, k, 0, points.size());
+        }
+    }
+
+    template <Curve C, typename T, size_t N, typename A>
+    void encode(ThreadPool* pool, const AABB<T, N>& bounds, const VectorSoA<T, N, A>& soa, Span<uint64_t> keys) {
+        assert(soa.size() == keys.size() && "Batch size mismatch");
+        const CurveGrid<T, N> grid(bounds);
+        uint64_t* k = keys.data();
+        if (pool) {
+            batch::detail::parallelChunks<T>(execution::on(*pool), k, soa.size(),
+                                             [&](size_t b, size_t e) { encodeRange<C>(grid, soa, k, b, e); });
+        } else {
+            encodeRange<C>(grid, soa, k, 0, soa.size());
+        }
+    }
+
+} // namespace detail
+
+    // --- 3. CODIFICACIÓN POR LOTES ---
+    // Puntos fuera de 'bounds' se saturan a la celda del borde.
+
+    template <typename T, size_t N>
+    uint64_t mortonEncode(const AABB<T, N>& bounds, const Vector<T, N>& p) {
+        return detail::curveKey<Curve::Morton, T, N>(detail::CurveGrid<T, N>(bounds), p.data);
+    }
+
+    template <typename T, size_t N>
+    uint64_t hilbertEncode(const AABB<T, N>& bounds, const Vector<T, N>& p) {
+        return detail::curveKey<Curve::Hilbert, T, N>(detail::CurveGrid<T, N>(bounds), p.data);
+    }
+
+    // keys[i] = clave de points[i]
+    template <typename T, size_t N, typename VI>
+    void mortonEncode(const AABB<T, N>& bounds, Span<VI> points, Span<uint64_t> keys) {
+        detail::encode<Curve::Morton>(nullptr, bounds, points, keys);
+    }
+
+    template <typename T, size_t N, typename VI>
+    void mortonEncode(const execution::ParallelPolicy& policy, const AABB<T, N>& bounds, Span<VI> points,
+                      Span<uint64_t> keys) {
+        detail::encode<Curve::Morton>(&policy.resolve(), bounds, points, keys);
+    }
+
+    template <typename T, size_t N, typename VI>
+    void hilbertEncode(const AABB<T, N>& bounds, Span<VI> points, Span<uint64_t> keys) {
+        detail::encode<Curve::Hilbert>(nullptr, bounds, points, keys);
+    }
+
+    template <typename T, size_t N, typename VI>
+    void hilbertEncode(const execution::ParallelPolicy& policy, const AABB<T, N>& bounds, Span<VI> points,
+                       Span<uint64_t> keys) {
+        detail::encode<Curve::Hilbert>(&policy.resolve(), bounds, points, keys);
+    }
+
+    template <typename T, size_t N, typename A>
+    void mortonEncode(const AABB<T, N>& bounds, const VectorSoA<T, N, A>& soa, Span<uint64_t> keys) {
+        detail::encode<Curve::Morton>(nullptr, bounds, soa, keys);
+    }
+
+    template <typename T, size_t N, typename A>
+    void mortonEncode(const execution::ParallelPolicy& policy, const AABB<T, N>& bounds,
+                      const VectorSoA<T, N, A>& soa, Span<uint64_t> keys) {
+        detail::encode<Curve::Morton>(&policy.resolve(), bounds, soa, keys);
+    }
+
+    template <typename T, size_t N, typename A>
+    void hilbertEncode(const AABB<T, N>& bounds, const VectorSoA<T, N, A>& soa, Span<uint64_t> keys) {
+        detail::encode<Curve::Hilbert>(nullptr, bounds, soa, keys);
+    }
+
+    template <typename T, size_t N, typename A>
+    void hilbertEncode(const execution::ParallelPolicy& policy, const AABB<T, N>& bounds,
+                       const VectorSoA<T, N, A>& soa, Span<uint64_t> keys) {
+        detail::encode<Curve::Hilbert>(&policy.resolve(), bounds, soa, keys);
+    }
+
+namespace detail {
+
+    // --- 4. RADIX SORT ---
+
+    inline constexpr unsigned kRadixBits = 8;
+    inline constexpr size_t kRadixBuckets = size_t(1) << kRadixBits;
+
+    // Elementos mínimos por chunk: por debajo el histograma por chunk
+    // (256 contadores) deja de amortizarse
+    inline constexpr size_t kRadixMinChunk = 16 * 1024;
+    inline constexpr size_t kRadixChunksPerThread = 4;
+
+    // fn(c) para c en [0, chunks), en paralelo si hay pool
+    template <typename Fn>
+    void forEachChunk(ThreadPool* pool, size_t chunks, Fn&& fn) {
+        if (pool && chunks > 1) {
+            pool->parallelFor(chunks, 1, [&](size_t b, size_t e) {
+                for (size_t c = b; c < e; ++c) fn(c);
+            });
+        } else {
+            for (size_t c = 0; c < chunks; ++c) fn(c);
+        }
+    }
+
+    inline void radixSort(ThreadPool* pool, Span<uint64_t> keys, Span<uint32_t> order) {
+        assert(keys.size() == order.size() && "Batch size mismatch");
+        assert(keys.size() <= size_t(std::numeric_limits<uint32_t>::max()) && "radixSort indexes with uint32_t");
+        const size_t n = keys.size();
+        for (size_t i = 0; i < n; ++i) order[i] = uint32_t(i);
+        if (n < 2) return;
+
+        size_t chunks = 1;
+        if (pool) {
+            chunks = std::min(pool->concurrency() * kRadixChunksPerThread, (n + kRadixMinChunk - 1) / kRadixMinChunk);
+            chunks = std::max<size_t>(chunks, 1);
+        }
+        auto chunkBegin = [&](size_t c) { return n * c / chunks; };
+
+        // Bits que varían entre claves: las pasadas sin ninguno se saltan
+        std::vector<uint64_t> diffs(chunks, 0);
+        forEachChunk(pool, chunks, [&](size_t c) {
+            uint64_t d = 0;
+            for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i) d |= keys[i] ^ keys[0];
+            diffs[c] = d;
+        });
+        uint64_t diff = 0;
+        for (uint64_t d : diffs) diff |= d;
+
+        std::vector<uint64_t> tmpKeys(n);
+        std::vector<uint32_t> tmpOrder(n);
+        uint64_t* srcKeys = keys.data();
+        uint32_t* srcOrder = order.data();
+        uint64_t* dstKeys = tmpKeys.data();
+        uint32_t* dstOrder = tmpOrder.data();
+        std::vector<size_t> offsets(chunks * kRadixBuckets);
+
+        for (unsigned shift = 0; shift < 64; shift += kRadixBits) {
+            if (((diff >> shift) & (kRadixBuckets - 1)) == 0) continue;
+
+            forEachChunk(pool, chunks, [&](size_t c) {
+                size_t* hist = &offsets[c * kRadixBuckets];
+                std::fill(hist, hist + kRadixBuckets, size_t(0));
+                for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i) {
+                    ++hist[(srcKeys[i] >> shift) & (kRadixBuckets - 1)];
+                }
+            });
+
+            // Posición de salida de cada (dígito, chunk): por dígito y, dentro
+            // del dígito, por chunk (así el orden es estable)
+            size_t sum = 0;
+            for (size_t d = 0; d < kRadixBuckets; ++d) {
+                for (size_t c = 0; c < chunks; ++c) {
+                    const size_t count = offsets[c * kRadixBuckets + d];
+                    offsets[c * kRadixBuckets + d] = sum;
+                    sum += count;
+                }
+            }
+
+            forEachChunk(pool, chunks, [&](size_t c) {
+                size_t* next = &offsets[c * kRadixBuckets];
+                for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i) {
+                    const size_t pos = next[(srcKeys[i] >> shift) & (kRadixBuckets - 1)]++;
+                    dstKeys[pos] = srcKeys[i];
+                    dstOrder[pos] = srcOrder[i];
+                }
+            });
+            std::swap(srcKeys, dstKeys);
+            std::swap(srcOrder, dstOrder);
+        }
+
+        if (srcKeys != keys.data()) {
+            std::copy(srcKeys, srcKeys + n, keys.data());
+            std::copy(srcOrder, srcOrder + n, order.data());
+        }
+    }
+
+    // values[i] = old values[order[i]]
+    template <typename V>
+    void reorder(ThreadPool* pool, Span<const uint32_t> order, Span<V> values) {
+        assert(order.size() == values.size() && "Batch size mismatch");
+        const size_t n = values.size();
+        std::vector<V> gathered(n);
+        if (pool) {
+            batch::detail::parallelChunks<V>(execution::on(*pool), gathered.data(), n, [&](size_t b, size_t e) {
+                for (size_t i = b; i < e; ++i) gathered[i] = values[order[i]];
+            });
+        } else {
+            for (size_t i = 0; i < n; ++i) gathered[i] = values[order[i]];
+        }
+        std::copy(gathered.begin(), gathered.end(), values.data());
+    }
+
+    template <typename T, size_t N, typename A>
+    void reorder(ThreadPool* pool, Span<const uint32_t> order, VectorSoA<T, N, A>& soa) {
+        assert(order.size() == soa.size() && "Batch size mismatch");
+        for (size_t k = 0; k < N; ++k) reorder(pool, order, soa.laneSpan(k));
+    }
+
+    template <typename T, size_t N>
+    AABB<T, N> boundsOf(ThreadPool* pool, Span<Vector<T, N>> points) {
+        return stats::detail::reduce<stats::Bounds>(pool, points).bounds();
+    }
+
+    template <typename T, size_t N, typename A>
+    AABB<T, N> boundsOf(ThreadPool*, const VectorSoA<T, N, A>& soa) {
+        AABB<T, N> box;
+        for (size_t k = 0; k < N; ++k) {
+            const Span<const T> lane = soa.laneSpan(k);
+            if (lane.empty()) break;
+            const auto [lo, hi] = std::minmax_element(lane.begin(), lane.end());
+            box.lo.data[k] = *lo;
+            box.hi.data[k] = *hi;
+        }
+        return box;
+    }
+
+    template <Curve C, typename Points>
+    std::vector<uint32_t> curveSort(ThreadPool* pool, Points& points, size_t n) {
+        const auto box = boundsOf(pool, points);
+        std::vector<uint64_t> keys(n);
+        std::vector<uint32_t> order(n);
+        encode<C>(pool, box, points, Span<uint64_t>(keys));
+        radixSort(pool, Span<uint64_t>(keys), Span<uint32_t>(order));
+        reorder(pool, Span<const uint32_t>(order), points);
+        return order;
+    }
+
+} // namespace detail
+
+    // --- 5. ORDENACIÓN ---
+
+    // Ordena keys (ascendente, estable) y escribe en order la permutación:
+    // order[i] = posición original de la i-ésima clave.
+    inline void radixSort(Span<uint64_t> keys, Span<uint32_t> order) { detail::radixSort(nullptr, keys, order); }
+
+    inline void radixSort(const execution::ParallelPolicy& policy, Span<uint64_t> keys, Span<uint32_t> order) {
+        detail::radixSort(&policy.resolve(), keys, order);
+    }
+
+    // Aplica una permutación de radixSort: values[i] = antiguo values[order[i]]
+    template <typename V>
+    void reorder(Span<const uint32_t> order, Span<V> values) {
+        detail::reorder(nullptr, order, values);
+    }
+
+    template <typename V>
+    void reorder(const execution::ParallelPolicy& policy, Span<const uint32_t> order, Span<V> values) {
+        detail::reorder(&policy.resolve(), order, values);
+    }
+
+    template <typename T, size_t N, typename A>
+    void reorder(Span<const uint32_t> order, VectorSoA<T, N, A>& soa) {
+        detail::reorder(nullptr, order, soa);
+    }
+
+    template <typename T, size_t N, typename A>
+    void reorder(const execution::ParallelPolicy& policy, Span<const uint32_t> order, VectorSoA<T, N, A>& soa) {
+        detail::reorder(&policy.resolve(), order, soa);
+    }
+
+    // Reordena los puntos a lo largo de la curva dentro de su propia AABB.
+    // Devuelve la permutación aplicada (para reordenar atributos paralelos
+    // con reorder()).
+    template <typename T, size_t N>
+    std::vector<uint32_t> mortonSort(Span<Vector<T, N>> points) {
+        return detail::curveSort<Curve::Morton>(nullptr, points, points.size());
+    }
+
+    template <typename T, size_t N>
+    std::vector<uint32_t> mortonSort(const execution::ParallelPolicy& policy, Span<Vector<T, N>> points) {
+        return detail::curveSort<Curve::Morton>(&policy.resolve(), points, points.size());
+    }
+
+    template <typename T, size_t N>
+    std::vector<uint32_t> hilbertSort(Span<Vector<T, N>> points) {
+        return detail::curveSort<Curve::Hilbert>(nullptr, points, points.size());
+    }
+
+    template <typename T, size_t N>
+    std::vector<uint32_t> hilbertSort(const execution::ParallelPolicy& policy, Span<Vector<T, N>> points) {
+        return detail::curveSort<Curve::Hilbert>(&policy.resolve(), points, points.size());
+    }
+
+    template <typename T, size_t N, typename A>
+    std::vector<uint32_t> mortonSort(VectorSoA<T, N, A>& soa) {
+        return detail::curveSort<Curve::Morton>(nullptr, soa, soa.size());
+    }
+
+    template <typename T, size_t N, typename A>
+    std::vector<uint32_t> mortonSort(const execution::ParallelPolicy& policy, VectorSoA<T, N, A>& soa) {
+        return detail::curveSort<Curve::Morton>(&policy.resolve(), soa, soa.size());
+    }
+
+    template <typename T, size_t N, typename A>
+    std::vector<uint32_t> hilbertSort(VectorSoA<T, N, A>& soa) {
+        return detail::curveSort<Curve::Hilbert>(nullptr, soa, soa.size());
+    }
+
+    template <typename T, size_t N, typename A>
+    std::vector<uint32_t> hilbertSort(const execution::ParallelPolicy& policy, VectorSoA<T, N, A>& soa) {
+        return detail::curveSort<Curve::Hilbert>(&policy.resolve(), soa, soa.size());
+    }
+
+} // namespace TinyGeo
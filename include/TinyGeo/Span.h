@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace TinyGeo {
+
+    // Vista no-propietaria sobre memoria contigua: (puntero, tamaño).
+    // Equivalente mínimo de std::span (C++20) para poder seguir en C++17.
+    // Span<const T> es de solo lectura; Span<T> permite escribir.
+    template <typename T>
+    class Span {
+    public:
+        using element_type = T;
+        using value_type = std::remove_cv_t<T>;
+        using iterator = T*;
+
+        constexpr Span() noexcept : ptr_(nullptr), size_(0) {}
+        constexpr Span(T* ptr, size_t count) noexcept : ptr_(ptr), size_(count) {}
+
+        template <size_t M>
+        constexpr Span(T (&arr)[M]) noexcept : ptr_(arr), size_(M) {}
+
+        // Desde std::vector / std::array (const o no, según T)
+        template <typename A>
+        Span(std::vector<value_type, A>& v) noexcept : ptr_(v.data()), size_(v.size()) {}
+
+        template <typename A, typename U = T, typename = std::enable_if_t<std::is_const_v<U>>>
+        Span(const std::vector<value_type, A>& v) noexcept : ptr_(v.data()), size_(v.size()) {}
+
+        template <size_t M>
+        constexpr Span(std::array<value_type, M>& a) noexcept : ptr_(a.data()), size_(M) {}
+
+        template <size_t M, typename U = T, typename = std::enable_if_t<std::is_const_v<U>>>
+        constexpr Span(const std::array<value_type, M>& a) noexcept : ptr_(a.data()), size_(M) {}
+
+        // Conversión implícita Span<T> -> Span<const T>
+        template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+        constexpr Span(const Span<U>& other) noexcept : ptr_(other.data()), size_(other.size()) {}
+
+        constexpr T* data() const noexcept { return ptr_; }
+        constexpr size_t size() const noexcept { return size_; }
+        constexpr bool empty() const noexcept { return size_ == 0; }
+
+        constexpr T* begin() const noexcept { return ptr_; }
+        constexpr T* end() const noexcept { return ptr_ + size_; }
+
+        constexpr T& operator[](size_t index) const {
+            assert(index < size_ && "Span index out of bounds");
+            return ptr_[index];
+        }
+
+        // Sub-rango [offset, offset + count)
+        constexpr Span subspan(size_t offset, size_t count) const {
+            assert(offset + count <= size_ && "Subspan out of bounds");
+            return Span(ptr_ + offset, count);
+        }
+
+    private:
+        T* ptr_;
+        size_t size_;
+    };
+
+    // Guías de deducción (C++17 CTAD): Span(v) deduce el tipo de elemento
+    // y la constness a partir del contenedor.
+    template <typename T, typename A>
+    Span(std::vector<T, A>&) -> Span<T>;
+
+    template <typename T, typename A>
+    Span(const std::vector<T, A>&) -> Span<const T>;
+
+    template <typename T, size_t M>
+    Span(std::array<T, M>&) -> Span<T>;
+
+    template <typename T, size_t M>
+    Span(const std::array<T, M>&) -> Span<const T>;
+
+} // namespace TinyGeo
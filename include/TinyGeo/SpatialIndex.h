@@ -0,0 +1,520 @@
+#pragma once
+
+// Índices espaciales sobre Vector<T, N>:
+//   - KdTree<T, N>: puntos; kNN, radio y caja.
+//   - Bvh<T, N>:    cajas (AABB); solape con caja y con esfera.
+//
+// Ambos guardan los nodos en un único array plano en preorden: el hijo
+// izquierdo de un nodo interior es siempre el siguiente (idx + 1) y solo
+// se almacena el índice del derecho. Los elementos se reordenan en la
+// construcción para que cada hoja sea un rango contiguo de memoria.
+//
+// El número de nodos de un subárbol depende solo de su tamaño (partición
+// por la mediana), así que la posición de cada subárbol se conoce antes de
+// construirlo y las dos mitades se construyen en paralelo sin sincronizar.
+//
+// Las consultas recorren el árbol con una pila fija en el stack y escriben
+// en buffers del llamador o invocan un callback: no reservan memoria.
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "TinyGeo/AABB.h"
+#include "TinyGeo/AlignedAllocator.h"
+#include "TinyGeo/ParallelBatch.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+
+    // Resultado de kNN: índice en el array original y distancia al cuadrado
+    template <typename T>
+    struct Neighbor {
+        uint32_t index;
+        T distSq;
+
+        constexpr bool operator<(const Neighbor& other) const { return distSq < other.distSq; }
+    };
+
+namespace detail {
+
+    // Profundidad máxima de la pila de recorrido. Con partición por la
+    // mediana la profundidad es ceil(log2(n)) <= 32 para índices de 32 bits.
+    inline constexpr size_t kTreeStackDepth = 64;
+
+    // Por debajo de este tamaño un subárbol se construye en el hilo actual
+    inline constexpr size_t kParallelBuildMin = 16 * 1024;
+
+    // Nodos de un árbol de 'count' elementos partido por la mediana
+    // (izquierda = count / 2) con hojas de hasta 'leafSize' elementos.
+    inline size_t treeNodeCount(size_t count, size_t leafSize) {
+        if (count <= leafSize) return 1;
+        return 1 + treeNodeCount(count / 2, leafSize) + treeNodeCount(count - count / 2, leafSize);
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr T distanceSq(const Vector<T, N, S>& a, const Vector<T, N, S>& b) {
+        T sum = T(0);
+        for (size_t i = 0; i < N; ++i) {
+            const T d = a.data[i] - b.data[i];
+            sum += d * d;
+        }
+        return sum;
+    }
+
+    // Construye las dos mitades; en paralelo si el subárbol es grande
+    template <typename BuildLeft, typename BuildRight>
+    void buildChildren(ThreadPool* pool, size_t count, BuildLeft&& left, BuildRight&& right) {
+        if (pool && count >= kParallelBuildMin) {
+            // Sin hilos de trabajo, parallelFor entrega [0, 2) en un solo chunk
+            pool->parallelFor(2, 1, [&](size_t b, size_t e) {
+                for (size_t i = b; i < e; ++i) {
+                    if (i == 0) left(); else right();
+                }
+            });
+        } else {
+            left();
+            right();
+        }
+    }
+
+} // namespace detail
+
+    // --- K-D TREE ---
+    // Alloc se usa (con rebind) para nodos, puntos, índices y el buffer de
+    // construcción; con ArenaAllocator (Memory.h) un índice por frame no
+    // toca malloc tras el primer frame.
+    template <typename T, size_t N, typename Alloc = AlignedAllocator<T>>
+    class KdTree {
+        template <typename U>
+        using Rebind = typename std::allocator_traits<Alloc>::template rebind_alloc<U>;
+
+    public:
+        using Point = Vector<T, N>;
+        using Box = AABB<T, N>;
+        using allocator_type = Alloc;
+
+        static constexpr size_t kDefaultLeafSize = 8;
+
+        KdTree() : KdTree(Alloc()) {}
+
+        explicit KdTree(const Alloc& alloc) : alloc_(alloc), nodes_(Rebind<Node>(alloc)), points_(Rebind<Point>(alloc)), indices_(Rebind<uint32_t>(alloc)) {}
+
+        explicit KdTree(Span<const Point> points, size_t leafSize = kDefaultLeafSize, const Alloc& alloc = Alloc())
+            : KdTree(alloc) {
+            build(nullptr, points, leafSize);
+        }
+
+        KdTree(const execution::ParallelPolicy& policy, Span<const Point> points,
+               size_t leafSize = kDefaultLeafSize, const Alloc& alloc = Alloc())
+            : KdTree(alloc) {
+            build(&policy.resolve(), points, leafSize);
+        }
+
+        size_t size() const { return points_.size(); }
+        bool empty() const { return points_.empty(); }
+        size_t nodeCount() const { return nodes_.size(); }
+
+        // Puntos en el orden interno (por hojas) y su índice original
+        Span<const Point> points() const { return Span<const Point>(points_.data(), points_.size()); }
+        Span<const uint32_t> indices() const { return Span<const uint32_t>(indices_.data(), indices_.size()); }
+
+        // --- kNN ---
+        // Los out.size() vecinos más cercanos a q, ordenados por distancia.
+        // Devuelve cuántos se escribieron (min(out.size(), size())).
+        size_t knn(const Point& q, Span<Neighbor<T>> out) const {
+            const size_t k = std::min(out.size(), size());
+            if (k == 0) return 0;
+
+            // out[0, found) es un max-heap: out[0] es el peor candidato
+            Neighbor<T>* heap = out.data();
+            size_t found = 0;
+            T worst = std::numeric_limits<T>::max();
+
+            Entry stack[detail::kTreeStackDepth];
+            size_t sp = 0;
+            stack[sp++] = {0, T(0)};
+            while (sp > 0) {
+                const Entry e = stack[--sp];
+                if (found == k && e.bound >= worst) continue;
+
+                uint32_t idx = e.node;
+                while (nodes_[idx].axis != kLeaf) {
+                    const Node& n = nodes_[idx];
+                    const T diff = q.data[n.axis] - n.split;
+                    const uint32_t nearChild = diff < T(0) ? idx + 1 : n.begin;
+                    const uint32_t farChild = diff < T(0) ? n.begin : idx + 1;
+                    const T farBound = std::max(e.bound, diff * diff);
+                    if (found < k || farBound < worst) {
+                        assert(sp < detail::kTreeStackDepth && "KdTree too deep");
+                        stack[sp++] = {farChild, farBound};
+                    }
+                    idx = nearChild;
+                }
+
+                const Node& leaf = nodes_[idx];
+                for (uint32_t i = leaf.begin; i < leaf.begin + leaf.count; ++i) {
+                    const T d = detail::distanceSq(points_[i], q);
+                    if (found < k) {
+                        heap[found++] = {indices_[i], d};
+                        std::push_heap(heap, heap + found);
+                        if (found == k) worst = heap[0].distSq;
+                    } else if (d < worst) {
+                        std::pop_heap(heap, heap + k);
+                        heap[k - 1] = {indices_[i], d};
+                        std::push_heap(heap, heap + k);
+                        worst = heap[0].distSq;
+                    }
+                }
+            }
+            std::sort_heap(heap, heap + found);
+            return found;
+        }
+
+        // Vecino más cercano (el árbol no debe estar vacío). Mismo recorrido
+        // que knn(), pero con un único candidato en lugar del heap.
+        Neighbor<T> nearest(const Point& q) const {
+            assert(!empty() && "nearest() on an empty KdTree");
+            Neighbor<T> best{0, std::numeric_limits<T>::max()};
+
+            Entry stack[detail::kTreeStackDepth];
+            size_t sp = 0;
+            stack[sp++] = {0, T(0)};
+            while (sp > 0) {
+                const Entry e = stack[--sp];
+                if (e.bound >= best.distSq) continue;
+
+                uint32_t idx = e.node;
+                while (nodes_[idx].axis != kLeaf) {
+                    const Node& n = nodes_[idx];
+                    const T diff = q.data[n.axis] - n.split;
+                    const T farBound = std::max(e.bound, diff * diff);
+                    if (farBound < best.distSq) {
+                        assert(sp < detail::kTreeStackDepth && "KdTree too deep");
+                        stack[sp++] = {diff < T(0) ? n.begin : idx + 1, farBound};
+                    }
+                    idx = diff < T(0) ? idx + 1 : n.begin;
+                }
+
+                const Node& leaf = nodes_[idx];
+                for (uint32_t i = leaf.begin; i < leaf.begin + leaf.count; ++i) {
+                    const T d = detail::distanceSq(points_[i], q);
+                    if (d < best.distSq) best = {indices_[i], d};
+                }
+            }
+            return best;
+        }
+
+        // --- RADIO ---
+        // fn(index, distSq) para cada punto con |p - q| <= radius
+        template <typename Fn>
+        void forEachInRadius(const Point& q, T radius, Fn&& fn) const {
+            if (empty()) return;
+            const T r2 = radius * radius;
+            Entry stack[detail::kTreeStackDepth];
+            size_t sp = 0;
+            stack[sp++] = {0, T(0)};
+            while (sp > 0) {
+                const Entry e = stack[--sp];
+                if (e.bound > r2) continue;
+
+                uint32_t idx = e.node;
+                while (nodes_[idx].axis != kLeaf) {
+                    const Node& n = nodes_[idx];
+                    const T diff = q.data[n.axis] - n.split;
+                    const T farBound = std::max(e.bound, diff * diff);
+                    if (farBound <= r2) {
+                        assert(sp < detail::kTreeStackDepth && "KdTree too deep");
+                        stack[sp++] = {diff < T(0) ? n.begin : idx + 1, farBound};
+                    }
+                    idx = diff < T(0) ? idx + 1 : n.begin;
+                }
+
+                const Node& leaf = nodes_[idx];
+                for (uint32_t i = leaf.begin; i < leaf.begin + leaf.count; ++i) {
+                    const T d = detail::distanceSq(points_[i], q);
+                    if (d <= r2) fn(indices_[i], d);
+                }
+            }
+        }
+
+        // Escribe hasta out.size() índices; devuelve el total encontrado
+        // (si es mayor que out.size(), el buffer se quedó corto).
+        size_t queryRadius(const Point& q, T radius, Span<uint32_t> out) const {
+            size_t total = 0;
+            forEachInRadius(q, radius, [&](uint32_t index, T) {
+                if (total < out.size()) out.data()[total] = index;
+                ++total;
+            });
+            return total;
+        }
+
+        // --- CAJA ---
+        // fn(index) para cada punto dentro de box (bordes incluidos)
+        template <typename Fn>
+        void forEachInBox(const Box& box, Fn&& fn) const {
+            if (empty()) return;
+            uint32_t stack[detail::kTreeStackDepth];
+            size_t sp = 0;
+            stack[sp++] = 0;
+            while (sp > 0) {
+                const uint32_t idx = stack[--sp];
+                const Node& n = nodes_[idx];
+                if (n.axis == kLeaf) {
+                    for (uint32_t i = n.begin; i < n.begin + n.count; ++i) {
+                        if (box.contains(points_[i])) fn(indices_[i]);
+                    }
+                    continue;
+                }
+                assert(sp + 2 <= detail::kTreeStackDepth && "KdTree too deep");
+                if (box.hi.data[n.axis] >= n.split) stack[sp++] = n.begin;
+                if (box.lo.data[n.axis] <= n.split) stack[sp++] = idx + 1;
+            }
+        }
+
+        size_t queryBox(const Box& box, Span<uint32_t> out) const {
+            size_t total = 0;
+            forEachInBox(box, [&](uint32_t index) {
+                if (total < out.size()) out.data()[total] = index;
+                ++total;
+            });
+            return total;
+        }
+
+    private:
+        static constexpr uint32_t kLeaf = uint32_t(N);
+
+        // Interior: axis < N, begin = hijo derecho (el izquierdo es idx + 1).
+        // Hoja: axis == kLeaf, puntos [begin, begin + count).
+        struct Node {
+            T split;
+            uint32_t axis;
+            uint32_t begin;
+            uint32_t count;
+        };
+
+        struct Entry {
+            uint32_t node;
+            T bound; // Cota inferior de la distancia² al subárbol
+        };
+
+        struct Item {
+            Point p;
+            uint32_t index;
+        };
+
+        void build(ThreadPool* pool, Span<const Point> points, size_t leafSize) {
+            assert(points.size() < size_t(std::numeric_limits<uint32_t>::max()) && "Too many points");
+            assert(leafSize > 0 && "Leaf size must be positive");
+            const size_t n = points.size();
+            if (n == 0) return;
+
+            std::vector<Item, Rebind<Item>> items(n, Rebind<Item>(alloc_));
+            for (size_t i = 0; i < n; ++i) {
+                items[i] = {points[i], uint32_t(i)};
+            }
+            nodes_.resize(detail::treeNodeCount(n, leafSize));
+            buildNode(pool, items.data(), 0, n, 0, leafSize);
+
+            points_.resize(n);
+            indices_.resize(n);
+            for (size_t i = 0; i < n; ++i) {
+                points_[i] = items[i].p;
+                indices_[i] = items[i].index;
+            }
+        }
+
+        void buildNode(ThreadPool* pool, Item* items, size_t begin, size_t end, size_t node, size_t leafSize) {
+            const size_t count = end - begin;
+            if (count <= leafSize) {
+                nodes_[node] = {T(0), kLeaf, uint32_t(begin), uint32_t(count)};
+                return;
+            }
+
+            Box bounds;
+            for (size_t i = begin; i < end; ++i) bounds.expand(items[i].p);
+            const size_t axis = bounds.longestAxis();
+
+            const size_t mid = begin + count / 2;
+            std::nth_element(items + begin, items + mid, items + end, [axis](const Item& a, const Item& b) {
+                return a.p.data[axis] < b.p.data[axis];
+            });
+
+            const size_t right = node + 1 + detail::treeNodeCount(count / 2, leafSize);
+            nodes_[node] = {items[mid].p.data[axis], uint32_t(axis), uint32_t(right), 0};
+            detail::buildChildren(pool, count,
+                [&] { buildNode(pool, items, begin, mid, node + 1, leafSize); },
+                [&] { buildNode(pool, items, mid, end, right, leafSize); });
+        }
+
+        Alloc alloc_;
+        std::vector<Node, Rebind<Node>> nodes_;
+        std::vector<Point, Rebind<Point>> points_;
+        std::vector<uint32_t, Rebind<uint32_t>> indices_;
+    };
+
+    // --- BVH ---
+    template <typename T, size_t N, typename Alloc = AlignedAllocator<T>>
+    class Bvh {
+        template <typename U>
+        using Rebind = typename std::allocator_traits<Alloc>::template rebind_alloc<U>;
+
+    public:
+        using Point = Vector<T, N>;
+        using Box = AABB<T, N>;
+        using allocator_type = Alloc;
+
+        static constexpr size_t kDefaultLeafSize = 4;
+
+        Bvh() : Bvh(Alloc()) {}
+
+        explicit Bvh(const Alloc& alloc) : alloc_(alloc), nodes_(Rebind<Node>(alloc)), boxes_(Rebind<Box>(alloc)), indices_(Rebind<uint32_t>(alloc)) {}
+
+        explicit Bvh(Span<const Box> boxes, size_t leafSize = kDefaultLeafSize, const Alloc& alloc = Alloc())
+            : Bvh(alloc) {
+            build(nullptr, boxes, leafSize);
+        }
+
+        Bvh(const execution::ParallelPolicy& policy, Span<const Box> boxes,
+            size_t leafSize = kDefaultLeafSize, const Alloc& alloc = Alloc())
+            : Bvh(alloc) {
+            build(&policy.resolve(), boxes, leafSize);
+        }
+
+        size_t size() const { return boxes_.size(); }
+        bool empty() const { return boxes_.empty(); }
+        size_t nodeCount() const { return nodes_.size(); }
+
+        // Caja que envuelve todo (vacía si no hay elementos)
+        Box bounds() const { return nodes_.empty() ? Box() : nodes_[0].bounds; }
+
+        // --- SOLAPE CON CAJA ---
+        // fn(index) para cada caja que solapa 'query'
+        template <typename Fn>
+        void forEachOverlap(const Box& query, Fn&& fn) const {
+            traverse([&](const Box& b) { return b.overlaps(query); }, fn);
+        }
+
+        size_t queryOverlap(const Box& query, Span<uint32_t> out) const {
+            size_t total = 0;
+            forEachOverlap(query, [&](uint32_t index) {
+                if (total < out.size()) out.data()[total] = index;
+                ++total;
+            });
+            return total;
+        }
+
+        // --- SOLAPE CON ESFERA ---
+        // fn(index) para cada caja a distancia <= radius de center
+        template <typename Fn>
+        void forEachInRadius(const Point& center, T radius, Fn&& fn) const {
+            const T r2 = radius * radius;
+            traverse([&](const Box& b) { return b.distanceSq(center) <= r2; }, fn);
+        }
+
+        size_t queryRadius(const Point& center, T radius, Span<uint32_t> out) const {
+            size_t total = 0;
+            forEachInRadius(center, radius, [&](uint32_t index) {
+                if (total < out.size()) out.data()[total] = index;
+                ++total;
+            });
+            return total;
+        }
+
+    private:
+        // Hoja: count > 0, cajas [first, first + count).
+        // Interior: count == 0, first = hijo derecho (el izquierdo es idx + 1).
+        struct Node {
+            Box bounds;
+            uint32_t first;
+            uint32_t count;
+        };
+
+        struct Item {
+            Box box;
+            Point centroid;
+            uint32_t index;
+        };
+
+        template <typename Test, typename Fn>
+        void traverse(Test&& test, Fn&& fn) const {
+            if (empty()) return;
+            uint32_t stack[detail::kTreeStackDepth];
+            size_t sp = 0;
+            stack[sp++] = 0;
+            while (sp > 0) {
+                const uint32_t idx = stack[--sp];
+                const Node& n = nodes_[idx];
+                if (!test(n.bounds)) continue;
+                if (n.count > 0) {
+                    for (uint32_t i = n.first; i < n.first + n.count; ++i) {
+                        if (test(boxes_[i])) fn(indices_[i]);
+                    }
+                    continue;
+                }
+                assert(sp + 2 <= detail::kTreeStackDepth && "Bvh too deep");
+                stack[sp++] = n.first;
+                stack[sp++] = idx + 1;
+            }
+        }
+
+        void build(ThreadPool* pool, Span<const Box> boxes, size_t leafSize) {
+            assert(boxes.size() < size_t(std::numeric_limits<uint32_t>::max()) && "Too many boxes");
+            assert(leafSize > 0 && "Leaf size must be positive");
+            const size_t n = boxes.size();
+            if (n == 0) return;
+
+            std::vector<Item, Rebind<Item>> items(n, Rebind<Item>(alloc_));
+            for (size_t i = 0; i < n; ++i) {
+                items[i] = {boxes[i], boxes[i].center(), uint32_t(i)};
+            }
+            nodes_.resize(detail::treeNodeCount(n, leafSize));
+            buildNode(pool, items.data(), 0, n, 0, leafSize);
+
+            boxes_.resize(n);
+            indices_.resize(n);
+            for (size_t i = 0; i < n; ++i) {
+                boxes_[i] = items[i].box;
+                indices_[i] = items[i].index;
+            }
+        }
+
+        void buildNode(ThreadPool* pool, Item* items, size_t begin, size_t end, size_t node, size_t leafSize) {
+            const size_t count = end - begin;
+            Box bounds;
+            for (size_t i = begin; i < end; ++i) bounds.expand(items[i].box);
+
+            if (count <= leafSize) {
+                nodes_[node] = {bounds, uint32_t(begin), uint32_t(count)};
+                return;
+            }
+
+            // Se parte por la mediana de los centroides en su eje más largo
+            Box centroids;
+            for (size_t i = begin; i < end; ++i) centroids.expand(items[i].centroid);
+            const size_t axis = centroids.longestAxis();
+
+            const size_t mid = begin + count / 2;
+            std::nth_element(items + begin, items + mid, items + end, [axis](const Item& a, const Item& b) {
+                return a.centroid.data[axis] < b.centroid.data[axis];
+            });
+
+            const size_t right = node + 1 + detail::treeNodeCount(count / 2, leafSize);
+            nodes_[node] = {bounds, uint32_t(right), 0};
+            detail::buildChildren(pool, count,
+                [&] { buildNode(pool, items, begin, mid, node + 1, leafSize); },
+                [&] { buildNode(pool, items, mid, end, right, leafSize); });
+        }
+
+        Alloc alloc_;
+        std::vector<Node, Rebind<Node>> nodes_;
+        std::vector<Box, Rebind<Box>> boxes_;
+        std::vector<uint32_t, Rebind<uint32_t>> indices_;
+    };
+
+} // namespace TinyGeo
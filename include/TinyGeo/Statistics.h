@@ -0,0 +1,294 @@
+#pragma once
+
+// Reducciones fusionadas sobre arrays de Vector<T, N>: caja, suma/centroide
+// y suma de productos exteriores/covarianza en una sola pasada por memoria.
+//
+//   auto s = stats::reduce<stats::Bounds | stats::Outer>(execution::par, Span(points));
+//   AABB3f box = s.bounds();
+//   Vector<float, 3> c = s.centroid();
+//   Matrix3f cov = s.covariance(); // PCA
+//
+// Los campos (Min, Max, Sum, Outer) se eligen en compilación: los que no se
+// piden no generan código en el loop. Outer implica Sum, porque la suma de
+// productos exteriores se guarda centrada en la media.
+//
+// Cada hilo acumula en su propio Accumulator y al final los parciales se
+// combinan con merge(), en orden de chunk. Para hilos propios:
+//
+//   stats::Accumulator<float, 3, stats::All> local; // Uno por hilo
+//   local.add(Span(myPoints));
+//   total.merge(local);                               // Bajo el lock del llamador
+//
+// Precisión: medias y co-momentos se acumulan en double. Cada bloque de
+// kBlock puntos suma desplazado a su primer punto y se combina con la
+// fórmula de Chan et al.; la varianza no sufre la cancelación de
+// sum(p^2) - n * media^2 aunque la nube esté lejos del origen.
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "TinyGeo/AABB.h"
+#include "TinyGeo/Matrix.h"
+#include "TinyGeo/ParallelBatch.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/ThreadPool.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+namespace stats {
+
+    // Campos de la reducción, combinables con |
+    enum Field : unsigned {
+        Min = 1u << 0,
+        Max = 1u << 1,
+        Sum = 1u << 2,   // Suma y centroide
+        Outer = 1u << 3, // Suma de p p^T, scatter y covarianza (implica Sum)
+        Bounds = Min | Max,
+        All = Min | Max | Sum | Outer,
+    };
+
+    // --- 1. ACUMULADOR ---
+
+    template <typename T, size_t N, unsigned F>
+    class Accumulator {
+        static_assert(F != 0 && (F & ~unsigned(All)) == 0, "Unknown stats field");
+
+        static constexpr bool kMin = (F & Min) != 0;
+        static constexpr bool kMax = (F & Max) != 0;
+        static constexpr bool kOuter = (F & Outer) != 0;
+        static constexpr bool kSum = (F & (Sum | Outer)) != 0;
+
+    public:
+        using value_type = T;
+        static constexpr size_t static_size = N;
+        static constexpr unsigned fields = kSum ? (F | Sum) : F;
+
+        // Puntos por bloque desplazado: acota el rango de las sumas locales
+        static constexpr size_t kBlock = 1024;
+
+        constexpr Accumulator() = default;
+
+        // --- Acumulación ---
+
+        template <typename S>
+        void add(const Vector<T, N, S>& p) {
+            addBlock(&p, 1);
+        }
+
+        template <typename V>
+        void add(Span<V> points) {
+            using Tr = VectorTraits<std::remove_const_t<V>>;
+            static_assert(Tr::isVector && std::is_same_v<typename Tr::scalar_type, T> && Tr::size == N,
+                          "stats::Accumulator requires spans of matching TinyGeo::Vector");
+            for (size_t b = 0; b < points.size(); b += kBlock) {
+                addBlock(points.data() + b, std::min(kBlock, points.size() - b));
+            }
+        }
+
+        // Combina con el acumulado de otro hilo / chunk
+        void merge(const Accumulator& o) {
+            if (o.count_ == 0) return;
+            if constexpr (kMin) {
+                for (size_t k = 0; k < N; ++k) box_.lo.data[k] = std::min(box_.lo.data[k], o.box_.lo.data[k]);
+            }
+            if constexpr (kMax) {
+                for (size_t k = 0; k < N; ++k) box_.hi.data[k] = std::max(box_.hi.data[k], o.box_.hi.data[k]);
+            }
+            if constexpr (kSum) {
+                mergeMoments(o.count_, o.mean_, o.m2_);
+            }
+            count_ += o.count_;
+        }
+
+        // --- Resultados ---
+
+        uint64_t count() const { return count_; }
+
+        // Caja de los puntos (vacía si no hay ninguno)
+        AABB<T, N> bounds() const {
+            static_assert(kMin && kMax, "bounds() requires stats::Bounds");
+            return box_;
+        }
+
+        Vector<T, N> lo() const {
+            static_assert(kMin, "lo() requires stats::Min");
+            return box_.lo;
+        }
+
+        Vector<T, N> hi() const {
+            static_assert(kMax, "hi() requires stats::Max");
+            return box_.hi;
+        }
+
+        Vector<T, N> sum() const {
+            static_assert(kSum, "sum() requires stats::Sum");
+            Vector<T, N> s;
+            for (size_t k = 0; k < N; ++k) s.data[k] = T(mean_[k] * double(count_));
+            return s;
+        }
+
+        // Media de los puntos (cero si no hay ninguno)
+        Vector<T, N> centroid() const {
+            static_assert(kSum, "centroid() requires stats::Sum");
+            Vector<T, N> c;
+            for (size_t k = 0; k < N; ++k) c.data[k] = T(mean_[k]);
+            return c;
+        }
+
+        // sum(p p^T)
+        Matrix<T, N, N> outerSum() const {
+            static_assert(kOuter, "outerSum() requires stats::Outer");
+            return toMatrix([&](size_t r, size_t c) { return m2(r, c) + double(count_) * mean_[r] * mean_[c]; });
+        }
+
+        // sum((p - c)(p - c)^T), c = centroid()
+        Matrix<T, N, N> scatter() const {
+            static_assert(kOuter, "scatter() requires stats::Outer");
+            return toMatrix([&](size_t r, size_t c) { return m2(r, c); });
+        }
+
+        // Covarianza poblacional: scatter() / count() (cero si no hay puntos)
+        Matrix<T, N, N> covariance() const {
+            static_assert(kOuter, "covariance() requires stats::Outer");
+            const double inv = count_ ? 1.0 / double(count_) : 0.0;
+            return toMatrix([&](size_t r, size_t c) { return m2(r, c) * inv; });
+        }
+
+    private:
+        using Moments = std::array<double, kOuter ? N * N : 0>;
+
+        // Solo se acumula el triángulo superior (r <= c)
+        double m2(size_t r, size_t c) const { return r <= c ? m2_[r * N + c] : m2_[c * N + r]; }
+
+        template <typename Fn>
+        static Matrix<T, N, N> toMatrix(Fn&& fn) {
+            Matrix<T, N, N> m;
+            for (size_t r = 0; r < N; ++r) {
+                for (size_t c = 0; c < N; ++c) m.rows[r].data[c] = T(fn(r, c));
+            }
+            return m;
+        }
+
+        template <typename V>
+        void addBlock(const V* p, size_t n) {
+            if (n == 0) return;
+            if constexpr (kMin || kMax) {
+                for (size_t i = 0; i < n; ++i) {
+                    for (size_t k = 0; k < N; ++k) {
+                        if constexpr (kMin) box_.lo.data[k] = std::min(box_.lo.data[k], p[i].data[k]);
+                        if constexpr (kMax) box_.hi.data[k] = std::max(box_.hi.data[k], p[i].data[k]);
+                    }
+                }
+            }
+            if constexpr (kSum) {
+                // Sumas desplazadas al primer punto del bloque
+                double shift[N], s[N] = {};
+                Moments q = {};
+                for (size_t k = 0; k < N; ++k) shift[k] = double(p[0].data[k]);
+                for (size_t i = 0; i < n; ++i) {
+                    double d[N];
+                    for (size_t k = 0; k < N; ++k) {
+                        d[k] = double(p[i].data[k]) - shift[k];
+                        s[k] += d[k];
+                    }
+                    if constexpr (kOuter) {
+                        for (size_t r = 0; r < N; ++r) {
+                            for (size_t c = r; c < N; ++c) q[r * N + c] += d[r] * d[c];
+                        }
+                    }
+                }
+                std::array<double, N> mean;
+                const double inv = 1.0 / double(n);
+                for (size_t k = 0; k < N; ++k) mean[k] = shift[k] + s[k] * inv;
+                if constexpr (kOuter) {
+                    for (size_t r = 0; r < N; ++r) {
+                        for (size_t c = r; c < N; ++c) q[r * N + c] -= s[r] * s[c] * inv;
+                    }
+                }
+                mergeMoments(n, mean, q);
+            }
+            count_ += n;
+        }
+
+        // Chan et al.: (na, ma, Ma) + (nb, mb, Mb) con delta = mb - ma
+        //   m = ma + delta * nb / n,  M = Ma + Mb + delta delta^T * na * nb / n
+        // count_ todavía es na
+        void mergeMoments(uint64_t nb, const std::array<double, N>& meanB, const Moments& m2B) {
+            const double na = double(count_), total = na + double(nb);
+            const double wb = double(nb) / total;
+            double delta[N];
+            for (size_t k = 0; k < N; ++k) {
+                delta[k] = meanB[k] - mean_[k];
+                mean_[k] += delta[k] * wb;
+            }
+            if constexpr (kOuter) {
+                const double w = na * wb;
+                for (size_t r = 0; r < N; ++r) {
+                    for (size_t c = r; c < N; ++c) m2_[r * N + c] += m2B[r * N + c] + delta[r] * delta[c] * w;
+                }
+            }
+        }
+
+        uint64_t count_ = 0;
+        AABB<T, N> box_;
+        std::array<double, N> mean_ = {};
+        Moments m2_ = {};
+    };
+
+namespace detail {
+
+    // Elementos mínimos por chunk paralelo: por debajo la combinación y el
+    // reparto pesan más que el loop
+    inline constexpr size_t kMinChunk = 16 * 1024;
+    inline constexpr size_t kChunksPerThread = 4;
+
+    template <unsigned F, typename V>
+    using AccumulatorFor = Accumulator<typename VectorTraits<std::remove_const_t<V>>::scalar_type,
+                                       VectorTraits<std::remove_const_t<V>>::size, F>;
+
+    // Serie si pool es nullptr. Los parciales se combinan en orden de chunk:
+    // mismo resultado para el mismo pool y la misma entrada.
+    template <unsigned F, typename V>
+    AccumulatorFor<F, V> reduce(ThreadPool* pool, Span<V> points) {
+        AccumulatorFor<F, V> total;
+        const size_t n = points.size();
+        const size_t chunks =
+            pool ? std::min(pool->concurrency() * kChunksPerThread, (n + kMinChunk - 1) / kMinChunk) : 1;
+        if (chunks <= 1) {
+            total.add(points);
+            return total;
+        }
+        std::vector<AccumulatorFor<F, V>> partial(chunks);
+        pool->parallelFor(chunks, 1, [&](size_t b, size_t e) {
+            for (size_t c = b; c < e; ++c) {
+                // Acumulador en la pila del hilo: sin false sharing en partial
+                AccumulatorFor<F, V> local;
+                local.add(points.subspan(n * c / chunks, n * (c + 1) / chunks - n * c / chunks));
+                partial[c] = local;
+            }
+        });
+        for (const auto& p : partial) total.merge(p);
+        return total;
+    }
+
+} // namespace detail
+
+    // --- 2. REDUCCIONES SOBRE SPANS ---
+
+    template <unsigned F, typename V>
+    detail::AccumulatorFor<F, V> reduce(Span<V> points) {
+        return detail::reduce<F>(nullptr, points);
+    }
+
+    template <unsigned F, typename V>
+    detail::AccumulatorFor<F, V> reduce(const execution::ParallelPolicy& policy, Span<V> points) {
+        return detail::reduce<F>(&policy.resolve(), points);
+    }
+
+} // namespace stats
+} // namespace TinyGeo
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace TinyGeo {
+
+    // Políticas de almacenamiento para Vector<T, N, Storage>.
+    // Cada política decide cuántos carriles (lanes) ocupa el array 'data'
+    // y con qué alineación. Los carriles extra (padding) se mantienen en cero,
+    // así que dot/normSq/+=/*= pueden operar sobre el ancho completo.
+
+    // Por defecto: exactamente N elementos, alineación natural.
+    // sizeof(Vector<float, 3>) == 12. Es el layout histórico de TinyGeo.
+    struct PackedStorage {
+        template <typename T, size_t N>
+        static constexpr size_t lanes = N;
+
+        template <typename T, size_t N>
+        static constexpr size_t alignment = alignof(std::array<T, N>);
+    };
+
+    // Opt-in: N=3 se rellena a 4 carriles y el vector se alinea a su tamaño
+    // (16 bytes para float, 32 para double) cuando es potencia de dos.
+    // Así un Vector<float, 3, AlignedStorage> ocupa exactamente un registro
+    // SSE/NEON y un array de ellos nunca cruza una línea de caché.
+    struct AlignedStorage {
+        template <typename T, size_t N>
+        static constexpr size_t lanes = (N == 3) ? 4 : N;
+
+    private:
+        static constexpr bool isPow2(size_t v) { return v != 0 && (v & (v - 1)) == 0; }
+
+        template <typename T, size_t N>
+        static constexpr size_t bytes = lanes<T, N> * sizeof(T);
+
+    public:
+        template <typename T, size_t N>
+        static constexpr size_t alignment =
+            (isPow2(bytes<T, N>) && bytes<T, N> <= 64) ? bytes<T, N> : alignof(std::array<T, N>);
+    };
+
+} // namespace TinyGeo
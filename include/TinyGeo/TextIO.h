@@ -0,0 +1,229 @@
+#pragma once
+
+// Texto por lotes para arrays de Vector, sin iostreams ni locale.
+//
+// Una línea por vector, con el mismo aspecto que operator<<:
+//
+//   [1.5, -2, 3.25]\n
+//
+// Los escalares usan std::to_chars / std::from_chars: representación más
+// corta que se relee al mismo bit (round trip exacto). Todo escribe en
+// buffers del llamador; maxChars<V>() da el peor caso por vector.
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "TinyGeo/ParallelBatch.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/ThreadPool.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+namespace io {
+
+    struct ToCharsResult {
+        char* ptr;      // Primer byte sin escribir
+        size_t count;   // Vectores escritos completos
+        std::errc ec;   // value_too_large si el buffer se quedó corto
+    };
+
+    struct FromCharsResult {
+        const char* ptr; // Primer byte sin consumir (o posición del error)
+        size_t count;    // Vectores leídos
+        std::errc ec;    // invalid_argument / result_out_of_range en error
+    };
+
+namespace detail {
+
+    // Peor caso de un escalar en formato más corto
+    template <typename T>
+    constexpr size_t maxScalarChars() {
+        if constexpr (std::is_floating_point_v<T>) {
+            // signo + max_digits10 + punto + "e-" + 3 dígitos de exponente
+            return 1 + std::numeric_limits<T>::max_digits10 + 1 + 2 + 3;
+        } else {
+            return 1 + std::numeric_limits<T>::digits10 + 1;
+        }
+    }
+
+    inline const char* skipBlanks(const char* p, const char* last) {
+        while (p != last && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+        return p;
+    }
+
+    inline const char* skipSpace(const char* p, const char* last) {
+        while (p != last && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) ++p;
+        return p;
+    }
+
+    // "[a, b, c]" -> v. Devuelve nullptr si la sintaxis no encaja.
+    template <typename V>
+    const char* parseOne(const char* p, const char* last, V& v, std::errc& ec) {
+        using T = typename VectorTraits<V>::scalar_type;
+        constexpr size_t N = VectorTraits<V>::size;
+        if (p == last || *p != '[') {
+            ec = std::errc::invalid_argument;
+            return nullptr;
+        }
+        ++p;
+        for (size_t i = 0; i < N; ++i) {
+            p = skipBlanks(p, last);
+            T value{};
+            const std::from_chars_result r = std::from_chars(p, last, value);
+            if (r.ec != std::errc()) {
+                ec = r.ec;
+                return nullptr;
+            }
+            v.data[i] = value;
+            p = skipBlanks(r.ptr, last);
+            const char expected = (i + 1 < N) ? ',' : ']';
+            if (p == last || *p != expected) {
+                ec = std::errc::invalid_argument;
+                return nullptr;
+            }
+            ++p;
+        }
+        return p;
+    }
+
+} // namespace detail
+
+    // Bytes máximos de una línea "[...]\n" para V
+    template <typename V>
+    constexpr size_t maxChars() {
+        using T = typename VectorTraits<V>::scalar_type;
+        constexpr size_t N = VectorTraits<V>::size;
+        return 2 + N * detail::maxScalarChars<T>() + (N - 1) * 2 + 1;
+    }
+
+    // --- FORMATEO ---
+
+    // Escribe tantos vectores completos como quepan en [first, last)
+    template <typename V>
+    ToCharsResult toChars(char* first, char* last, Span<V> vectors) {
+        constexpr size_t N = VectorTraits<V>::size;
+        char* p = first;
+        for (size_t k = 0; k < vectors.size(); ++k) {
+            const V& v = vectors.data()[k];
+            char* line = p;
+            bool ok = p != last;
+            if (ok) *p++ = '[';
+            for (size_t i = 0; ok && i < N; ++i) {
+                const std::to_chars_result r = std::to_chars(p, last, v.data[i]);
+                ok = r.ec == std::errc() && last - r.ptr >= 2; // ", " o "]\n"
+                if (!ok) break;
+                p = r.ptr;
+                if (i + 1 < N) {
+                    *p++ = ',';
+                    *p++ = ' ';
+                }
+            }
+            if (!ok) {
+                return {line, k, std::errc::value_too_large};
+            }
+            *p++ = ']';
+            *p++ = '\n';
+        }
+        return {p, vectors.size(), std::errc()};
+    }
+
+    // Volcado a un ostream en bloques de 64 KiB: una llamada a write() por
+    // bloque en lugar de varias por escalar.
+    template <typename V>
+    std::ostream& writeText(std::ostream& os, Span<V> vectors) {
+        constexpr size_t kBufferBytes = 64 * 1024;
+        static_assert(kBufferBytes >= maxChars<std::remove_const_t<V>>(), "Buffer too small for one vector");
+        std::vector<char> buffer(kBufferBytes);
+        while (!vectors.empty()) {
+            const ToCharsResult r = toChars(buffer.data(), buffer.data() + buffer.size(), vectors);
+            os.write(buffer.data(), std::streamsize(r.ptr - buffer.data()));
+            vectors = vectors.subspan(r.count, vectors.size() - r.count);
+        }
+        return os;
+    }
+
+    // --- PARSEO ---
+
+    // Lee hasta out.size() vectores de [first, last). Acepta espacios y
+    // líneas vacías entre vectores.
+    template <typename V>
+    FromCharsResult fromChars(const char* first, const char* last, Span<V> out) {
+        const char* p = detail::skipSpace(first, last);
+        size_t count = 0;
+        while (p != last && count < out.size()) {
+            std::errc ec{};
+            const char* next = detail::parseOne(p, last, out.data()[count], ec);
+            if (!next) return {p, count, ec};
+            ++count;
+            p = detail::skipSpace(next, last);
+        }
+        return {p, count, std::errc()};
+    }
+
+    // Parseo paralelo del texto completo a 'out' (redimensionado).
+    //   1) El texto se parte en chunks que empiezan al inicio de una línea.
+    //   2) Cada chunk cuenta sus '[' (un vector por '['): offsets de salida.
+    //   3) Cada chunk se parsea directamente en su posición final.
+    // En error, ptr señala el primer fallo en orden de texto.
+    template <typename V, typename A>
+    FromCharsResult fromCharsParallel(const execution::ParallelPolicy& policy, const char* first, const char* last,
+                                      std::vector<V, A>& out) {
+        ThreadPool& pool = policy.resolve();
+        constexpr size_t kMinChunkBytes = 256 * 1024;
+        const size_t bytes = size_t(last - first);
+        const size_t chunks = std::max<size_t>(1, std::min(pool.concurrency() * 4, bytes / kMinChunkBytes));
+
+        // Fronteras alineadas a línea: cada corte avanza hasta tras un '\n'
+        std::vector<const char*> bounds(chunks + 1);
+        bounds[0] = first;
+        bounds[chunks] = last;
+        for (size_t c = 1; c < chunks; ++c) {
+            const char* cut = std::max(bounds[c - 1], first + bytes * c / chunks);
+            cut = std::find(cut, last, '\n');
+            bounds[c] = cut == last ? last : cut + 1;
+        }
+
+        std::vector<size_t> offsets(chunks + 1, 0);
+        pool.parallelFor(chunks, 1, [&](size_t b, size_t e) {
+            for (size_t c = b; c < e; ++c) {
+                offsets[c + 1] = size_t(std::count(bounds[c], bounds[c + 1], '['));
+            }
+        });
+        for (size_t c = 0; c < chunks; ++c) offsets[c + 1] += offsets[c];
+        out.resize(offsets[chunks]);
+
+        std::vector<FromCharsResult> results(chunks);
+        pool.parallelFor(chunks, 1, [&](size_t b, size_t e) {
+            for (size_t c = b; c < e; ++c) {
+                const size_t expected = offsets[c + 1] - offsets[c];
+                Span<V> dst(out.data() + offsets[c], expected);
+                results[c] = fromChars(bounds[c], bounds[c + 1], dst);
+                if (results[c].ec == std::errc() && results[c].ptr != bounds[c + 1]) {
+                    results[c].ec = std::errc::invalid_argument; // Texto sobrante
+                }
+            }
+        });
+
+        for (size_t c = 0; c < chunks; ++c) {
+            if (results[c].ec != std::errc()) {
+                out.resize(offsets[c] + results[c].count);
+                return {results[c].ptr, out.size(), results[c].ec};
+            }
+        }
+        return {last, out.size(), std::errc()};
+    }
+
+    template <typename V, typename A>
+    FromCharsResult fromCharsParallel(ThreadPool& pool, const char* first, const char* last, std::vector<V, A>& out) {
+        return fromCharsParallel(execution::on(pool), first, last, out);
+    }
+
+} // namespace io
+} // namespace TinyGeo
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace TinyGeo {
+
+    // Pool de hilos con robo de trabajo (work stealing) para los kernels
+    // paralelos de TinyGeo.
+    //
+    // Cada participante tiene su propia cola de chunks. parallelFor reparte
+    // el rango en bloques contiguos de chunks, uno por cola (localidad de
+    // caché). Cada hilo consume su cola por el frente; cuando se vacía roba
+    // por el fondo de la cola de otro, así que los hilos rápidos ayudan a
+    // los lentos sin un reparto central.
+    //
+    // El hilo que llama a parallelFor también trabaja (no se queda bloqueado
+    // esperando), lo que además hace seguro llamar a parallelFor de forma
+    // anidada desde dentro de una tarea.
+    class ThreadPool {
+    public:
+        // threadCount = hilos de trabajo adicionales al hilo llamador
+        explicit ThreadPool(size_t threadCount = defaultThreadCount())
+            : queues_(threadCount + 1) {
+            for (auto& q : queues_) {
+                q = std::make_unique<Queue>();
+            }
+            threads_.reserve(threadCount);
+            for (size_t i = 0; i < threadCount; ++i) {
+                threads_.emplace_back([this, i] { workerLoop(i); });
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex_);
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (auto& t : threads_) {
+                t.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // Hilos que ejecutan un parallelFor: los del pool más el llamador
+        size_t concurrency() const { return threads_.size() + 1; }
+
+        // Hardware menos uno: el hilo llamador completa la cuenta
+        static size_t defaultThreadCount() {
+            const size_t hw = std::thread::hardware_concurrency();
+            return hw > 1 ? hw - 1 : 0;
+        }
+
+        // Pool compartido del proceso (se crea en el primer uso)
+        static ThreadPool& global() {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        // Ejecuta fn(begin, end) sobre [0, count) en chunks de 'grain'
+        // elementos (el último puede ser menor). Bloquea hasta terminar.
+        // fn no debe lanzar excepciones.
+        template <typename Fn>
+        void parallelFor(size_t count, size_t grain, Fn&& fn) {
+            if (count == 0) return;
+            grain = std::max<size_t>(grain, 1);
+            const size_t chunks = (count + grain - 1) / grain;
+            if (chunks == 1 || threads_.empty()) {
+                fn(size_t(0), count);
+                return;
+            }
+
+            using F = std::remove_reference_t<Fn>;
+            Job job;
+            job.invoke = [](void* ctx, size_t b, size_t e) { (*static_cast<F*>(ctx))(b, e); };
+            job.context = const_cast<void*>(static_cast<const void*>(std::addressof(fn)));
+            job.remaining.store(chunks, std::memory_order_relaxed);
+
+            {
+                // Publicar bajo el mutex de espera para no perder notificaciones.
+                // Se cuenta antes de encolar para que 'pending_' nunca quede
+                // por debajo del número real de chunks en las colas.
+                std::lock_guard<std::mutex> lock(sleepMutex_);
+                pending_.fetch_add(chunks, std::memory_order_release);
+            }
+
+            // Bloques contiguos de chunks por cola: el chunk c va a la cola c*Q/chunks
+            const size_t queueCount = queues_.size();
+            size_t c = 0;
+            for (size_t q = 0; q < queueCount; ++q) {
+                const size_t last = (q + 1) * chunks / queueCount;
+                if (c == last) continue;
+                std::lock_guard<std::mutex> lock(queues_[q]->mutex);
+                for (; c < last; ++c) {
+                    const size_t begin = c * grain;
+                    queues_[q]->tasks.push_back({&job, begin, std::min(begin + grain, count)});
+                }
+            }
+            wake_.notify_all();
+
+            // El llamador ayuda (y roba) hasta que el job completo termina
+            const size_t self = currentQueue();
+            while (job.remaining.load(std::memory_order_acquire) > 0) {
+                if (!runOne(self)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+    private:
+        struct Job {
+            void (*invoke)(void*, size_t, size_t) = nullptr;
+            void* context = nullptr;
+            std::atomic<size_t> remaining{0};
+        };
+
+        struct Task {
+            Job* job;
+            size_t begin;
+            size_t end;
+        };
+
+        // Alineada a línea de caché: los mutex de colas vecinas no comparten línea
+        struct alignas(64) Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        // Cola propia del hilo actual. Los hilos externos al pool comparten
+        // la última cola (la del "llamador").
+        size_t currentQueue() const {
+            return tlsPool_ == this ? tlsIndex_ : queues_.size() - 1;
+        }
+
+        bool popFront(size_t q, Task& out) {
+            std::lock_guard<std::mutex> lock(queues_[q]->mutex);
+            if (queues_[q]->tasks.empty()) return false;
+            out = queues_[q]->tasks.front();
+            queues_[q]->tasks.pop_front();
+            return true;
+        }
+
+        bool stealBack(size_t q, Task& out) {
+            std::lock_guard<std::mutex> lock(queues_[q]->mutex);
+            if (queues_[q]->tasks.empty()) return false;
+            out = queues_[q]->tasks.back();
+            queues_[q]->tasks.pop_back();
+            return true;
+        }
+
+        // Ejecuta un chunk: primero de la cola propia, si no, robado
+        bool runOne(size_t self) {
+            Task task{};
+            bool found = popFront(self, task);
+            for (size_t i = 1; !found && i < queues_.size(); ++i) {
+                found = stealBack((self + i) % queues_.size(), task);
+            }
+            if (!found) return false;
+
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            task.job->invoke(task.job->context, task.begin, task.end);
+            // Último acceso al job: tras esto el llamador puede destruirlo
+            task.job->remaining.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+
+        void workerLoop(size_t index) {
+            tlsPool_ = this;
+            tlsIndex_ = index;
+            for (;;) {
+                if (runOne(index)) continue;
+                std::unique_lock<std::mutex> lock(sleepMutex_);
+                wake_.wait(lock, [this] {
+                    return stop_ || pending_.load(std::memory_order_acquire) > 0;
+                });
+                if (stop_ && pending_.load(std::memory_order_acquire) == 0) return;
+            }
+        }
+
+        std::vector<std::unique_ptr<Queue>> queues_;
+        std::vector<std::thread> threads_;
+
+        std::mutex sleepMutex_;
+        std::condition_variable wake_;
+        std::atomic<size_t> pending_{0}; // Chunks publicados aún sin tomar
+        bool stop_ = false;
+
+        static inline thread_local const ThreadPool* tlsPool_ = nullptr;
+        static inline thread_local size_t tlsIndex_ = 0;
+    };
+
+} // namespace TinyGeo
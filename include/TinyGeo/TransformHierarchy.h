@@ -0,0 +1,282 @@
+#pragma once
+
+// Jerarquía de transformaciones (scene graph) con caché de matrices de
+// mundo y recálculo incremental.
+//
+//   TransformHierarchy<float> scene;
+//   auto body = scene.add(Transform<float>{});
+//   auto arm = scene.add(Transform<float>{Vector<float, 3>(1, 0, 0)}, body);
+//   scene.update();                           // Todo (primera vez)
+//   scene.setLocal(arm, armPose);             // Marca 'arm' y su subárbol
+//   scene.update();                           // Solo recalcula ese subárbol
+//   Vector<float, 3> p = scene.worldPosition(arm);
+//
+// Los nodos se guardan planos en preorden (DFS): el padre siempre precede
+// a sus hijos y cada subárbol es un rango contiguo [slot, end). update()
+// ordena los nodos marcados y recalcula solo sus rangos, en un barrido
+// hacia delante donde cada padre ya está actualizado; en una escena casi
+// estática el coste es proporcional a lo que se movió, no a la escena.
+//
+// Los NodeId que devuelve add() son estables. Añadir nodos rompe el
+// preorden: el siguiente update() reordena (O(n)) y recalcula todo.
+// world() refleja el último update().
+//
+// Solo transformaciones afines: la última fila de cada matriz local debe
+// ser (0, 0, 0, 1). La composición la da por supuesta (ver composeAffine)
+// y una matriz proyectiva daría matrices de mundo incorrectas; add() y
+// setLocal() lo comprueban con assert.
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "TinyGeo/Matrix.h"
+#include "TinyGeo/Quaternion.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+
+    // Transformación local TRS: p' = translation + rotation * (scale * p)
+    template <typename T>
+    struct Transform {
+        Vector<T, 3> translation;
+        Quaternion<T> rotation;
+        Vector<T, 3> scale{T(1), T(1), T(1)};
+
+        // Afín 4x4 equivalente (última fila 0, 0, 0, 1)
+        constexpr Matrix<T, 4, 4> toMatrix() const {
+            const Matrix<T, 3, 3> r = rotation.toMatrix();
+            Matrix<T, 4, 4> m;
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 3; ++j) m.rows[i][j] = r.rows[i][j] * scale[j];
+                m.rows[i][3] = translation[i];
+            }
+            m.rows[3][3] = T(1);
+            return m;
+        }
+    };
+
+namespace detail {
+
+    // Última fila exactamente (0, 0, 0, 1), como la deja Transform::toMatrix()
+    template <typename T>
+    constexpr bool isAffine(const Matrix<T, 4, 4>& m) {
+        return m.rows[3].data[0] == T(0) && m.rows[3].data[1] == T(0) && m.rows[3].data[2] == T(0) &&
+               m.rows[3].data[3] == T(1);
+    }
+
+    // out = parent * local para afines 4x4. Cada fila de la salida es una
+    // combinación de las filas de 'local': 3 multiply-add de Vector<T, 4>
+    // (un registro SIMD por fila en float) en lugar de 64 productos escalares.
+    // 'out' no puede ser 'parent' ni 'local'.
+    template <typename T>
+    inline void composeAffine(const Matrix<T, 4, 4>& parent, const Matrix<T, 4, 4>& local, Matrix<T, 4, 4>& out) {
+        for (size_t r = 0; r < 3; ++r) {
+            const Vector<T, 4>& p = parent.rows[r];
+            Vector<T, 4> row = local.rows[0] * p.data[0];
+            row += local.rows[1] * p.data[1];
+            row += local.rows[2] * p.data[2];
+            row.data[3] += p.data[3]; // local.rows[3] = (0, 0, 0, 1)
+            out.rows[r] = row;
+        }
+        out.rows[3] = parent.rows[3];
+    }
+
+} // namespace detail
+
+    template <typename T>
+    class TransformHierarchy {
+    public:
+        using value_type = T;
+        using NodeId = uint32_t;
+        using Mat4 = Matrix<T, 4, 4>;
+
+        static constexpr NodeId kNoParent = std::numeric_limits<NodeId>::max();
+
+        // --- 1. CONSTRUCCIÓN ---
+
+        size_t size() const { return slot_.size(); }
+
+        void reserve(size_t n) {
+            slot_.reserve(n);
+            id_.reserve(n);
+            parent_.reserve(n);
+            end_.reserve(n);
+            local_.reserve(n);
+            world_.reserve(n);
+        }
+
+        // Nuevo nodo hijo de 'parent' (kNoParent = raíz). El padre debe existir.
+        NodeId add(const Mat4& local, NodeId parent = kNoParent) {
+            assert((parent == kNoParent || parent < size()) && "Parent node does not exist");
+            assert(detail::isAffine(local) && "TransformHierarchy only supports affine matrices");
+            const NodeId id = NodeId(size());
+            const uint32_t slot = uint32_t(size());
+            slot_.push_back(slot);
+            id_.push_back(id);
+            parent_.push_back(parent == kNoParent ? kNoParent : slot_[parent]);
+            end_.push_back(slot + 1);
+            local_.push_back(local);
+            world_.push_back(local);
+            layoutDirty_ = true;
+            return id;
+        }
+
+        NodeId add(const Transform<T>& local, NodeId parent = kNoParent) { return add(local.toMatrix(), parent); }
+
+        // --- 2. MODIFICACIÓN ---
+
+        // Cambia la transformación local y marca el subárbol del nodo
+        void setLocal(NodeId node, const Mat4& local) {
+            assert(node < size() && "Node does not exist");
+            assert(detail::isAffine(local) && "TransformHierarchy only supports affine matrices");
+            local_[slot_[node]] = local;
+            dirty_.push_back(slot_[node]);
+        }
+
+        void setLocal(NodeId node, const Transform<T>& local) { setLocal(node, local.toMatrix()); }
+
+        // Recalcula las matrices de mundo marcadas desde el último update().
+        // Devuelve cuántos nodos se recalcularon.
+        size_t update() {
+            if (layoutDirty_) {
+                relayout();
+                computeRange(0, uint32_t(size()));
+                dirty_.clear();
+                return size();
+            }
+            // Un nodo dentro de un rango ya recalculado (descendiente de otro
+            // marcado, o marcado dos veces) no se vuelve a procesar
+            std::sort(dirty_.begin(), dirty_.end());
+            size_t updated = 0;
+            uint32_t covered = 0;
+            for (uint32_t s : dirty_) {
+                if (s < covered) continue;
+                computeRange(s, end_[s]);
+                updated += end_[s] - s;
+                covered = end_[s];
+            }
+            dirty_.clear();
+            return updated;
+        }
+
+        // --- 3. CONSULTAS ---
+
+        NodeId parent(NodeId node) const {
+            assert(node < size() && "Node does not exist");
+            const uint32_t p = parent_[slot_[node]];
+            return p == kNoParent ? kNoParent : id_[p];
+        }
+
+        const Mat4& local(NodeId node) const {
+            assert(node < size() && "Node does not exist");
+            return local_[slot_[node]];
+        }
+
+        const Mat4& world(NodeId node) const {
+            assert(node < size() && "Node does not exist");
+            return world_[slot_[node]];
+        }
+
+        Vector<T, 3> worldPosition(NodeId node) const {
+            const Mat4& m = world(node);
+            return Vector<T, 3>(m.rows[0][3], m.rows[1][3], m.rows[2][3]);
+        }
+
+        // Nodos del subárbol de 'node', incluido él mismo (válido tras update())
+        size_t subtreeSize(NodeId node) const {
+            assert(node < size() && "Node does not exist");
+            return end_[slot_[node]] - slot_[node];
+        }
+
+    private:
+        // Padres antes que hijos: el de 'first' queda fuera del rango y ya
+        // está al día
+        void computeRange(uint32_t first, uint32_t last) {
+            for (uint32_t s = first; s < last; ++s) {
+                const uint32_t p = parent_[s];
+                if (p == kNoParent) {
+                    world_[s] = local_[s];
+                } else {
+                    detail::composeAffine(world_[p], local_[s], world_[s]);
+                }
+            }
+        }
+
+        // Reordena todos los arrays en preorden: hijos en orden de NodeId,
+        // raíces también. Hijos agrupados por padre con un counting sort.
+        void relayout() {
+            const size_t n = size();
+            std::vector<uint32_t> parentId(n), first(n + 1, 0), children(n);
+            for (size_t s = 0; s < n; ++s) {
+                parentId[id_[s]] = parent_[s] == kNoParent ? kNoParent : id_[parent_[s]];
+            }
+            for (size_t id = 0; id < n; ++id) {
+                if (parentId[id] != kNoParent) ++first[parentId[id] + 1];
+            }
+            for (size_t id = 0; id < n; ++id) first[id + 1] += first[id];
+            {
+                std::vector<uint32_t> next(first.begin(), first.end() - 1);
+                for (size_t id = 0; id < n; ++id) {
+                    if (parentId[id] != kNoParent) children[next[parentId[id]]++] = uint32_t(id);
+                }
+            }
+
+            std::vector<uint32_t> order; // Preorden de NodeId
+            order.reserve(n);
+            std::vector<uint32_t> newSlot(n), newEnd(n), stack;
+            for (size_t root = 0; root < n; ++root) {
+                if (parentId[root] != kNoParent) continue;
+                stack.push_back(uint32_t(root));
+                while (!stack.empty()) {
+                    const uint32_t id = stack.back();
+                    stack.pop_back();
+                    newSlot[id] = uint32_t(order.size());
+                    order.push_back(id);
+                    // Al revés para que salgan en orden de NodeId
+                    for (uint32_t c = first[id + 1]; c > first[id]; --c) stack.push_back(children[c - 1]);
+                }
+            }
+            assert(order.size() == n && "Hierarchy must be acyclic");
+
+            // Fin de subárbol: de hojas hacia la raíz (orden inverso)
+            for (size_t s = n; s-- > 0;) {
+                const uint32_t id = order[s];
+                newEnd[s] = uint32_t(s + 1);
+                for (uint32_t c = first[id]; c < first[id + 1]; ++c) {
+                    newEnd[s] = std::max(newEnd[s], newEnd[newSlot[children[c]]]);
+                }
+            }
+
+            std::vector<Mat4> local(n);
+            std::vector<uint32_t> parent(n);
+            for (size_t s = 0; s < n; ++s) {
+                const uint32_t id = order[s];
+                local[s] = local_[slot_[id]];
+                parent[s] = parentId[id] == kNoParent ? kNoParent : newSlot[parentId[id]];
+            }
+            local_.swap(local);
+            parent_.swap(parent);
+            slot_.swap(newSlot);
+            id_.swap(order);
+            end_.swap(newEnd);
+            layoutDirty_ = false;
+        }
+
+        // Indexados por NodeId
+        std::vector<uint32_t> slot_;
+        // Indexados por slot (preorden)
+        std::vector<NodeId> id_;
+        std::vector<uint32_t> parent_; // Slot del padre o kNoParent
+        std::vector<uint32_t> end_;    // Fin (exclusivo) del subárbol
+        std::vector<Mat4> local_;
+        std::vector<Mat4> world_;
+
+        std::vector<uint32_t> dirty_; // Slots marcados por setLocal()
+        bool layoutDirty_ = false;
+    };
+
+} // namespace TinyGeo
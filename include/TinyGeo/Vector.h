@@ -1,93 +1,186 @@
 #pragma once // Evita que el archivo se incluya múltiples veces
 
 #include <array>
-#include <iostream>
-#include <initializer_list>
+#include <iosfwd>
 #include <cassert>
 #include <cmath>
+#include <type_traits>
+#include <utility>
+
+#include "TinyGeo/Instrument.h"
+#include "TinyGeo/Simd.h"
+#include "TinyGeo/Storage.h"
+#include "TinyGeo/detail/FastMath.h"
+
+#if defined(TINYGEO_EXPRESSION_TEMPLATES)
+#include "TinyGeo/Expression.h"
+#endif
 
 namespace TinyGeo {
 
+namespace detail {
+
+    // From -> To sin narrowing: To{declval<From>()} es válido
+    template <typename From, typename To, typename = void>
+    struct isNonNarrowing : std::false_type {};
+
+    template <typename From, typename To>
+    struct isNonNarrowing<From, To, std::void_t<decltype(To{std::declval<From>()})>> : std::true_type {};
+
+    // Componentes aceptados por el constructor variadic: conversiones sin
+    // narrowing y, entre aritméticos, todo salvo coma flotante -> entero
+    // (Vector<float, 3>(1, 0, 0) y {1.0, 2.0, 3.0} siguen valiendo). Solo
+    // float -> int, que trunca, no compila: hay que convertir a mano.
+    template <typename From, typename To>
+    inline constexpr bool isComponentOf =
+        isNonNarrowing<From, To>::value ||
+        (std::is_arithmetic_v<From> && std::is_arithmetic_v<To> &&
+         !(std::is_floating_point_v<From> && std::is_integral_v<To>));
+
+} // namespace detail
+
     // T: Tipo de dato (float, double, int)
     // N: Dimensión (2, 3, 4...)
-    template <typename T, size_t N>
+    // Storage: Política de layout (ver Storage.h). PackedStorage por defecto;
+    //          AlignedStorage rellena N=3 a 4 carriles alineados.
+    template <typename T, size_t N, typename Storage = PackedStorage>
     class Vector {
+        // Carriles físicos del array (>= N). Los de padding valen siempre cero.
+        static constexpr size_t Lanes = Storage::template lanes<T, N>;
+        static constexpr size_t Align = Storage::template alignment<T, N>;
+        static_assert(Lanes >= N, "Storage policy must provide at least N lanes");
+
+        // (1e-8)^2: umbral de longitud casi nula de normalized(), al cuadrado
+        static constexpr T kFastMinSq = T(1e-16);
+
     public:
+        using value_type = T;
+        static constexpr size_t static_size = N;
+
         // --- 0. ACCESORES NOMBRADOS (Quality of Life) ---
         // Solo tienen sentido si N es suficiente, pero por simplicidad
         // los dejaremos disponibles. Usamos 'if constexpr' o asserts en producción,
         // aquí confiaremos en el uso correcto o check de rango del array.
         
-        T& x() { static_assert(N >= 1); return data[0]; }
-        const T& x() const { static_assert(N >= 1); return data[0]; }
+        constexpr T& x() { static_assert(N >= 1); return data[0]; }
+        constexpr const T& x() const { static_assert(N >= 1); return data[0]; }
 
-        T& y() { static_assert(N >= 2); return data[1]; }
-        const T& y() const { static_assert(N >= 2); return data[1]; }
+        constexpr T& y() { static_assert(N >= 2); return data[1]; }
+        constexpr const T& y() const { static_assert(N >= 2); return data[1]; }
 
-        T& z() { static_assert(N >= 3); return data[2]; }
-        const T& z() const { static_assert(N >= 3); return data[2]; }
+        constexpr T& z() { static_assert(N >= 3); return data[2]; }
+        constexpr const T& z() const { static_assert(N >= 3); return data[2]; }
         
         // (Opcional) Para coordenadas homogéneas w
-        T& w() { static_assert(N >= 4); return data[3]; }
-        const T& w() const { static_assert(N >= 4); return data[3]; }
+        constexpr T& w() { static_assert(N >= 4); return data[3]; }
+        constexpr const T& w() const { static_assert(N >= 4); return data[3]; }
 
         // --- 1. ALMACENAMIENTO ---
         // Usamos std::array subyacente. Es stack-allocated y seguro.
         // Lo hacemos público (o accesible) para facilitar operaciones futuras,
         // pero por ahora lo envolvemos.
-        std::array<T, N> data;
+        // Con PackedStorage es exactamente std::array<T, N>.
+        alignas(Align) std::array<T, Lanes> data;
 
         // --- 2. CONSTRUCTORES ---
         
         // Constructor por defecto: Vector<float, 3> v; (Inicia en 0 o basura según el compilador/versión)
         // Forzamos inicialización a cero para seguridad.
-        Vector() : data{} {}
-
-        // Constructor con lista: Vector<float, 3> v = {1.0, 2.0, 3.0};
-        Vector(std::initializer_list<T> list) {
-            assert(list.size() == N && "Initializer list size mismatch");
-            size_t i = 0;
-            for (const auto& element : list) {
-                data[i++] = element;
+        constexpr Vector() : data{} {}
+
+        // Por componentes: Vector<float, 3> v = {1.0, 2.0, 3.0};  o  v(1, 2, 3)
+        // Inicialización agregada directa del array (los carriles de padding
+        // quedan en cero): sin loop ni assert. Un número de componentes
+        // distinto de N, o uno que trunca (float -> int), no compila. Con
+        // N == 1 es explicit: un escalar no se convierte solo en Vector<T, 1>
+        // al resolver operator* y compañía.
+        template <typename... Args, size_t M = N,
+                  typename = std::enable_if_t<M != 1 && sizeof...(Args) == N && (detail::isComponentOf<Args, T> && ...)>>
+        constexpr Vector(Args... args) : data{static_cast<T>(args)...} {}
+
+        template <typename Arg, size_t M = N,
+                  typename = std::enable_if_t<M == 1 && detail::isComponentOf<Arg, T>>, typename = void>
+        constexpr explicit Vector(Arg arg) : data{static_cast<T>(arg)} {}
+
+        // Desde un array de N escalares: T raw[3] = {...}; Vector<T, 3> v(raw);
+        constexpr explicit Vector(const T (&values)[N]) : Vector(values, std::make_index_sequence<N>{}) {}
+
+        // Conversión explícita entre políticas de almacenamiento
+        // (p.ej. Vector<float, 3> empaquetado -> Vector3A alineado)
+        template <typename OtherStorage>
+        constexpr explicit Vector(const Vector<T, N, OtherStorage>& other) : data{} {
+            for (size_t i = 0; i < N; ++i) {
+                data[i] = other[i];
             }
         }
 
-        // --- 3. ARITMÉTICA: ASIGNACIÓN COMPUESTA (Modifican *this) ---
+#if defined(TINYGEO_EXPRESSION_TEMPLATES)
+        // Evaluación de una expresión perezosa (ver Expression.h):
+        // todo el árbol se resuelve en este único loop.
+        template <typename E>
+        constexpr Vector(const expr::VecExpr<E>& e) : data{} {
+            assignFrom(e.self());
+        }
 
-        // Suma: v += other
-        Vector& operator+=(const Vector& other) {
+        template <typename E>
+        constexpr Vector& operator=(const expr::VecExpr<E>& e) {
+            assignFrom(e.self());
+            return *this;
+        }
+
+        template <typename E>
+        constexpr Vector& operator+=(const expr::VecExpr<E>& e) {
+            checkExpr<E>();
+            const E& ex = e.self();
             for (size_t i = 0; i < N; ++i) {
-                data[i] += other[i];
+                data[i] += ex[i];
             }
-            return *this; // Retornamos referencia para encadenar (a += b += c)
+            return *this;
         }
 
-        // Resta: v -= other
-        Vector& operator-=(const Vector& other) {
+        template <typename E>
+        constexpr Vector& operator-=(const expr::VecExpr<E>& e) {
+            checkExpr<E>();
+            const E& ex = e.self();
             for (size_t i = 0; i < N; ++i) {
-                data[i] -= other[i];
+                data[i] -= ex[i];
             }
             return *this;
         }
+#endif
+
+        // --- 3. ARITMÉTICA: ASIGNACIÓN COMPUESTA (Modifican *this) ---
+
+        // Suma: v += other
+        // Las operaciones delegan en detail::Dispatch<T, Lanes>: loop escalar por
+        // defecto (y en constexpr), intrínsecos SIMD para los tamaños comunes (ver Simd.h).
+        // Con padding, el kernel opera sobre todos los carriles: 0 + 0 = 0.
+        constexpr Vector& operator+=(const Vector& other) {
+            detail::Dispatch<T, Lanes>::add(data.data(), other.data.data());
+            return *this; // Retornamos referencia para encadenar (a += b += c)
+        }
+
+        // Resta: v -= other
+        constexpr Vector& operator-=(const Vector& other) {
+            detail::Dispatch<T, Lanes>::sub(data.data(), other.data.data());
+            return *this;
+        }
 
         // Multiplicación por Escalar: v *= scalar
         // Nota: No multiplicamos vectores entre sí (eso es producto punto/cruz)
-        Vector& operator*=(T scalar) {
-            for (size_t i = 0; i < N; ++i) {
-                data[i] *= scalar;
-            }
+        constexpr Vector& operator*=(T scalar) {
+            detail::Dispatch<T, Lanes>::scale(data.data(), scalar);
             return *this;
         }
 
         // División por Escalar: v /= scalar
-        Vector& operator/=(T scalar) {
+        constexpr Vector& operator/=(T scalar) {
             // Check senior: Evitar división por cero es responsabilidad del usuario
             // por ahora en matemáticas de alto rendimiento, pero podríamos poner un assert.
             assert(scalar != 0 && "Division by zero");
+            TINYGEO_COUNT(VectorDivAssign);
             T inv_scalar = T(1) / scalar; // Optimización: 1 división, N multiplicaciones
-            for (size_t i = 0; i < N; ++i) {
-                data[i] *= inv_scalar;
-            }
+            detail::Dispatch<T, Lanes>::scale(data.data(), inv_scalar);
             return *this;
         }
 
@@ -95,7 +188,7 @@ namespace TinyGeo {
         // --- 4. ACCESSORS (Lectura/Escritura) ---
 
         // Versión NO-CONST: Permite escribir (v[0] = 5.0)
-        T& operator[](size_t index) {
+        constexpr T& operator[](size_t index) {
             // En modo Debug (-g), .at() chequea límites. En Release, operator[] puro es más rápido.
             // Aquí usamos simple array access por performance, asumiendo responsabilidad.
             assert(index < N && "Index out of bounds");
@@ -104,7 +197,7 @@ namespace TinyGeo {
 
         // Versión CONST: Solo lectura (x = v[0])
         // Esto se llama automáticamente cuando el objeto es const.
-        const T& operator[](size_t index) const {
+        constexpr const T& operator[](size_t index) const {
             assert(index < N && "Index out of bounds");
             return data[index];
         }
@@ -119,102 +212,224 @@ namespace TinyGeo {
 
         // Producto Punto: Mide alineación.
         // Retorna T (escalar).
-        T dot(const Vector& other) const {
-            T sum = T(0);
-            for (size_t i = 0; i < N; ++i) {
-                sum += data[i] * other[i];
-            }
-            return sum;
+        constexpr T dot(const Vector& other) const {
+            return detail::Dispatch<T, Lanes>::dot(data.data(), other.data.data());
         }
 
         // Producto Cruz: Solo definido para N=3 en este contexto.
         // Retorna un vector perpendicular al plano definido por *this y other.
-        Vector<T, N> cross(const Vector<T, N>& other) const {
+        constexpr Vector cross(const Vector& other) const {
             static_assert(N == 3, "Cross product is only defined for 3D vectors (N=3)");
 
-            // Fórmula expandida usando nuestros nuevos accesores
-            return {
-                y() * other.z() - z() * other.y(),
-                z() * other.x() - x() * other.z(),
-                x() * other.y() - y() * other.x()
-            };
+            // Fórmula expandida (o shuffles SIMD) en detail::Kernels
+            Vector result;
+            detail::Dispatch<T, Lanes>::cross(data.data(), other.data.data(), result.data.data());
+            return result;
         }
 
         // Norma al Cuadrado (Magnitud^2)
         // Úsala siempre para comparaciones de distancia para evitar sqrt().
-        T normSq() const {
+        constexpr T normSq() const {
             return dot(*this); // v . v = |v|^2
         }
 
         // Norma Euclidiana (Magnitud)
         // Incluimos <cmath> arriba si no está.
-        T norm() const {
+        // En constexpr usa una raíz Newton-Raphson (std::sqrt no es constexpr en C++17).
+        constexpr T norm() const {
+            if (TINYGEO_IS_CONSTANT_EVALUATED()) {
+                return detail::sqrtConstexpr(normSq());
+            }
             return std::sqrt(normSq());
         }
 
         // Normalización: Retorna un NUEVO vector unitario (dirección pura).
         // No modifica el actual.
-        Vector normalized() const {
+        constexpr Vector normalized() const {
+            TINYGEO_COUNT(VectorNormalized);
             T len = norm();
             // Manejo de vector cero para evitar NaNs (Not a Number)
             // Usamos una tolerancia pequeña (epsilon)
             if (len < T(1e-8)) {
+                TINYGEO_COUNT(VectorNormalizedZero);
                 return Vector(); // Retorna vector cero si la longitud es casi nula
             }
             return (*this) / len; // Usa nuestro operador / escalar
         }
         
         // Mutador: Normaliza el vector actual
-        void normalize() {
+        constexpr void normalize() {
             *this = normalized();
         }
 
+        // --- 6b. VERSIONES RÁPIDAS (APROXIMADAS) ---
+        // Raíz inversa hardware + Newton: sin sqrt, sin división y sin saltos
+        // (el caso longitud cero es una selección). A cambio de unos pocos ULP:
+        // error relativo <= detail::FastMath<T>::kMaxRelError (~2^-21 en
+        // float con SIMD; ver detail/FastMath.h), más el redondeo de normSq().
+
+        // Norma aproximada. fastNorm() de un vector cero es exactamente 0.
+        constexpr T fastNorm() const {
+            const T sq = normSq();
+            // max() evita rsqrt(0) = inf, y 0 * rsqrt(tiny) = 0
+            return sq * detail::FastMath<T>::rsqrt(sq > kFastMinSq ? sq : kFastMinSq);
+        }
+
+        // Normalizado aproximado. Misma regla que normalized(): longitud < 1e-8
+        // devuelve el vector cero.
+        constexpr Vector fastNormalized() const {
+            const T sq = normSq();
+            TINYGEO_COUNT(VectorFastNormalized);
+            TINYGEO_COUNT_IF(sq < kFastMinSq, VectorFastNormalizedZero); // Sin rama si no se instrumenta
+            const T inv = detail::FastMath<T>::rsqrt(sq > kFastMinSq ? sq : kFastMinSq);
+            Vector result = *this;
+            result *= (sq < kFastMinSq ? T(0) : inv);
+            return result;
+        }
+
+    private:
+        template <size_t... I>
+        constexpr Vector(const T (&values)[N], std::index_sequence<I...>) : data{values[I]...} {}
+
+#if defined(TINYGEO_EXPRESSION_TEMPLATES)
+        template <typename E>
+        static constexpr void checkExpr() {
+            static_assert(E::size == N, "Expression dimension mismatch");
+            static_assert(std::is_same_v<typename E::value_type, T>, "Expression scalar type mismatch");
+        }
+
+        // Elemento a elemento: es seguro aunque *this aparezca en la expresión
+        template <typename E>
+        constexpr void assignFrom(const E& ex) {
+            checkExpr<E>();
+            for (size_t i = 0; i < N; ++i) {
+                data[i] = ex[i];
+            }
+        }
+#endif
+
     };
 
     // --- 7. ARITMÉTICA: OPERADORES BINARIOS (Crean nuevo Vector) ---
+    // Con TINYGEO_EXPRESSION_TEMPLATES los reemplazan los de Expression.h.
+#if !defined(TINYGEO_EXPRESSION_TEMPLATES)
+
+    // Cada operador tiene una versión que reutiliza un operando temporal
+    // (rvalue) como resultado: a + b + c no crea copias intermedias, y un
+    // lvalue se copia una sola vez. + es conmutativa bit a bit en IEEE, así
+    // que un rhs temporal puede acumular lhs; en - la resta parte de una
+    // copia de lhs.
 
     // Suma: v3 = v1 + v2
-    // Pasamos 'lhs' por valor (copia implícita) para reutilizarla
-    template <typename T, size_t N>
-    Vector<T, N> operator+(Vector<T, N> lhs, const Vector<T, N>& rhs) {
-        lhs += rhs; // Reutilizamos el operador miembro
-        return lhs;
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator+(const Vector<T, N, S>& lhs, const Vector<T, N, S>& rhs) {
+        Vector<T, N, S> result = lhs;
+        result += rhs; // Reutilizamos el operador miembro
+        return result;
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator+(Vector<T, N, S>&& lhs, const Vector<T, N, S>& rhs) {
+        lhs += rhs;
+        return std::move(lhs);
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator+(const Vector<T, N, S>& lhs, Vector<T, N, S>&& rhs) {
+        rhs += lhs;
+        return std::move(rhs);
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator+(Vector<T, N, S>&& lhs, Vector<T, N, S>&& rhs) {
+        lhs += rhs;
+        return std::move(lhs);
     }
 
     // Resta: v3 = v1 - v2
-    template <typename T, size_t N>
-    Vector<T, N> operator-(Vector<T, N> lhs, const Vector<T, N>& rhs) {
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator-(const Vector<T, N, S>& lhs, const Vector<T, N, S>& rhs) {
+        Vector<T, N, S> result = lhs;
+        result -= rhs;
+        return result;
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator-(Vector<T, N, S>&& lhs, const Vector<T, N, S>& rhs) {
         lhs -= rhs;
-        return lhs;
+        return std::move(lhs);
+    }
+
+    // lhs - rhs con el mismo kernel que -= (no -(rhs - lhs): conserva el
+    // signo de 0). Los kernels son de dos operandos (a -= b), así que el
+    // resultado se forma sobre una copia de lhs en lugar de en rhs.
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator-(const Vector<T, N, S>& lhs, Vector<T, N, S>&& rhs) {
+        Vector<T, N, S> result = lhs;
+        result -= rhs;
+        return result;
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator-(Vector<T, N, S>&& lhs, Vector<T, N, S>&& rhs) {
+        lhs -= rhs;
+        return std::move(lhs);
     }
 
     // Multiplicación Escalar (Derecha): v2 = v1 * 2.0
-    template <typename T, size_t N>
-    Vector<T, N> operator*(Vector<T, N> lhs, T scalar) {
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator*(const Vector<T, N, S>& lhs, T scalar) {
+        Vector<T, N, S> result = lhs;
+        result *= scalar;
+        return result;
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator*(Vector<T, N, S>&& lhs, T scalar) {
         lhs *= scalar;
-        return lhs;
+        return std::move(lhs);
     }
 
     // Multiplicación Escalar (Izquierda): v2 = 2.0 * v1
     // Esta es la razón por la que estos operadores están fuera de la clase.
     // Si fuera miembro, 'double' no tiene un método .operator*(Vector).
-    template <typename T, size_t N>
-    Vector<T, N> operator*(T scalar, Vector<T, N> rhs) {
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator*(T scalar, const Vector<T, N, S>& rhs) {
+        Vector<T, N, S> result = rhs;
+        result *= scalar;
+        return result;
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator*(T scalar, Vector<T, N, S>&& rhs) {
         rhs *= scalar;
-        return rhs;
+        return std::move(rhs);
     }
 
     // División Escalar: v2 = v1 / 2.0
-    template <typename T, size_t N>
-    Vector<T, N> operator/(Vector<T, N> lhs, T scalar) {
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator/(const Vector<T, N, S>& lhs, T scalar) {
+        Vector<T, N, S> result = lhs;
+        result /= scalar;
+        return result;
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> operator/(Vector<T, N, S>&& lhs, T scalar) {
         lhs /= scalar;
-        return lhs;
+        return std::move(lhs);
     }
 
+#endif // !TINYGEO_EXPRESSION_TEMPLATES
+
     // --- 8. VISUALIZACIÓN (Operator Overloading) ---
     // Permite hacer: std::cout << v << std::endl;
-    template <typename T, size_t N>
-    std::ostream& operator<<(std::ostream& os, const Vector<T, N>& v) {
+    // Plantilla sobre basic_ostream: todo el cuerpo es dependiente y se
+    // resuelve donde se usa, así que Vector.h solo necesita <iosfwd> (sin
+    // <iostream> ni sus objetos estáticos en TUs de nvcc / código device).
+    // Quien escribe en un stream ya incluye <ostream> o <iostream>.
+    template <typename CharT, typename Traits, typename T, size_t N, typename S>
+    std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const Vector<T, N, S>& v) {
         os << "[";
         for (size_t i = 0; i < N; ++i) {
             os << v[i];
@@ -225,14 +440,109 @@ namespace TinyGeo {
     }
 
     // Función libre para producto punto
-    template <typename T, size_t N>
-    T dot(const Vector<T, N>& a, const Vector<T, N>& b) {
+    template <typename T, size_t N, typename S>
+    constexpr T dot(const Vector<T, N, S>& a, const Vector<T, N, S>& b) {
         return a.dot(b);
     }
 
-    template <typename T, size_t N>
-    Vector<T, N> cross(const Vector<T, N>& a, const Vector<T, N>& b) {
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> cross(const Vector<T, N, S>& a, const Vector<T, N, S>& b) {
         return a.cross(b);
     }
 
+    // --- Funciones elemento a elemento ---
+    // Sin ramas: cada carril es un select (?:) que el compilador reduce a
+    // minps/maxps/blend. Se recorren todos los carriles físicos (padding
+    // incluido): con padding en cero el resultado sigue siendo cero.
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> min(const Vector<T, N, S>& a, const Vector<T, N, S>& b) {
+        Vector<T, N, S> r;
+        for (size_t i = 0; i < r.data.size(); ++i) {
+            r.data[i] = b.data[i] < a.data[i] ? b.data[i] : a.data[i];
+        }
+        return r;
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> max(const Vector<T, N, S>& a, const Vector<T, N, S>& b) {
+        Vector<T, N, S> r;
+        for (size_t i = 0; i < r.data.size(); ++i) {
+            r.data[i] = a.data[i] < b.data[i] ? b.data[i] : a.data[i];
+        }
+        return r;
+    }
+
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> abs(const Vector<T, N, S>& v) {
+        Vector<T, N, S> r;
+        for (size_t i = 0; i < r.data.size(); ++i) {
+            r.data[i] = v.data[i] < T(0) ? -v.data[i] : v.data[i];
+        }
+        return r;
+    }
+
+    // Cada componente acotada a [lo[i], hi[i]]
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> clamp(const Vector<T, N, S>& v, const Vector<T, N, S>& lo, const Vector<T, N, S>& hi) {
+        return min(max(v, lo), hi);
+    }
+
+    // Todas las componentes acotadas al mismo intervalo [lo, hi]
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> clamp(const Vector<T, N, S>& v, T lo, T hi) {
+        Vector<T, N, S> r;
+        for (size_t i = 0; i < N; ++i) {
+            const T c = v.data[i] < lo ? lo : v.data[i];
+            r.data[i] = hi < c ? hi : c;
+        }
+        return r;
+    }
+
+    // Interpolación lineal: a en t = 0, b en t = 1
+    template <typename T, size_t N, typename S>
+    constexpr Vector<T, N, S> lerp(const Vector<T, N, S>& a, const Vector<T, N, S>& b, T t) {
+        Vector<T, N, S> r;
+        for (size_t i = 0; i < r.data.size(); ++i) {
+            r.data[i] = a.data[i] + (b.data[i] - a.data[i]) * t;
+        }
+        return r;
+    }
+
+    // --- 9. TRAITS ---
+    // VectorTraits<V>: permite a los módulos genéricos (batch, SoA...) aceptar
+    // cualquier Vector<T, N, S> (const o no) y recuperar T, N y S.
+    template <typename V>
+    struct VectorTraits {
+        static constexpr bool isVector = false;
+    };
+
+    // Todo Vector es trivialmente copiable (memcpy / realloc / bulk moves en
+    // contenedores): los traits lo comprueban para cada instanciación que
+    // usan los módulos genéricos.
+    template <typename T, size_t N, typename S>
+    struct VectorTraits<Vector<T, N, S>> {
+        static_assert(std::is_trivially_copyable_v<Vector<T, N, S>>, "Vector must stay trivially copyable");
+        static_assert(std::is_nothrow_move_constructible_v<Vector<T, N, S>>, "Vector moves must be noexcept");
+        static constexpr bool isVector = true;
+        using scalar_type = T;
+        using storage_type = S;
+        static constexpr size_t size = N;
+        static constexpr size_t lanes = S::template lanes<T, N>; // Incluye padding
+    };
+
+    template <typename V>
+    struct VectorTraits<const V> : VectorTraits<V> {};
+
+    // --- 10. ALIAS ALINEADOS ---
+    // Vector3A: float x3 en un carril SIMD de 16 bytes (w = 0 siempre).
+    template <typename T, size_t N>
+    using VectorA = Vector<T, N, AlignedStorage>;
+
+    using Vector3A = VectorA<float, 3>;
+
+    static_assert(std::is_trivially_copyable_v<Vector<float, 3>> && std::is_trivially_copyable_v<Vector3A> &&
+                      std::is_trivially_copyable_v<Vector<double, 4>>,
+                  "Vector must stay trivially copyable");
+
 } // namespace TinyGeo
\ No newline at end of file
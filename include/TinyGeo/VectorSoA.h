@@ -0,0 +1,377 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "TinyGeo/AlignedAllocator.h"
+#include "TinyGeo/Span.h"
+#include "TinyGeo/Vector.h"
+
+namespace TinyGeo {
+
+    // Contenedor Structure-of-Arrays: guarda M vectores de dimensión N como
+    // N "carriles" contiguos (todas las x, luego todas las y, ...).
+    //
+    //   AoS (std::vector<Vector<T,N>>): x0 y0 z0 | x1 y1 z1 | ...
+    //   SoA (VectorSoA<T,N>):           x0 x1 ... | y0 y1 ... | z0 z1 ...
+    //
+    // Un barrido que solo lee un eje (p.ej. culling sobre z) toca 1/N de la
+    // memoria, y los kernels masivos se vectorizan sin shuffles.
+    //
+    // Todo vive en un único bloque: el carril k empieza en data + k * stride,
+    // con stride redondeado para que cada carril quede alineado a Alloc.
+    template <typename T, size_t N, typename Alloc = AlignedAllocator<T>>
+    class VectorSoA {
+        static_assert(std::is_arithmetic_v<T>, "VectorSoA requires an arithmetic scalar type");
+        static_assert(N >= 1, "VectorSoA requires N >= 1");
+
+        template <bool Const>
+        class BasicRef;
+
+    public:
+        using value_type = Vector<T, N>;
+        using scalar_type = T;
+        using allocator_type = Alloc;
+        using Ref = BasicRef<false>;
+        using ConstRef = BasicRef<true>;
+
+        // --- 1. CONSTRUCCIÓN / CICLO DE VIDA ---
+
+        VectorSoA() = default;
+
+        explicit VectorSoA(const Alloc& alloc) : alloc_(alloc) {}
+
+        // 'count' vectores inicializados a cero
+        explicit VectorSoA(size_t count, const Alloc& alloc = Alloc()) : alloc_(alloc) {
+            resize(count);
+        }
+
+        VectorSoA(const VectorSoA& other) : alloc_(other.alloc_) {
+            reserve(other.size_);
+            size_ = other.size_;
+            for (size_t k = 0; k < N; ++k) {
+                std::copy(other.lane(k), other.lane(k) + size_, lane(k));
+            }
+        }
+
+        VectorSoA(VectorSoA&& other) noexcept
+            : alloc_(std::move(other.alloc_)),
+              data_(std::exchange(other.data_, nullptr)),
+              size_(std::exchange(other.size_, 0)),
+              stride_(std::exchange(other.stride_, 0)) {}
+
+        VectorSoA& operator=(VectorSoA other) noexcept {
+            swap(other);
+            return *this;
+        }
+
+        ~VectorSoA() { release(); }
+
+        void swap(VectorSoA& other) noexcept {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+            swap(data_, other.data_);
+            swap(size_, other.size_);
+            swap(stride_, other.stride_);
+        }
+
+        // --- 2. CAPACIDAD ---
+
+        size_t size() const { return size_; }
+        size_t capacity() const { return stride_; }
+        bool empty() const { return size_ == 0; }
+        static constexpr size_t dimension() { return N; }
+
+        void reserve(size_t count) {
+            if (count <= stride_) return;
+            reallocate(count);
+        }
+
+        // Los elementos nuevos se inicializan a cero (igual que Vector()).
+        void resize(size_t count) {
+            if (count > stride_) {
+                reallocate(std::max(count, stride_ * 2));
+            }
+            if (count > size_) {
+                for (size_t k = 0; k < N; ++k) {
+                    std::fill(lane(k) + size_, lane(k) + count, T(0));
+                }
+            }
+            size_ = count;
+        }
+
+        void clear() { size_ = 0; }
+
+        void push_back(const Vector<T, N>& v) {
+            if (size_ == stride_) {
+                reallocate(stride_ == 0 ? kLaneGranule : stride_ * 2);
+            }
+            set(size_++, v);
+        }
+
+        // --- 3. ACCESO ---
+
+        // Carril k: puntero a las 'size()' componentes k-ésimas.
+        T* lane(size_t k) {
+            assert(k < N && "Lane index out of bounds");
+            return data_ + k * stride_;
+        }
+
+        const T* lane(size_t k) const {
+            assert(k < N && "Lane index out of bounds");
+            return data_ + k * stride_;
+        }
+
+        Span<T> laneSpan(size_t k) { return Span<T>(lane(k), size_); }
+        Span<const T> laneSpan(size_t k) const { return Span<const T>(lane(k), size_); }
+
+        // Proxy por elemento: se comporta como un Vector<T,N> pero lee/escribe
+        // directamente en los carriles.  soa[i].z() = 1; Vector<T,N> v = soa[i];
+        Ref operator[](size_t index) {
+            assert(index < size_ && "Index out of bounds");
+            return Ref(this, index);
+        }
+
+        ConstRef operator[](size_t index) const {
+            assert(index < size_ && "Index out of bounds");
+            return ConstRef(this, index);
+        }
+
+        Vector<T, N> get(size_t index) const {
+            assert(index < size_ && "Index out of bounds");
+            Vector<T, N> v;
+            for (size_t k = 0; k < N; ++k) {
+                v[k] = lane(k)[index];
+            }
+            return v;
+        }
+
+        void set(size_t index, const Vector<T, N>& v) {
+            assert(index < stride_ && "Index out of bounds");
+            for (size_t k = 0; k < N; ++k) {
+                lane(k)[index] = v[k];
+            }
+        }
+
+        // --- 4. KERNELS MASIVOS ---
+        // Cada bucle recorre los carriles de forma lineal, sin dependencias
+        // entre iteraciones: el compilador los vectoriza directamente.
+
+        // out[i] = this[i] . other[i]
+        void dot(const VectorSoA& other, Span<T> out) const {
+            assert(other.size() == size_ && "Size mismatch");
+            assert(out.size() >= size_ && "Output span too small");
+            T* dst = out.data();
+            std::fill(dst, dst + size_, T(0));
+            for (size_t k = 0; k < N; ++k) {
+                const T* a = lane(k);
+                const T* b = other.lane(k);
+                for (size_t i = 0; i < size_; ++i) {
+                    dst[i] += a[i] * b[i];
+                }
+            }
+        }
+
+        // out[i] = this[i] . v   (p.ej. distancia con signo a un plano)
+        void dot(const Vector<T, N>& v, Span<T> out) const {
+            assert(out.size() >= size_ && "Output span too small");
+            T* dst = out.data();
+            std::fill(dst, dst + size_, T(0));
+            for (size_t k = 0; k < N; ++k) {
+                const T* a = lane(k);
+                const T s = v[k];
+                for (size_t i = 0; i < size_; ++i) {
+                    dst[i] += a[i] * s;
+                }
+            }
+        }
+
+        // out[i] = |this[i]|^2
+        void normSq(Span<T> out) const {
+            dot(*this, out);
+        }
+
+        // Normaliza todos los vectores in-place.
+        // Igual que Vector::normalized(): los vectores de longitud casi nula
+        // quedan en cero. Se usa una selección en lugar de un 'if' para que
+        // el bucle siga siendo vectorizable.
+        void normalize() {
+            constexpr size_t kBlock = 256;
+            T scale[kBlock];
+            for (size_t base = 0; base < size_; base += kBlock) {
+                const size_t count = std::min(kBlock, size_ - base);
+                std::fill(scale, scale + count, T(0));
+                for (size_t k = 0; k < N; ++k) {
+                    const T* a = lane(k) + base;
+                    for (size_t i = 0; i < count; ++i) {
+                        scale[i] += a[i] * a[i];
+                    }
+                }
+                for (size_t i = 0; i < count; ++i) {
+                    const T len = std::sqrt(scale[i]);
+                    scale[i] = len < T(1e-8) ? T(0) : T(1) / len;
+                }
+                for (size_t k = 0; k < N; ++k) {
+                    T* a = lane(k) + base;
+                    for (size_t i = 0; i < count; ++i) {
+                        a[i] *= scale[i];
+                    }
+                }
+            }
+        }
+
+        // this[i] += other[i]
+        VectorSoA& operator+=(const VectorSoA& other) {
+            assert(other.size() == size_ && "Size mismatch");
+            for (size_t k = 0; k < N; ++k) {
+                T* a = lane(k);
+                const T* b = other.lane(k);
+                for (size_t i = 0; i < size_; ++i) {
+                    a[i] += b[i];
+                }
+            }
+            return *this;
+        }
+
+        // this[i] -= other[i]
+        VectorSoA& operator-=(const VectorSoA& other) {
+            assert(other.size() == size_ && "Size mismatch");
+            for (size_t k = 0; k < N; ++k) {
+                T* a = lane(k);
+                const T* b = other.lane(k);
+                for (size_t i = 0; i < size_; ++i) {
+                    a[i] -= b[i];
+                }
+            }
+            return *this;
+        }
+
+        // this[i] += offset  (traslación de toda la nube)
+        VectorSoA& operator+=(const Vector<T, N>& offset) {
+            for (size_t k = 0; k < N; ++k) {
+                T* a = lane(k);
+                const T s = offset[k];
+                for (size_t i = 0; i < size_; ++i) {
+                    a[i] += s;
+                }
+            }
+            return *this;
+        }
+
+        // this[i] *= scalar
+        VectorSoA& operator*=(T scalar) {
+            for (size_t k = 0; k < N; ++k) {
+                T* a = lane(k);
+                for (size_t i = 0; i < size_; ++i) {
+                    a[i] *= scalar;
+                }
+            }
+            return *this;
+        }
+
+    private:
+        using Traits = std::allocator_traits<Alloc>;
+
+        // Granularidad del stride: múltiplo de una línea de caché para que
+        // todos los carriles empiecen alineados.
+        static constexpr size_t kLaneGranule =
+            kCacheLine / sizeof(T) > 0 ? kCacheLine / sizeof(T) : 1;
+
+        static size_t roundStride(size_t count) {
+            return (count + kLaneGranule - 1) / kLaneGranule * kLaneGranule;
+        }
+
+        void reallocate(size_t count) {
+            const size_t newStride = roundStride(count);
+            T* fresh = Traits::allocate(alloc_, newStride * N);
+            for (size_t k = 0; k < N; ++k) {
+                if (size_ > 0) {
+                    std::copy(lane(k), lane(k) + size_, fresh + k * newStride);
+                }
+            }
+            release();
+            data_ = fresh;
+            stride_ = newStride;
+        }
+
+        void release() {
+            if (data_) {
+                Traits::deallocate(alloc_, data_, stride_ * N);
+                data_ = nullptr;
+            }
+        }
+
+        Alloc alloc_{};
+        T* data_ = nullptr;
+        size_t size_ = 0;
+        size_t stride_ = 0; // Capacidad de cada carril (en elementos)
+    };
+
+    // --- 5. PROXY POR ELEMENTO ---
+    template <typename T, size_t N, typename Alloc>
+    template <bool Const>
+    class VectorSoA<T, N, Alloc>::BasicRef {
+        using Owner = std::conditional_t<Const, const VectorSoA, VectorSoA>;
+        using Elem = std::conditional_t<Const, const T, T>;
+
+    public:
+        BasicRef(Owner* owner, size_t index) : owner_(owner), index_(index) {}
+        BasicRef(const BasicRef&) = default;
+
+        // Escribir a través del proxy copia valores (no re-apunta el proxy)
+        BasicRef& operator=(const BasicRef& other) {
+            static_assert(!Const, "Cannot assign through a const proxy");
+            return *this = other.value();
+        }
+
+        BasicRef& operator=(const Vector<T, N>& v) {
+            static_assert(!Const, "Cannot assign through a const proxy");
+            owner_->set(index_, v);
+            return *this;
+        }
+
+        Elem& operator[](size_t k) const { return owner_->lane(k)[index_]; }
+
+        Elem& x() const { static_assert(N >= 1); return (*this)[0]; }
+        Elem& y() const { static_assert(N >= 2); return (*this)[1]; }
+        Elem& z() const { static_assert(N >= 3); return (*this)[2]; }
+        Elem& w() const { static_assert(N >= 4); return (*this)[3]; }
+
+        constexpr size_t size() const { return N; }
+
+        Vector<T, N> value() const { return owner_->get(index_); }
+        operator Vector<T, N>() const { return value(); }
+
+        T dot(const Vector<T, N>& other) const { return value().dot(other); }
+        T normSq() const { return value().normSq(); }
+        T norm() const { return value().norm(); }
+        Vector<T, N> normalized() const { return value().normalized(); }
+
+        const BasicRef& operator+=(const Vector<T, N>& other) const {
+            static_assert(!Const, "Cannot modify through a const proxy");
+            for (size_t k = 0; k < N; ++k) (*this)[k] += other[k];
+            return *this;
+        }
+
+        const BasicRef& operator-=(const Vector<T, N>& other) const {
+            static_assert(!Const, "Cannot modify through a const proxy");
+            for (size_t k = 0; k < N; ++k) (*this)[k] -= other[k];
+            return *this;
+        }
+
+        const BasicRef& operator*=(T scalar) const {
+            static_assert(!Const, "Cannot modify through a const proxy");
+            for (size_t k = 0; k < N; ++k) (*this)[k] *= scalar;
+            return *this;
+        }
+
+    private:
+        Owner* owner_;
+        size_t index_;
+    };
+
+} // namespace TinyGeo
@@ -0,0 +1,71 @@
+#pragma once
+
+// Raíz cuadrada inversa aproximada para Vector::fastNorm / fastNormalized.
+//
+// Cotas de error relativo de rsqrt(x) frente a 1/sqrt(x), x normal > 0:
+//   float, SSE2/AVX2: rsqrtss (|e| <= 1.5 * 2^-12) + 1 paso de Newton -> |e| < 2^-21 (~4 ULP)
+//   float, NEON:      vrsqrte (|e| <= 2^-8)        + 2 pasos de Newton -> |e| < 2^-21
+//   float, escalar:   1 / std::sqrt(x)                                  -> 1 ULP
+//   double:           1 / std::sqrt(x) en todos los backends (no hay
+//                     estimación hardware de doble precisión antes de AVX-512)
+//
+// Requiere que Simd.h ya haya fijado el backend.
+
+#include <cmath>
+
+#include "TinyGeo/Config.h"
+#include "TinyGeo/detail/Kernels.h"
+
+#if defined(TINYGEO_SIMD_SSE2) || defined(TINYGEO_SIMD_AVX2)
+    #include <xmmintrin.h>
+#elif defined(TINYGEO_SIMD_NEON)
+    #include <arm_neon.h>
+#endif
+
+namespace TinyGeo {
+namespace detail {
+
+    template <typename T>
+    struct FastMath {
+        // Cota documentada del error relativo de rsqrt()
+        static constexpr T kMaxRelError = T(2.3e-16);
+
+        static constexpr T rsqrt(T x) {
+            if (TINYGEO_IS_CONSTANT_EVALUATED()) {
+                return T(1) / sqrtConstexpr(x);
+            }
+            return T(1) / std::sqrt(x);
+        }
+    };
+
+    template <>
+    struct FastMath<float> {
+#if defined(TINYGEO_SIMD_SSE2) || defined(TINYGEO_SIMD_AVX2) || defined(TINYGEO_SIMD_NEON)
+        static constexpr float kMaxRelError = 4.8e-7f; // 2^-21
+#else
+        static constexpr float kMaxRelError = 1.2e-7f; // 1 ULP
+#endif
+
+        static constexpr float rsqrt(float x) {
+            if (TINYGEO_IS_CONSTANT_EVALUATED()) {
+                return 1.0f / sqrtConstexpr(x);
+            }
+#if defined(TINYGEO_SIMD_SSE2) || defined(TINYGEO_SIMD_AVX2)
+            // Newton: y' = y * (1.5 - 0.5 * x * y^2)
+            const float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+            return y * (1.5f - 0.5f * x * y * y);
+#elif defined(TINYGEO_SIMD_NEON)
+            // vrsqrts(a, b) = (3 - a * b) / 2: un paso de Newton por llamada
+            float32x2_t vx = vdup_n_f32(x);
+            float32x2_t y = vrsqrte_f32(vx);
+            y = vmul_f32(y, vrsqrts_f32(vmul_f32(vx, y), y));
+            y = vmul_f32(y, vrsqrts_f32(vmul_f32(vx, y), y));
+            return vget_lane_f32(y, 0);
+#else
+            return 1.0f / std::sqrt(x);
+#endif
+        }
+    };
+
+} // namespace detail
+} // namespace TinyGeo
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace TinyGeo {
+namespace detail {
+
+    // Hasta este N los kernels se despliegan con un fold sobre
+    // index_sequence: el desenrollado completo no depende de las heurísticas
+    // del optimizador (ni de -O2 frente a -O3).
+    inline constexpr size_t kFullUnrollMax = 4;
+
+    // A partir de este N el producto punto usa varios acumuladores
+    inline constexpr size_t kBlockedDotMin = 16;
+
+    // Acumuladores independientes de dotBlocked(): cubren la latencia de la
+    // suma en coma flotante (4 ciclos) con dos FMA por ciclo.
+    inline constexpr size_t kDotAccumulators = 8;
+
+    template <typename Fn, size_t... I>
+    constexpr void unrollImpl(Fn&& fn, std::index_sequence<I...>) {
+        (fn(std::integral_constant<size_t, I>{}), ...);
+    }
+
+    // fn(integral_constant<size_t, 0>) ... fn(integral_constant<size_t, N - 1>)
+    template <size_t N, typename Fn>
+    constexpr void unroll(Fn&& fn) {
+        unrollImpl(fn, std::make_index_sequence<N>{});
+    }
+
+    // a . b para n grande. Con un único acumulador cada suma espera a la
+    // anterior (cadena serie de n sumas); con kDotAccumulators sumas
+    // parciales independientes el compilador las reparte entre registros y
+    // las combina en árbol al final. El orden de suma cambia respecto al loop
+    // simple, y el error de redondeo suele ser menor (sumas más cortas).
+    template <typename T>
+    constexpr T dotBlocked(const T* a, const T* b, size_t n) {
+        T acc[kDotAccumulators] = {};
+        size_t i = 0;
+        for (; i + kDotAccumulators <= n; i += kDotAccumulators) {
+            for (size_t k = 0; k < kDotAccumulators; ++k) {
+                acc[k] += a[i + k] * b[i + k];
+            }
+        }
+        for (size_t k = 0; k < kDotAccumulators && i + k < n; ++k) {
+            acc[k] += a[i + k] * b[i + k];
+        }
+        for (size_t width = kDotAccumulators / 2; width > 0; width /= 2) {
+            for (size_t k = 0; k < width; ++k) {
+                acc[k] += acc[k + width];
+            }
+        }
+        return acc[0];
+    }
+
+    // Kernels escalares de referencia sobre arrays crudos de N elementos.
+    // Son la implementación portable (fallback) y la referencia contra la que
+    // se validan los backends SIMD. 'a' y 'out' pueden apuntar al mismo array.
+    // Son constexpr: también es la ruta que se usa en tiempo de compilación.
+    // N <= kFullUnrollMax: desplegados por completo; N >= kBlockedDotMin:
+    // dot con varios acumuladores.
+    template <typename T, size_t N>
+    struct ScalarKernels {
+        // a += b
+        static constexpr void add(T* a, const T* b) {
+            if constexpr (N <= kFullUnrollMax) {
+                unroll<N>([&](auto i) { a[i] += b[i]; });
+            } else {
+                for (size_t i = 0; i < N; ++i) {
+                    a[i] += b[i];
+                }
+            }
+        }
+
+        // a -= b
+        static constexpr void sub(T* a, const T* b) {
+            if constexpr (N <= kFullUnrollMax) {
+                unroll<N>([&](auto i) { a[i] -= b[i]; });
+            } else {
+                for (size_t i = 0; i < N; ++i) {
+                    a[i] -= b[i];
+                }
+            }
+        }
+
+        // a *= s
+        static constexpr void scale(T* a, T s) {
+            if constexpr (N <= kFullUnrollMax) {
+                unroll<N>([&](auto i) { a[i] *= s; });
+            } else {
+                for (size_t i = 0; i < N; ++i) {
+                    a[i] *= s;
+                }
+            }
+        }
+
+        // a . b. El fold suma en el mismo orden que el loop: mismo resultado.
+        static constexpr T dot(const T* a, const T* b) {
+            if constexpr (N <= kFullUnrollMax) {
+                return dotFold(a, b, std::make_index_sequence<N>{});
+            } else if constexpr (N >= kBlockedDotMin) {
+                return dotBlocked(a, b, N);
+            } else {
+                T sum = T(0);
+                for (size_t i = 0; i < N; ++i) {
+                    sum += a[i] * b[i];
+                }
+                return sum;
+            }
+        }
+
+        // out = a x b. N=4 es un vector 3D con carril de padding (AlignedStorage):
+        // se calcula sobre xyz y el padding del resultado queda en cero.
+        static constexpr void cross(const T* a, const T* b, T* out) {
+            static_assert(N == 3 || N == 4, "Cross product is only defined for 3D vectors (N=3)");
+            const T x = a[1] * b[2] - a[2] * b[1];
+            const T y = a[2] * b[0] - a[0] * b[2];
+            const T z = a[0] * b[1] - a[1] * b[0];
+            out[0] = x;
+            out[1] = y;
+            out[2] = z;
+            if constexpr (N == 4) {
+                out[3] = T(0);
+            }
+        }
+
+    private:
+        template <size_t... I>
+        static constexpr T dotFold(const T* a, const T* b, std::index_sequence<I...>) {
+            return (T(0) + ... + (a[I] * b[I]));
+        }
+    };
+
+    // Punto de extensión: los backends SIMD especializan Kernels<T, N> para
+    // los tamaños comunes. Cualquier combinación sin especializar hereda la
+    // versión escalar.
+    template <typename T, size_t N>
+    struct Kernels : ScalarKernels<T, N> {};
+
+    // Raíz cuadrada evaluable en constexpr (std::sqrt no lo es en C++17).
+    // Newton-Raphson partiendo de una cota superior: la secuencia decrece
+    // monótonamente y se detiene cuando deja de bajar (precisión de 'double').
+    template <typename T>
+    constexpr T sqrtConstexpr(T value) {
+        const double x = static_cast<double>(value);
+        if (!(x > 0.0)) {
+            return x == 0.0 ? T(0) : std::numeric_limits<T>::quiet_NaN(); // x < 0 o NaN
+        }
+        double cur = x > 1.0 ? x : 1.0;
+        for (int i = 0; i < 2048; ++i) {
+            const double next = 0.5 * (cur + x / cur);
+            if (next >= cur) {
+                break;
+            }
+            cur = next;
+        }
+        return static_cast<T>(cur);
+    }
+
+} // namespace detail
+} // namespace TinyGeo
@@ -0,0 +1,36 @@
+#pragma once
+
+// Backend AVX2: añade double 4 (un registro ymm) sobre el backend SSE2.
+// Requiere compilar con -mavx2 -mfma (TINYGEO_SIMD=AVX2).
+
+#include <immintrin.h>
+
+#include "TinyGeo/detail/KernelsSSE.h"
+
+namespace TinyGeo {
+namespace detail {
+
+    template <>
+    struct Kernels<double, 4> : ScalarKernels<double, 4> {
+        static void add(double* a, const double* b) {
+            _mm256_storeu_pd(a, _mm256_add_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b)));
+        }
+
+        static void sub(double* a, const double* b) {
+            _mm256_storeu_pd(a, _mm256_sub_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b)));
+        }
+
+        static void scale(double* a, double s) {
+            _mm256_storeu_pd(a, _mm256_mul_pd(_mm256_loadu_pd(a), _mm256_set1_pd(s)));
+        }
+
+        static double dot(const double* a, const double* b) {
+            const __m256d prod = _mm256_mul_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b));
+            // Suma horizontal: mitad alta + mitad baja, luego los 2 carriles
+            const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(prod), _mm256_extractf128_pd(prod, 1));
+            return sse::hsum(half);
+        }
+    };
+
+} // namespace detail
+} // namespace TinyGeo
@@ -0,0 +1,103 @@
+#pragma once
+
+// Backend NEON (AArch64): float 3/4 y double 2.
+// vaddvq_* (suma horizontal) solo existe en A64, de ahí el requisito.
+
+#include <arm_neon.h>
+
+#include "TinyGeo/detail/Kernels.h"
+
+namespace TinyGeo {
+namespace detail {
+namespace neon {
+
+    // Carga [x, y, z, 0] sin leer fuera del array de 3 floats
+    inline float32x4_t load3(const float* p) {
+        return vcombine_f32(vld1_f32(p), vset_lane_f32(p[2], vdup_n_f32(0.0f), 0));
+    }
+
+    inline void store3(float* p, float32x4_t v) {
+        vst1_f32(p, vget_low_f32(v));
+        vst1q_lane_f32(p + 2, v, 2);
+    }
+
+    // [x, y, z, w] -> [y, z, x, x]. El carril w no importa: se descarta al guardar.
+    inline float32x4_t yzx(float32x4_t v) {
+        return vsetq_lane_f32(vgetq_lane_f32(v, 0), vextq_f32(v, v, 1), 2);
+    }
+
+    inline float32x4_t cross(float32x4_t a, float32x4_t b) {
+        const float32x4_t c = vsubq_f32(vmulq_f32(a, yzx(b)), vmulq_f32(yzx(a), b)); // [z, x, y]
+        return yzx(c);
+    }
+
+} // namespace neon
+
+    template <>
+    struct Kernels<float, 3> : ScalarKernels<float, 3> {
+        static void add(float* a, const float* b) {
+            neon::store3(a, vaddq_f32(neon::load3(a), neon::load3(b)));
+        }
+
+        static void sub(float* a, const float* b) {
+            neon::store3(a, vsubq_f32(neon::load3(a), neon::load3(b)));
+        }
+
+        static void scale(float* a, float s) {
+            neon::store3(a, vmulq_n_f32(neon::load3(a), s));
+        }
+
+        static float dot(const float* a, const float* b) {
+            return vaddvq_f32(vmulq_f32(neon::load3(a), neon::load3(b)));
+        }
+
+        static void cross(const float* a, const float* b, float* out) {
+            neon::store3(out, neon::cross(neon::load3(a), neon::load3(b)));
+        }
+    };
+
+    template <>
+    struct Kernels<float, 4> : ScalarKernels<float, 4> {
+        static void add(float* a, const float* b) {
+            vst1q_f32(a, vaddq_f32(vld1q_f32(a), vld1q_f32(b)));
+        }
+
+        static void sub(float* a, const float* b) {
+            vst1q_f32(a, vsubq_f32(vld1q_f32(a), vld1q_f32(b)));
+        }
+
+        static void scale(float* a, float s) {
+            vst1q_f32(a, vmulq_n_f32(vld1q_f32(a), s));
+        }
+
+        static float dot(const float* a, const float* b) {
+            return vaddvq_f32(vmulq_f32(vld1q_f32(a), vld1q_f32(b)));
+        }
+
+        // Vector 3D con padding (AlignedStorage): el carril w se fuerza a cero
+        static void cross(const float* a, const float* b, float* out) {
+            vst1q_f32(out, vsetq_lane_f32(0.0f, neon::cross(vld1q_f32(a), vld1q_f32(b)), 3));
+        }
+    };
+
+    template <>
+    struct Kernels<double, 2> : ScalarKernels<double, 2> {
+        static void add(double* a, const double* b) {
+            vst1q_f64(a, vaddq_f64(vld1q_f64(a), vld1q_f64(b)));
+        }
+
+        static void sub(double* a, const double* b) {
+            vst1q_f64(a, vsubq_f64(vld1q_f64(a), vld1q_f64(b)));
+        }
+
+        static void scale(double* a, double s) {
+            vst1q_f64(a, vmulq_n_f64(vld1q_f64(a), s));
+        }
+
+        static double dot(const double* a, const double* b) {
+            return vaddvq_f64(vmulq_f64(vld1q_f64(a), vld1q_f64(b)));
+        }
+    };
+
+} // namespace detail
+} // namespace TinyGeo
@@ -0,0 +1,119 @@
+#pragma once
+
+// Backend SSE2: float 3/4 y double 2.
+// Solo usa SSE2, que es la base garantizada de x86-64, así que se activa
+// sin flags extra.
+
+#include <emmintrin.h>
+
+#include "TinyGeo/detail/Kernels.h"
+
+namespace TinyGeo {
+namespace detail {
+namespace sse {
+
+    // Carga [x, y, z, 0] sin leer fuera del array de 3 floats.
+    // __m128i está declarado may_alias, así que la carga de 64 bits es segura.
+    inline __m128 load3(const float* p) {
+        const __m128 xy = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+        const __m128 z = _mm_load_ss(p + 2);
+        return _mm_movelh_ps(xy, z);
+    }
+
+    inline void store3(float* p, __m128 v) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(v));
+        _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+    }
+
+    // Suma horizontal de los 4 carriles (resultado en el carril 0)
+    inline float hsum(__m128 v) {
+        __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)); // [y, x, w, z]
+        __m128 sums = _mm_add_ps(v, shuf);                            // [x+y, x+y, z+w, z+w]
+        shuf = _mm_movehl_ps(shuf, sums);                             // [z+w, ...]
+        sums = _mm_add_ss(sums, shuf);
+        return _mm_cvtss_f32(sums);
+    }
+
+    inline double hsum(__m128d v) {
+        return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+    }
+
+    // Producto cruz por shuffles sobre [x, y, z, w].
+    // Con w = 0 en ambas entradas el carril w del resultado también es 0.
+    inline __m128 cross(__m128 a, __m128 b) {
+        const __m128 aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b)); // [z, x, y]
+        return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+    }
+
+} // namespace sse
+
+    template <>
+    struct Kernels<float, 3> : ScalarKernels<float, 3> {
+        static void add(float* a, const float* b) {
+            sse::store3(a, _mm_add_ps(sse::load3(a), sse::load3(b)));
+        }
+
+        static void sub(float* a, const float* b) {
+            sse::store3(a, _mm_sub_ps(sse::load3(a), sse::load3(b)));
+        }
+
+        static void scale(float* a, float s) {
+            sse::store3(a, _mm_mul_ps(sse::load3(a), _mm_set1_ps(s)));
+        }
+
+        static float dot(const float* a, const float* b) {
+            return sse::hsum(_mm_mul_ps(sse::load3(a), sse::load3(b)));
+        }
+
+        static void cross(const float* a, const float* b, float* out) {
+            sse::store3(out, sse::cross(sse::load3(a), sse::load3(b)));
+        }
+    };
+
+    template <>
+    struct Kernels<float, 4> : ScalarKernels<float, 4> {
+        static void add(float* a, const float* b) {
+            _mm_storeu_ps(a, _mm_add_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+        }
+
+        static void sub(float* a, const float* b) {
+            _mm_storeu_ps(a, _mm_sub_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+        }
+
+        static void scale(float* a, float s) {
+            _mm_storeu_ps(a, _mm_mul_ps(_mm_loadu_ps(a), _mm_set1_ps(s)));
+        }
+
+        static float dot(const float* a, const float* b) {
+            return sse::hsum(_mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+        }
+
+        // Vector 3D con padding (AlignedStorage): w = 0 en la entrada y la salida
+        static void cross(const float* a, const float* b, float* out) {
+            _mm_storeu_ps(out, sse::cross(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+        }
+    };
+
+    template <>
+    struct Kernels<double, 2> : ScalarKernels<double, 2> {
+        static void add(double* a, const double* b) {
+            _mm_storeu_pd(a, _mm_add_pd(_mm_loadu_pd(a), _mm_loadu_pd(b)));
+        }
+
+        static void sub(double* a, const double* b) {
+            _mm_storeu_pd(a, _mm_sub_pd(_mm_loadu_pd(a), _mm_loadu_pd(b)));
+        }
+
+        static void scale(double* a, double s) {
+            _mm_storeu_pd(a, _mm_mul_pd(_mm_loadu_pd(a), _mm_set1_pd(s)));
+        }
+
+        static double dot(const double* a, const double* b) {
+            return sse::hsum(_mm_mul_pd(_mm_loadu_pd(a), _mm_loadu_pd(b)));
+        }
+    };
+
+} // namespace detail
+} // namespace TinyGeo
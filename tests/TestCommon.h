@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+// Una macro simple para validar flotantes con tolerancia
+#define ASSERT_NEAR(val1, val2, epsilon)                          \
+    do {                                                          \
+        if (std::abs((val1) - (val2)) >= (epsilon)) {            \
+            std::cerr << "ASSERT_NEAR failed: "                  \
+                      << #val1 << " vs " << #val2 << std::endl;  \
+            std::abort();                                        \
+        }                                                         \
+    } while (0)
+
+// Igual que assert() pero activo también en Release (NDEBUG)
+#define ASSERT_TRUE(cond)                                         \
+    do {                                                          \
+        if (!(cond)) {                                            \
+            std::cerr << "ASSERT_TRUE failed: " << #cond          \
+                      << " (" << __FILE__ << ":" << __LINE__      \
+                      << ")" << std::endl;                        \
+            std::abort();                                        \
+        }                                                         \
+    } while (0)
@@ -0,0 +1,116 @@
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "TinyGeo/AABB.h"
+#include "TestCommon.h"
+
+void test_aabb_basic() {
+    using namespace TinyGeo;
+    AABB3f box;
+    ASSERT_TRUE(box.isEmpty());
+    box.expand(Vector<float, 3>{1.0f, 2.0f, 3.0f});
+    box.expand(Vector<float, 3>{-1.0f, 4.0f, 0.0f});
+    ASSERT_TRUE(!box.isEmpty());
+    ASSERT_NEAR(box.center()[1], 3.0f, 1e-6f);
+    ASSERT_TRUE(box.longestAxis() == 2);
+
+    ASSERT_TRUE(box.contains({0.0f, 3.0f, 1.0f}));
+    ASSERT_TRUE(box.contains({1.0f, 2.0f, 3.0f})); // Borde incluido
+    ASSERT_TRUE(!box.contains({0.0f, 5.0f, 1.0f}));
+
+    AABB3f other({0.5f, 3.5f, 2.5f}, {5.0f, 5.0f, 5.0f});
+    ASSERT_TRUE(box.overlaps(other) && other.overlaps(box));
+    AABB3f inter = box.intersection(other);
+    ASSERT_NEAR(inter.extent()[0], 0.5f, 1e-6f);
+    ASSERT_TRUE(box.intersection(AABB3f({9.0f, 9.0f, 9.0f}, {10.0f, 10.0f, 10.0f})).isEmpty());
+
+    ASSERT_NEAR(box.distanceSq({0.0f, 3.0f, 1.0f}), 0.0f, 1e-7f);
+    ASSERT_NEAR(box.distanceSq({3.0f, 3.0f, 1.0f}), 4.0f, 1e-6f);
+
+    // Rayo por el eje x (dir.y = dir.z = 0 -> invDir infinito)
+    Ray<float, 3> ray({-10.0f, 3.0f, 1.0f}, {1.0f, 0.0f, 0.0f});
+    float tNear = 0.0f;
+    ASSERT_TRUE(box.intersects(ray, 0.0f, 100.0f, tNear));
+    ASSERT_NEAR(tNear, 9.0f, 1e-5f);
+    ASSERT_TRUE(!box.intersects(ray, 0.0f, 5.0f, tNear)); // Demasiado corto
+    Ray<float, 3> miss({-10.0f, 8.0f, 1.0f}, {1.0f, 0.0f, 0.0f});
+    ASSERT_TRUE(!box.intersects(miss, 0.0f, 100.0f, tNear));
+
+    std::cout << "[PASS] AABB expand / overlap / contains / ray" << std::endl;
+}
+
+// Origen sobre una cara y rayo paralelo a ella: 0 * inf = NaN en ese eje
+void test_ray_on_face() {
+    using namespace TinyGeo;
+    const float inf = std::numeric_limits<float>::infinity();
+    AABB3f unit({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f});
+    const Vector<float, 3> origins[] = {
+        {0.0f, 0.5f, -1.0f}, // Cara x = lo
+        {1.0f, 0.5f, -1.0f}, // Cara x = hi
+        {0.0f, 1.0f, -1.0f}, // Arista
+    };
+    for (const auto& o : origins) {
+        for (float dz : {1.0f, -1.0f}) {
+            // dir.x = +0 y -0 (invDir = +inf / -inf)
+            for (float dx : {0.0f, -0.0f}) {
+                Ray<float, 3> ray(o, {dx, 0.0f, dz});
+                float tNear = -1.0f;
+                const bool hit = unit.intersects(ray, 0.0f, inf, tNear);
+                ASSERT_TRUE(hit == (dz > 0.0f));
+                if (hit) ASSERT_NEAR(tNear, 1.0f, 1e-6f);
+
+                AABB3f boxes[] = {unit, AABB3f({5.0f, 5.0f, 5.0f}, {6.0f, 6.0f, 6.0f})};
+                AABBPacket4f packet{Span<const AABB3f>(boxes, 2)};
+                float tn[4];
+                ASSERT_TRUE(packet.intersect(ray, 0.0f, inf, tn) == (dz > 0.0f ? 1u : 0u));
+                if (hit) ASSERT_NEAR(tn[0], 1.0f, 1e-6f);
+            }
+        }
+    }
+    // Fuera del slab sigue fallando
+    Ray<float, 3> outside({-0.5f, 0.5f, -1.0f}, {0.0f, 0.0f, 1.0f});
+    float tNear = 0.0f;
+    ASSERT_TRUE(!unit.intersects(outside, 0.0f, inf, tNear));
+
+    std::cout << "[PASS] AABB ray on face (parallel)" << std::endl;
+}
+
+template <size_t K>
+void check_packet() {
+    using namespace TinyGeo;
+    // Cajas unidad a lo largo de x, alternando altura para que fallen las impares
+    std::vector<AABB3f> boxes;
+    for (size_t k = 0; k < K - 1; ++k) {
+        const float x = float(k) * 2.0f;
+        const float y = (k % 2 == 0) ? 0.0f : 5.0f;
+        boxes.push_back(AABB3f({x, y, 0.0f}, {x + 1.0f, y + 1.0f, 1.0f}));
+    }
+    // K - 1 cajas: el último carril no está cargado y nunca debe acertar
+    AABBPacket<float, 3, K> packet{Span<const AABB3f>(boxes)};
+
+    Ray<float, 3> ray({-1.0f, 0.5f, 0.5f}, {1.0f, 0.0f, 0.0f});
+    float tNear[K];
+    const uint32_t hits = packet.intersect(ray, 0.0f, std::numeric_limits<float>::max(), tNear);
+    for (size_t k = 0; k < K - 1; ++k) {
+        float t = 0.0f;
+        const bool expected = boxes[k].intersects(ray, 0.0f, std::numeric_limits<float>::max(), t);
+        ASSERT_TRUE(bool(hits & (1u << k)) == expected);
+        if (expected) ASSERT_NEAR(tNear[k], t, 1e-5f);
+    }
+    ASSERT_TRUE((hits >> (K - 1)) == 0);
+
+    AABB3f query({1.5f, -1.0f, 0.0f}, {4.5f, 10.0f, 1.0f}); // Toca las cajas 1 y 2
+    ASSERT_TRUE(packet.overlaps(query) == 0b110u);
+    ASSERT_TRUE(packet.contains({0.5f, 0.5f, 0.5f}) == 1u);
+    ASSERT_TRUE(packet.box(2).lo[0] == 4.0f);
+}
+
+int main() {
+    test_aabb_basic();
+    test_ray_on_face();
+    check_packet<4>();
+    check_packet<8>();
+    std::cout << "[PASS] AABBPacket 4 / 8 boxes" << std::endl;
+    return 0;
+}
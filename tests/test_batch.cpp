@@ -0,0 +1,79 @@
+#include <iostream>
+#include <vector>
+#include "TinyGeo/Batch.h"
+#include "TestCommon.h"
+
+// Cada kernel por lotes debe coincidir con la operación elemento a elemento,
+// incluyendo tamaños que no son múltiplo del desenrollado (resto).
+
+namespace {
+
+    template <typename V>
+    std::vector<V> make_points(size_t count, float seed) {
+        std::vector<V> out(count);
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t k = 0; k < out[i].size(); ++k) {
+                out[i][k] = static_cast<typename V::value_type>(std::sin(seed + float(i * 3 + k)));
+            }
+        }
+        return out;
+    }
+
+} // namespace
+
+template <typename V>
+void check_batch(size_t count) {
+    using namespace TinyGeo;
+    using T = typename V::value_type;
+    std::vector<V> a = make_points<V>(count, 0.5f);
+    std::vector<V> b = make_points<V>(count, 1.5f);
+    if (count > 0) {
+        a[0] = V(); // Vector cero: normalize debe dejarlo en cero
+    }
+
+    std::vector<T> d(count);
+    batch::dot(Span(a), Span(b), Span(d));
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_NEAR(d[i], dot(a[i], b[i]), T(1e-5));
+    }
+
+    std::vector<V> c(count);
+    batch::cross(Span(a), Span(b), Span(c));
+    for (size_t i = 0; i < count; ++i) {
+        V ref = cross(a[i], b[i]);
+        for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(c[i][k], ref[k], T(1e-5));
+    }
+
+    std::vector<V> n = a;
+    batch::normalize(Span(n));
+    for (size_t i = 0; i < count; ++i) {
+        V ref = a[i].normalized();
+        for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(n[i][k], ref[k], T(1e-5));
+    }
+
+    std::vector<V> y = b;
+    batch::axpy(T(2), Span(a), Span(y));
+    batch::scale(Span(y), T(0.5));
+    for (size_t i = 0; i < count; ++i) {
+        V ref = (b[i] + a[i] * T(2)) * T(0.5);
+        for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(y[i][k], ref[k], T(1e-5));
+    }
+
+    std::vector<V> s(count);
+    batch::add(Span(a), Span(b), Span(s));
+    batch::sub(Span(s), Span(b), Span(s)); // In-place
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(s[i][k], a[i][k], T(1e-5));
+    }
+}
+
+int main() {
+    using namespace TinyGeo;
+    for (size_t count : {0u, 1u, 7u, 8u, 1003u}) {
+        check_batch<Vector<float, 3>>(count);
+        check_batch<Vector<double, 3>>(count);
+        check_batch<Vector3A>(count);
+    }
+    std::cout << "[PASS] Batch kernels" << std::endl;
+    return 0;
+}
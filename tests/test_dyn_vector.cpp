@@ -0,0 +1,108 @@
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "TinyGeo/DynVector.h"
+#include "TestCommon.h"
+
+namespace {
+
+    float uniform(uint32_t& s) {
+        s = s * 1664525u + 1013904223u;
+        return float(s >> 8) / float(1u << 24) - 0.5f;
+    }
+
+    // Referencia en double (orden irrelevante a esta precisión)
+    double referenceDot(const float* a, const float* b, size_t n) {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i) sum += double(a[i]) * double(b[i]);
+        return sum;
+    }
+
+} // namespace
+
+// Los kernels desplegados y con acumuladores siguen siendo constexpr
+constexpr TinyGeo::Vector<int, 3> kA = {1, 2, 3};
+static_assert(kA.dot(kA) == 14, "Unrolled dot must be constexpr");
+static_assert(TinyGeo::detail::dotBlocked<int>(kA.data.data(), kA.data.data(), 3) == 14,
+              "Blocked dot must be constexpr");
+
+void test_kernels() {
+    using namespace TinyGeo;
+    // El fold para N <= 4 suma en el mismo orden que el loop: bit a bit igual
+    uint32_t s = 1u;
+    for (int r = 0; r < 1000; ++r) {
+        float a[4], b[4];
+        for (size_t i = 0; i < 4; ++i) {
+            a[i] = uniform(s);
+            b[i] = uniform(s);
+        }
+        float loop = 0.0f;
+        for (size_t i = 0; i < 4; ++i) loop += a[i] * b[i];
+        using K4 = detail::ScalarKernels<float, 4>;
+        ASSERT_TRUE(K4::dot(a, b) == loop);
+    }
+
+    // dotBlocked para todo n (incluido el resto < 8 acumuladores)
+    std::vector<float> a(1031), b(1031);
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = uniform(s);
+        b[i] = uniform(s);
+    }
+    for (size_t n : {size_t(0), size_t(1), size_t(7), size_t(8), size_t(9), size_t(63), size_t(1031)}) {
+        ASSERT_NEAR(double(detail::dotBlocked(a.data(), b.data(), n)), referenceDot(a.data(), b.data(), n), 1e-4);
+    }
+
+    // Vector<float, 512>::dot usa la versión por bloques
+    Vector<float, 512> va, vb;
+    for (size_t i = 0; i < 512; ++i) {
+        va[i] = a[i];
+        vb[i] = b[i];
+    }
+    ASSERT_NEAR(double(va.dot(vb)), referenceDot(a.data(), b.data(), 512), 1e-4);
+    std::cout << "[PASS] Unrolled / blocked kernels" << std::endl;
+}
+
+void test_dyn_vector() {
+    using namespace TinyGeo;
+    uint32_t s = 9u;
+    const size_t n = 768;
+    DynVector<float> a(n), b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = uniform(s);
+        b[i] = uniform(s);
+    }
+    ASSERT_TRUE(reinterpret_cast<uintptr_t>(a.data()) % kCacheLine == 0);
+    ASSERT_NEAR(double(a.dot(b)), referenceDot(a.data(), b.data(), n), 1e-4);
+    ASSERT_NEAR(double(dot(a, b)), double(b.dot(a)), 1e-6);
+
+    DynVector<float> c = a + b * 2.0f - a / 4.0f;
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_NEAR(c[i], a[i] + b[i] * 2.0f - a[i] / 4.0f, 1e-6f);
+    }
+
+    DynVector<float> u = c.normalized();
+    ASSERT_NEAR(u.norm(), 1.0f, 1e-5f);
+    ASSERT_TRUE(DynVector<float>(4).normalized().normSq() == 0.0f);
+    c.normalize();
+    ASSERT_NEAR(c.normSq(), 1.0f, 1e-5f);
+
+    // Conversión desde Vector (sin padding) y desde un Span
+    const Vector<float, 3, AlignedStorage> v3 = {1.0f, 2.0f, 3.0f};
+    DynVector<float> d(v3);
+    ASSERT_TRUE(d.size() == 3 && d[2] == 3.0f);
+    const float raw[2] = {4.0f, 5.0f};
+    DynVector<float> e{Span<const float>(raw)};
+    ASSERT_TRUE(e.size() == 2 && e[1] == 5.0f);
+
+    std::ostringstream os;
+    os << DynVector<double>{1.5, -2.0};
+    ASSERT_TRUE(os.str() == "[1.5, -2]");
+    std::cout << "[PASS] DynVector" << std::endl;
+}
+
+int main() {
+    test_kernels();
+    test_dyn_vector();
+    return 0;
+}
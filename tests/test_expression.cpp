@@ -0,0 +1,62 @@
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include "TinyGeo/Vector.h"
+#include "TestCommon.h"
+
+// Se compila con TINYGEO_EXPRESSION_TEMPLATES (ver CMakeLists.txt)
+#if !defined(TINYGEO_EXPRESSION_TEMPLATES)
+#error "test_expression.cpp requires TINYGEO_EXPRESSION_TEMPLATES"
+#endif
+
+void test_lazy_nodes() {
+    using namespace TinyGeo;
+    using V = Vector<float, 8>;
+    V a, b, c;
+    for (size_t i = 0; i < 8; ++i) {
+        a[i] = float(i);
+        b[i] = 1.0f;
+        c[i] = 2.0f * float(i);
+    }
+
+    // La expresión no es un Vector: es un árbol de nodos sin evaluar
+    auto e = a + b * 3.0f - c / 2.0f;
+    static_assert(!std::is_same_v<decltype(e), V>);
+    static_assert(std::is_same_v<decltype(e)::result_type, V>);
+
+    V r = e;
+    for (size_t i = 0; i < 8; ++i) {
+        ASSERT_NEAR(r[i], 3.0f, 1e-6f); // i + 3 - i
+    }
+
+    std::cout << "[PASS] Lazy expression nodes" << std::endl;
+}
+
+void test_assignment_forms() {
+    using namespace TinyGeo;
+    Vector<double, 4> a = {1.0, 2.0, 3.0, 4.0};
+    Vector<double, 4> b = {1.0, 1.0, 1.0, 1.0};
+
+    // El destino aparece en la expresión: la evaluación elemento a elemento lo permite
+    a = a * 2.0 + b;
+    ASSERT_NEAR(a[3], 9.0, 1e-12);
+
+    a += b * 0.5;
+    a -= 2.0 * b;
+    ASSERT_NEAR(a[0], 1.5, 1e-12);
+
+    // eval() materializa para pasar a funciones que esperan Vector
+    ASSERT_NEAR(dot((a - b).eval(), b), 0.5 + 2.5 + 4.5 + 6.5, 1e-12);
+
+    // Los operadores genéricos no deben interferir con otros tipos
+    const std::string label = std::string("dot") + "=" + std::to_string(1);
+    ASSERT_TRUE(label == "dot=1");
+
+    std::cout << "[PASS] Expression assignment" << std::endl;
+}
+
+int main() {
+    test_lazy_nodes();
+    test_assignment_forms();
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "TinyGeo/Batch.h"
+#include "TinyGeo/Gpu.h"
+#include "TinyGeo/Matrix.h"
+#include "TestCommon.h"
+
+namespace {
+
+    using TinyGeo::Vector;
+    using V3 = Vector<float, 3>;
+
+    uint32_t nextRandom(uint32_t& s) {
+        s = s * 1664525u + 1013904223u;
+        return s;
+    }
+
+    float uniform(uint32_t& s, float lo, float hi) {
+        return lo + (hi - lo) * float(nextRandom(s) >> 8) / float(1u << 24);
+    }
+
+    std::vector<V3> randomPoints(size_t n, uint32_t seed) {
+        std::vector<V3> v(n);
+        for (V3& p : v) p = V3(uniform(seed, -5.0f, 5.0f), uniform(seed, -5.0f, 5.0f), uniform(seed, -5.0f, 5.0f));
+        return v;
+    }
+
+    // Vector usado directamente en un kernel (constexpr + --expt-relaxed-constexpr)
+    __global__ void vectorOpsKernel(const V3* a, const V3* b, V3* out, size_t n) {
+        const size_t i = blockIdx.x * size_t(blockDim.x) + threadIdx.x;
+        if (i < n) out[i] = a[i].cross(b[i]) * a[i].dot(b[i]) + (a[i] - b[i]);
+    }
+
+} // namespace
+
+void test_batch_kernels() {
+    using namespace TinyGeo;
+    const size_t n = 100003; // No múltiplo del tamaño de bloque
+    const std::vector<V3> a = randomPoints(n, 1), b = randomPoints(n, 2);
+
+    gpu::Stream stream;
+    gpu::DeviceBuffer<V3> da(n), db(n), dv(n);
+    gpu::DeviceBuffer<float> ds(n);
+    da.upload(Span<const V3>(a), stream);
+    db.upload(Span<const V3>(b), stream);
+
+    std::vector<float> dots(n), refDots(n);
+    gpu::dot(da.view(), db.view(), ds.view(), stream);
+    ds.download(Span<float>(dots), stream);
+
+    std::vector<V3> crosses(n), refCrosses(n);
+    gpu::cross(da.view(), db.view(), dv.view(), stream);
+    dv.download(Span<V3>(crosses), stream);
+    stream.synchronize();
+
+    batch::dot(Span<const V3>(a), Span<const V3>(b), Span<float>(refDots));
+    batch::cross(Span<const V3>(a), Span<const V3>(b), Span<V3>(refCrosses));
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_NEAR(dots[i], refDots[i], 1e-4f);
+        for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(crosses[i][k], refCrosses[i][k], 1e-4f);
+    }
+
+    // In-place sobre el mismo buffer de dispositivo
+    std::vector<V3> normals(n), refNormals(n);
+    gpu::normalize(dv.view(), dv.view(), stream);
+    dv.download(Span<V3>(normals), stream);
+    stream.synchronize();
+    batch::normalize(Span<const V3>(refCrosses), Span<V3>(refNormals));
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(normals[i][k], refNormals[i][k], 1e-5f);
+    }
+
+    std::vector<V3> mixed(n);
+    vectorOpsKernel<<<unsigned((n + 255) / 256), 256, 0, stream.native()>>>(da.data(), db.data(), dv.data(), n);
+    gpu::check(cudaGetLastError(), "vectorOpsKernel");
+    dv.download(Span<V3>(mixed), stream);
+    stream.synchronize();
+    for (size_t i = 0; i < n; ++i) {
+        const V3 expected = a[i].cross(b[i]) * a[i].dot(b[i]) + (a[i] - b[i]);
+        for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(mixed[i][k], expected[k], 1e-2f);
+    }
+}
+
+void test_transforms() {
+    using namespace TinyGeo;
+    const size_t n = 50000;
+    const std::vector<V3> pts = randomPoints(n, 3);
+    Matrix<float, 4, 4> m;
+    for (size_t r = 0; r < 4; ++r) {
+        for (size_t c = 0; c < 4; ++c) m.rows[r][c] = r == 3 ? (c == 3 ? 1.0f : 0.0f) : float(r * 4 + c) * 0.1f - 0.5f;
+    }
+    Matrix<float, 3, 3> rot;
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) rot.rows[r][c] = m.rows[r][c];
+    }
+
+    gpu::Stream stream;
+    gpu::DeviceBuffer<V3> din(n), dout(n);
+    din.upload(Span<const V3>(pts), stream);
+    std::vector<V3> rotated(n), moved(n), refRotated(n), refMoved(n);
+    gpu::transform(rot, din.view(), dout.view(), stream);
+    dout.download(Span<V3>(rotated), stream);
+    gpu::transformPoints(m, din.view(), dout.view(), stream);
+    dout.download(Span<V3>(moved), stream);
+    stream.synchronize();
+
+    transform(rot, Span<const V3>(pts), Span<V3>(refRotated));
+    transformPoints(m, Span<const V3>(pts), Span<V3>(refMoved));
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            ASSERT_NEAR(rotated[i][k], refRotated[i][k], 1e-4f);
+            ASSERT_NEAR(moved[i][k], refMoved[i][k], 1e-4f);
+        }
+    }
+
+    // Streaming con chunks pequeños: varios chunks por stream y uno final parcial
+    std::vector<V3, gpu::PinnedAllocator<V3>> pinnedIn(pts.begin(), pts.end()), pinnedOut(n);
+    gpu::StreamOptions options;
+    options.chunk = 4096;
+    options.streams = 3;
+    gpu::streamed(Span<const V3>(pinnedIn), Span<V3>(pinnedOut),
+                  [&](gpu::DeviceSpan<const V3> in, gpu::DeviceSpan<V3> out, const gpu::Stream& s) {
+                      gpu::transformPoints(m, in, out, s);
+                  },
+                  options);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(pinnedOut[i][k], refMoved[i][k], 1e-4f);
+    }
+}
+
+// Vector3A: el carril w de la salida queda a 0 aunque el buffer traiga basura
+void test_padded_lanes() {
+    using namespace TinyGeo;
+    const size_t n = 1000;
+    std::vector<Vector3A> a(n), b(n), garbage(n), out(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = Vector3A(1.0f, float(i), 0.0f);
+        b[i] = Vector3A(0.0f, 1.0f, float(i));
+        for (size_t k = 0; k < 4; ++k) garbage[i].data[k] = 1e30f;
+    }
+    gpu::Stream stream;
+    gpu::DeviceBuffer<Vector3A> da(n), db(n), dv(n);
+    da.upload(Span<const Vector3A>(a), stream);
+    db.upload(Span<const Vector3A>(b), stream);
+    dv.upload(Span<const Vector3A>(garbage), stream);
+    gpu::cross(da.view(), db.view(), dv.view(), stream);
+    dv.download(Span<Vector3A>(out), stream);
+    stream.synchronize();
+    for (size_t i = 0; i < n; ++i) ASSERT_TRUE(out[i].data[3] == 0.0f);
+}
+
+int main() {
+    if (TinyGeo::gpu::deviceCount() == 0) {
+        std::cout << "No CUDA device: GPU tests skipped." << std::endl;
+        return 0;
+    }
+    test_batch_kernels();
+    test_transforms();
+    test_padded_lanes();
+    std::cout << "GPU tests passed." << std::endl;
+    return 0;
+}
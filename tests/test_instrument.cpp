@@ -0,0 +1,151 @@
+// Compilado con TINYGEO_INSTRUMENT (ver CMakeLists.txt)
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TinyGeo/Batch.h"
+#include "TinyGeo/Instrument.h"
+#include "TinyGeo/Predicates.h"
+#include "TinyGeo/ThreadPool.h"
+#include "TinyGeo/Vector.h"
+#include "TestCommon.h"
+
+// La instrumentación no rompe constexpr: en compilación no se cuenta nada
+#if TINYGEO_HAS_CONSTANT_EVALUATED
+constexpr TinyGeo::Vector<double, 2> kUnit = TinyGeo::Vector<double, 2>{3.0, 4.0}.normalized();
+static_assert(kUnit[0] > 0.59 && kUnit[0] < 0.61, "normalized() must stay constexpr");
+#endif
+
+void test_counters() {
+    using namespace TinyGeo;
+    using instrument::Counter;
+    instrument::reset();
+
+    Vector<float, 3> v = {3.0f, 0.0f, 4.0f};
+    Vector<float, 3> zero;
+    for (int i = 0; i < 10; ++i) {
+        v.normalized();
+    }
+    for (int i = 0; i < 3; ++i) {
+        zero.normalized();
+        zero.fastNormalized();
+    }
+    v.fastNormalized();
+    v /= 2.0f;
+
+    const instrument::Snapshot s = instrument::snapshot();
+    ASSERT_TRUE(s.enabled);
+    ASSERT_TRUE(s.counter(Counter::VectorNormalized) == 13);
+    ASSERT_TRUE(s.counter(Counter::VectorNormalizedZero) == 3);
+    ASSERT_TRUE(s.counter(Counter::VectorFastNormalized) == 4);
+    ASSERT_TRUE(s.counter(Counter::VectorFastNormalizedZero) == 3);
+#if !defined(TINYGEO_EXPRESSION_TEMPLATES)
+    // normalized() no nulo divide con operator/ -> operator/=
+    ASSERT_TRUE(s.counter(Counter::VectorDivAssign) == 11);
+#endif
+
+    instrument::reset();
+    ASSERT_TRUE(instrument::snapshot().counter(Counter::VectorNormalized) == 0);
+    std::cout << "[PASS] Instrument counters" << std::endl;
+}
+
+void test_threads() {
+    using namespace TinyGeo;
+    using instrument::Counter;
+    instrument::reset();
+
+    // Hilos que terminan: sus totales se conservan al retirarse
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            Vector<double, 2> w = {1.0, 1.0};
+            for (int i = 0; i < 1000; ++i) w.normalized();
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    // Hilos vivos del pool, leídos mientras siguen registrados
+    ThreadPool pool(3);
+    pool.parallelFor(300, 1, [](size_t b, size_t e) {
+        Vector<float, 2> w;
+        for (size_t i = b; i < e; ++i) w.normalized();
+    });
+
+    const instrument::Snapshot s = instrument::snapshot();
+    ASSERT_TRUE(s.counter(Counter::VectorNormalized) == 4300);
+    ASSERT_TRUE(s.counter(Counter::VectorNormalizedZero) == 300);
+    std::cout << "[PASS] Instrument per-thread buffers" << std::endl;
+}
+
+void test_timers_and_export() {
+    using namespace TinyGeo;
+    using instrument::Timer;
+    instrument::reset();
+
+    std::vector<Vector<float, 3>> pts(4096, Vector<float, 3>{1.0f, 2.0f, 2.0f});
+    for (int i = 0; i < 5; ++i) {
+        batch::normalize(Span<Vector<float, 3>>(pts));
+    }
+    batch::scale(Span<Vector<float, 3>>(pts), 2.0f);
+
+    const instrument::Snapshot s = instrument::snapshot();
+    const instrument::Histogram& h = s.timer(Timer::BatchNormalize);
+    ASSERT_TRUE(h.count == 5 && s.timer(Timer::BatchScale).count == 1);
+    uint64_t inBuckets = 0;
+    for (uint64_t b : h.buckets) inBuckets += b;
+    ASSERT_TRUE(inBuckets == 5 && h.sumNs > 0);
+    ASSERT_TRUE(instrument::bucketFor(0) == 0 && instrument::bucketFor(65) == 1);
+    ASSERT_TRUE(instrument::bucketFor(~uint64_t(0)) == instrument::kHistogramBuckets);
+
+    std::ostringstream os;
+    instrument::writePrometheus(os, s);
+    const std::string text = os.str();
+    ASSERT_TRUE(text.find("# TYPE tinygeo_ops_total counter\n") != std::string::npos);
+    ASSERT_TRUE(text.find("# TYPE tinygeo_kernel_duration_seconds histogram\n") != std::string::npos);
+    ASSERT_TRUE(text.find("tinygeo_kernel_duration_seconds_bucket{kernel=\"batch_normalize\",le=\"+Inf\"} 5\n") !=
+                std::string::npos);
+    ASSERT_TRUE(text.find("tinygeo_kernel_duration_seconds_count{kernel=\"batch_scale\"} 1\n") != std::string::npos);
+    ASSERT_TRUE(text.find("tinygeo_kernel_duration_seconds_bucket{kernel=\"batch_dot\",le=\"6.4e-08\"} 0\n") !=
+                std::string::npos);
+    std::cout << "[PASS] Instrument timers / Prometheus export" << std::endl;
+}
+
+// Entradas en rejilla: el filtro falla (determinante nulo) pero las
+// diferencias son exactas y la etapa B decide sin el exacto completo
+void test_predicate_stages() {
+    using namespace TinyGeo;
+    using instrument::Counter;
+    using V2 = Vector<double, 2>;
+    using V3 = Vector<double, 3>;
+    instrument::reset();
+
+    const V2 circle[] = {V2(5.0, 0.0), V2(3.0, 4.0), V2(0.0, 5.0), V2(-3.0, 4.0), V2(-4.0, -3.0), V2(4.0, -3.0)};
+    for (size_t i = 0; i + 3 < 6; ++i) {
+        ASSERT_TRUE(incircle(circle[i], circle[i + 1], circle[i + 2], circle[i + 3]) == 0.0);
+        ASSERT_TRUE(orient2d(V2(0.0, 0.0), circle[i], V2(circle[i].x() * 2.0, circle[i].y() * 2.0)) == 0.0);
+    }
+    const V3 a(1.0, 0.0, 0.0), b(0.0, 1.0, 0.0), c(0.0, 0.0, 1.0), d(-1.0, 0.0, 0.0), e(0.0, -1.0, 0.0);
+    ASSERT_TRUE(insphere(a, b, c, d, e) == 0.0);
+    ASSERT_TRUE(orient3d(a, b, c, V3(0.5, 0.0, 0.5)) == 0.0);
+
+    instrument::Snapshot s = instrument::snapshot();
+    ASSERT_TRUE(s.counter(Counter::PredicateExact) >= 5); // Al menos los incircle, insphere y orient3d
+    ASSERT_TRUE(s.counter(Counter::PredicateExactFull) == 0);
+
+    // Diferencias inexactas y casi degeneradas: sí llega a la etapa D
+    const double ulp = std::ldexp(1.0, -53);
+    ASSERT_TRUE(orient2d(V2(0.5 + ulp, 0.5), V2(12.0, 12.0), V2(24.0, 24.0)) != 0.0 ||
+                orient2d(V2(0.5 + 3 * ulp, 0.5 + ulp), V2(12.0, 12.0), V2(24.0, 24.0)) != 0.0);
+    s = instrument::snapshot();
+    ASSERT_TRUE(s.counter(Counter::PredicateExactFull) > 0);
+    std::cout << "[PASS] Instrument predicate stages" << std::endl;
+}
+
+int main() {
+    test_counters();
+    test_threads();
+    test_timers_and_export();
+    test_predicate_stages();
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <iostream>
+#include <type_traits>
+#include <vector>
+#include "TinyGeo/Matrix.h"
+#include "TestCommon.h"
+
+void test_matrix_vector() {
+    using namespace TinyGeo;
+    constexpr Matrix3f rotZ = {{0.0f, -1.0f, 0.0f},
+                               {1.0f, 0.0f, 0.0f},
+                               {0.0f, 0.0f, 1.0f}};
+    constexpr Vector<float, 3> x = {1.0f, 0.0f, 0.0f};
+    constexpr Vector<float, 3> y = rotZ * x; // Evaluado en compilación
+    static_assert(y[0] == 0.0f && y[1] == 1.0f);
+
+    Matrix<double, 2, 3> rect = {{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    Vector<double, 2> r = rect * Vector<double, 3>{1.0, 1.0, 1.0};
+    ASSERT_NEAR(r[0], 6.0, 1e-12);
+    ASSERT_NEAR(r[1], 15.0, 1e-12);
+
+    Matrix3f fromDoubles = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+    ASSERT_TRUE(fromDoubles(2, 2) == 1.0f);
+
+    // El número de filas se comprueba en compilación
+    static_assert(std::is_constructible_v<Matrix3f, Vector<float, 3>, Vector<float, 3>, Vector<float, 3>>);
+    static_assert(!std::is_constructible_v<Matrix3f, Vector<float, 3>, Vector<float, 3>>);
+    static_assert(!std::is_constructible_v<Matrix3f, Vector<float, 3>, Vector<float, 3>, Vector<float, 3>,
+                                           Vector<float, 3>>);
+
+    Matrix<double, 3, 2> t = rect.transposed();
+    ASSERT_NEAR(t(2, 1), 6.0, 1e-12);
+    ASSERT_NEAR(rect.column(1)[1], 5.0, 1e-12);
+
+    std::cout << "[PASS] Matrix * Vector" << std::endl;
+}
+
+template <size_t N>
+void check_matmul() {
+    using namespace TinyGeo;
+    Matrix<double, N, N> a, b;
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            a(i, j) = double(i + 2 * j) * 0.5;
+            b(i, j) = double(i) - double(j);
+        }
+    }
+    Matrix<double, N, N> c = a * b;
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            double ref = 0.0;
+            for (size_t k = 0; k < N; ++k) ref += a(i, k) * b(k, j);
+            ASSERT_NEAR(c(i, j), ref, 1e-9);
+        }
+    }
+    // Identidad
+    Matrix<double, N, N> ai = a * Matrix<double, N, N>::identity();
+    ASSERT_NEAR(ai(N - 1, N - 1), a(N - 1, N - 1), 1e-12);
+}
+
+void test_matrix_matrix() {
+    check_matmul<3>();
+    check_matmul<4>();
+    check_matmul<37>(); // Bloques parciales
+    std::cout << "[PASS] Matrix * Matrix" << std::endl;
+}
+
+void test_batch_transform() {
+    using namespace TinyGeo;
+    Matrix4f m = {{2.0f, 0.0f, 0.0f, 1.0f},
+                  {0.0f, 1.0f, 0.0f, 2.0f},
+                  {0.0f, 0.0f, 1.0f, 3.0f},
+                  {0.0f, 0.0f, 0.0f, 1.0f}};
+    std::vector<Vector<float, 3>> pts(101);
+    for (size_t i = 0; i < pts.size(); ++i) pts[i] = {float(i), 1.0f, -1.0f};
+
+    std::vector<Vector<float, 3>> out(pts.size());
+    transformPoints(m, Span(pts), Span(out));
+    for (size_t i = 0; i < pts.size(); ++i) {
+        Vector<float, 3> ref = transformPoint(m, pts[i]);
+        for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(out[i][k], ref[k], 1e-6f);
+    }
+    ASSERT_NEAR(out[10].x(), 21.0f, 1e-6f);
+    ASSERT_NEAR(transformDirection(m, pts[10]).z(), -1.0f, 1e-6f);
+
+    // In-place con una 3x3
+    Matrix3f s = Matrix3f::identity() * 3.0f;
+    transform(s, Span(pts));
+    ASSERT_NEAR(pts[5].x(), 15.0f, 1e-6f);
+
+    std::cout << "[PASS] Batch transform" << std::endl;
+}
+
+int main() {
+    test_matrix_vector();
+    test_matrix_matrix();
+    test_batch_transform();
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "TinyGeo/Memory.h"
+#include "TinyGeo/SpatialIndex.h"
+#include "TinyGeo/ThreadPool.h"
+#include "TinyGeo/VectorSoA.h"
+#include "TestCommon.h"
+
+namespace {
+    bool aligned(const void* p, size_t align) { return reinterpret_cast<uintptr_t>(p) % align == 0; }
+}
+
+void test_arena() {
+    using namespace TinyGeo;
+    Arena arena(4096);
+
+    void* a = arena.allocate(10, 16);
+    void* b = arena.allocate(100);
+    ASSERT_TRUE(aligned(a, 16) && aligned(b, kCacheLine));
+    ASSERT_TRUE(static_cast<char*>(b) >= static_cast<char*>(a) + 10);
+
+    // Reserva mayor que el bloque: recibe un bloque a medida
+    void* big = arena.allocate(100000);
+    ASSERT_TRUE(aligned(big, kCacheLine));
+    const size_t capacity = arena.capacity();
+    ASSERT_TRUE(capacity >= 4096 + 100000);
+
+    // reset() rebobina y reutiliza los mismos bloques sin pedir más
+    arena.reset();
+    ASSERT_TRUE(arena.allocate(10, 16) == a);
+    arena.allocate(100000);
+    ASSERT_TRUE(arena.capacity() == capacity);
+
+    // La última reserva se puede devolver (patrón pila)
+    arena.reset();
+    void* x = arena.allocate(64);
+    arena.deallocate(x, 64);
+    ASSERT_TRUE(arena.allocate(64) == x);
+
+    // ArenaScope: lo reservado dentro del ámbito se recupera al salir
+    arena.reset();
+    arena.allocate(128);
+    void* next = nullptr;
+    {
+        ArenaScope scope(arena);
+        next = arena.allocate(256);
+        arena.allocate(8000); // Fuerza un bloque nuevo
+    }
+    ASSERT_TRUE(arena.allocate(256) == next);
+
+    std::cout << "[PASS] Arena bump / reset / scope" << std::endl;
+}
+
+void test_arena_containers() {
+    using namespace TinyGeo;
+    ArenaPool frame(64 * 1024);
+
+    for (int f = 0; f < 3; ++f) {
+        std::vector<Vector<float, 3>, ArenaAllocator<Vector<float, 3>>> cloud(frame);
+        for (int i = 0; i < 1000; ++i) {
+            cloud.push_back({float(i), float(-i), 1.0f});
+        }
+        ASSERT_TRUE(aligned(cloud.data(), kCacheLine));
+
+        VectorSoA<float, 3, ArenaAllocator<float>> soa{ArenaAllocator<float>(frame)};
+        for (const auto& p : cloud) soa.push_back(p);
+        ASSERT_TRUE(aligned(soa.lane(1), kCacheLine));
+        ASSERT_NEAR(soa.get(999)[1], -999.0f, 1e-6f);
+
+        KdTree<float, 3, ArenaAllocator<float>> tree(
+            Span<const Vector<float, 3>>(cloud.data(), cloud.size()), 8, ArenaAllocator<float>(frame));
+        ASSERT_TRUE(tree.nearest({500.2f, -500.2f, 1.0f}).index == 500);
+
+        const size_t capacity = frame.capacity();
+        frame.reset();
+        // Tras el primer frame la memoria retenida basta
+        if (f > 0) ASSERT_TRUE(frame.capacity() == capacity);
+    }
+
+    std::cout << "[PASS] ArenaAllocator with std::vector / VectorSoA / KdTree" << std::endl;
+}
+
+void test_arena_pool_threads() {
+    using namespace TinyGeo;
+    ArenaPool frame;
+    ThreadPool pool(3);
+    std::vector<Arena*> owner(64, nullptr);
+
+    pool.parallelFor(owner.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Arena& local = frame.local();
+            ASSERT_TRUE(&frame.local() == &local); // Misma Arena en el mismo hilo
+            std::vector<double, ArenaAllocator<double>> scratch(local);
+            scratch.resize(1000, double(i));
+            ASSERT_TRUE(scratch[999] == double(i));
+            owner[i] = &local;
+        }
+    });
+    frame.reset();
+
+    // Un pool distinto entrega Arenas distintas en el mismo hilo
+    ArenaPool other;
+    ASSERT_TRUE(&other.local() != &frame.local());
+
+    // Muchos pools de vida corta en el mismo hilo (uno por frame): la caché
+    // descarta los muertos y los vivos siguen entregando su misma Arena
+    Arena& kept = frame.local();
+    for (int f = 0; f < 10000; ++f) {
+        ArenaPool perFrame(4096);
+        ArenaScope scope(perFrame.local());
+        ASSERT_TRUE(perFrame.local().allocate(64, 64) != nullptr);
+    }
+    ASSERT_TRUE(&frame.local() == &kept);
+
+    std::cout << "[PASS] ArenaPool per-thread arenas" << std::endl;
+}
+
+int main() {
+    test_arena();
+    test_arena_containers();
+    test_arena_pool_threads();
+    return 0;
+}
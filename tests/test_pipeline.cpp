@@ -0,0 +1,170 @@
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "TinyGeo/Pipeline.h"
+#include "TestCommon.h"
+
+namespace {
+
+    using V = TinyGeo::Vector<float, 3>;
+
+    std::vector<V> makePoints(size_t count) {
+        std::vector<V> pts(count);
+        for (size_t i = 0; i < count; ++i) {
+            pts[i] = {float(i % 100) - 50.0f, float(i % 7), float(i) * 0.001f};
+        }
+        return pts;
+    }
+
+    std::string tempPath(const char* name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    // Fuente que falla a mitad del stream
+    struct FailingSource {
+        size_t calls = 0;
+        size_t read(TinyGeo::Span<V> out) {
+            if (++calls == 3) throw std::runtime_error("disk on fire");
+            for (V& v : out) v = {1.0f, 0.0f, 0.0f};
+            return out.size();
+        }
+    };
+
+} // namespace
+
+void test_pipeline_memory() {
+    using namespace TinyGeo;
+    const std::vector<V> pts = makePoints(10007); // No múltiplo del chunk
+    stream::SpanSource<V> source{Span<const V>(pts)};
+    stream::VectorSink<V> sink;
+    AABB3f before, after;
+
+    stream::PipelineStats stats = stream::Pipeline<V>(256)
+        .bounds(before)
+        .filter([](const V& p) { return p[1] != 0.0f; })
+        .transform([](const V& p) { return p * 2.0f; })
+        .normalize()
+        .bounds(after)
+        .run(source, sink);
+
+    ASSERT_TRUE(stats.read == pts.size());
+    ASSERT_TRUE(stats.chunks == (pts.size() + 255) / 256);
+    ASSERT_NEAR(before.lo[0], -50.0f, 1e-6f);
+    ASSERT_NEAR(before.hi[2], 10.006f, 1e-3f);
+
+    // Referencia en memoria (mismo orden: el filtro es estable)
+    std::vector<V> expected;
+    for (const V& p : pts) {
+        if (p[1] != 0.0f) {
+            V q = p * 2.0f;
+            expected.push_back(q.normalized());
+        }
+    }
+    ASSERT_TRUE(stats.written == expected.size() && sink.data.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(sink.data[i][k], expected[i][k], 1e-5f);
+        ASSERT_TRUE(after.contains(sink.data[i]));
+    }
+
+    std::cout << "[PASS] Pipeline stages over memory source" << std::endl;
+}
+
+void test_pipeline_files() {
+    using namespace TinyGeo;
+    const std::string inPath = tempPath("tinygeo_stream_in.tgpc");
+    const std::string outPath = tempPath("tinygeo_stream_out.tgpc");
+    const std::vector<V> pts = makePoints(5000);
+    io::writePointCloud(inPath, Span<const V>(pts));
+
+    {
+        stream::FileSource<V> in(inPath, stream::Format::PointCloud);
+        stream::FileSink<V> out(outPath, stream::Format::PointCloud);
+        stream::Pipeline<V>(1000)
+            .filter([](const V& p) { return p[0] >= 0.0f; })
+            .run(in, out);
+        out.close();
+    }
+
+    // La salida es un .tgpc válido que se puede mapear sin copia
+    io::MappedPointCloud result(outPath);
+    Span<const V> view = result.points<float, 3>();
+    ASSERT_TRUE(view.size() == 2500);
+    for (const V& p : view) ASSERT_TRUE(p[0] >= 0.0f);
+
+    // Formato equivocado: error de cabecera al abrir
+    bool threw = false;
+    try {
+        stream::FileSource<Vector<double, 3>> wrong(inPath, stream::Format::PointCloud);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+
+    std::remove(inPath.c_str());
+    std::remove(outPath.c_str());
+    std::cout << "[PASS] Pipeline file source / sink" << std::endl;
+}
+
+void test_pipeline_pipe_and_errors() {
+    using namespace TinyGeo;
+    // Registros crudos por un pipe (mismo camino que un socket)
+    int fds[2];
+    ASSERT_TRUE(::pipe(fds) == 0);
+    const std::vector<V> pts = makePoints(300);
+    std::thread producer([&] {
+        stream::FdSink<V> sink(fds[1]);
+        for (size_t i = 0; i < pts.size(); i += 7) {
+            sink.write(Span<const V>(pts.data() + i, std::min<size_t>(7, pts.size() - i)));
+        }
+        ::close(fds[1]);
+    });
+    stream::FdSource<V> source(fds[0]);
+    AABB3f box;
+    stream::PipelineStats stats = stream::Pipeline<V>(64).bounds(box).run(source);
+    producer.join();
+    ::close(fds[0]);
+    ASSERT_TRUE(stats.read == pts.size() && stats.written == pts.size());
+    ASSERT_NEAR(box.hi[1], 6.0f, 1e-6f);
+
+    // Una fuente que lanza detiene el pipeline y la excepción llega a run()
+    FailingSource failing;
+    stream::VectorSink<V> sink;
+    bool threw = false;
+    try {
+        stream::Pipeline<V>(16).normalize().run(failing, sink);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+
+    // Cabecera que no se puede escribir (/dev/full: open() funciona, write()
+    // da ENOSPC): el constructor lanza sin dejar el descriptor abierto.
+    // Sin fuga, el descriptor libre más bajo no cambia.
+    if (std::filesystem::exists("/dev/full")) {
+        const int before = ::dup(0);
+        ::close(before);
+        threw = false;
+        try {
+            stream::FileSink<V> full("/dev/full", stream::Format::PointCloud);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        ASSERT_TRUE(threw);
+        const int after = ::dup(0);
+        ::close(after);
+        ASSERT_TRUE(after == before);
+    }
+
+    std::cout << "[PASS] Pipeline over a pipe, errors propagate" << std::endl;
+}
+
+int main() {
+    test_pipeline_memory();
+    test_pipeline_files();
+    test_pipeline_pipe_and_errors();
+    return 0;
+}
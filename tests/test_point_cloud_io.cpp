@@ -0,0 +1,150 @@
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "TinyGeo/PointCloudIO.h"
+#include "TestCommon.h"
+
+namespace {
+
+    std::string tempPath(const char* name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    // true si construir/consultar lanza std::runtime_error
+    template <typename Fn>
+    bool throws(Fn&& fn) {
+        try {
+            fn();
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+
+} // namespace
+
+void test_aos_roundtrip() {
+    using namespace TinyGeo;
+    const std::string path = tempPath("tinygeo_aos.tgpc");
+    std::vector<Vector<float, 3>> pts(1001);
+    for (size_t i = 0; i < pts.size(); ++i) {
+        pts[i] = {float(i), float(i) * 0.5f, -float(i)};
+    }
+    io::writePointCloud(path, Span<const Vector<float, 3>>(pts));
+
+    io::MappedPointCloud cloud(path);
+    cloud.advise(io::MappedPointCloud::Access::Sequential);
+    ASSERT_TRUE(cloud.size() == pts.size());
+    ASSERT_TRUE(cloud.header().dataOffset % kCacheLine == 0);
+
+    Span<const Vector<float, 3>> view = cloud.points<float, 3>();
+    ASSERT_TRUE(view.size() == pts.size());
+    for (size_t i = 0; i < pts.size(); ++i) {
+        ASSERT_TRUE(view[i][0] == pts[i][0] && view[i][1] == pts[i][1] && view[i][2] == pts[i][2]);
+    }
+
+    // Tipo equivocado: error claro en vez de reinterpretar bytes
+    ASSERT_TRUE(throws([&] { cloud.points<double, 3>(); }));
+    ASSERT_TRUE(throws([&] { cloud.points<float, 2>(); }));
+    ASSERT_TRUE(throws([&] { cloud.points<float, 3, AlignedStorage>(); })); // stride 16 != 12
+    ASSERT_TRUE(throws([&] { cloud.lanes<float, 3>(); }));
+
+    // Storage alineado: el padding viaja con los datos
+    std::vector<Vector3A> padded(pts.begin(), pts.end());
+    io::writePointCloud(path, Span<const Vector3A>(padded));
+    io::MappedPointCloud aligned(path);
+    Span<const Vector3A> pv = aligned.points<float, 3, AlignedStorage>();
+    ASSERT_TRUE(reinterpret_cast<uintptr_t>(pv.data()) % 16 == 0);
+    ASSERT_TRUE(pv[1000][2] == -1000.0f && pv[1000].data[3] == 0.0f);
+
+    std::remove(path.c_str());
+    std::cout << "[PASS] AoS point cloud mmap round trip" << std::endl;
+}
+
+void test_soa_roundtrip() {
+    using namespace TinyGeo;
+    const std::string path = tempPath("tinygeo_soa.tgpc");
+    VectorSoA<double, 3> soa;
+    for (size_t i = 0; i < 77; ++i) {
+        soa.push_back({double(i), 1.0, -double(i) * 2.0});
+    }
+    io::writePointCloud(path, soa);
+
+    io::MappedPointCloud cloud(path);
+    io::SoAView<double, 3> view = cloud.lanes<double, 3>();
+    ASSERT_TRUE(view.size() == 77);
+    for (size_t k = 0; k < 3; ++k) {
+        ASSERT_TRUE(reinterpret_cast<uintptr_t>(view.lane(k).data()) % kCacheLine == 0);
+    }
+    ASSERT_TRUE(view.lane(2)[76] == -152.0);
+    ASSERT_TRUE(view.get(10)[0] == 10.0);
+    ASSERT_TRUE(throws([&] { cloud.points<double, 3>(); }));
+
+    std::remove(path.c_str());
+    std::cout << "[PASS] SoA point cloud mmap round trip" << std::endl;
+}
+
+void test_invalid_files() {
+    using namespace TinyGeo;
+    const std::string path = tempPath("tinygeo_bad.tgpc");
+    ASSERT_TRUE(throws([&] { io::MappedPointCloud missing(tempPath("tinygeo_missing.tgpc")); }));
+
+    { std::ofstream(path, std::ios::binary) << "not a point cloud"; }
+    ASSERT_TRUE(throws([&] { io::MappedPointCloud tiny(path); }));
+
+    // Cabecera válida pero datos truncados
+    std::vector<Vector<float, 2>> pts(100);
+    io::writePointCloud(path, Span<const Vector<float, 2>>(pts));
+    std::filesystem::resize_file(path, 64 + 10 * sizeof(Vector<float, 2>));
+    ASSERT_TRUE(throws([&] { io::MappedPointCloud truncated(path); }));
+
+    // Cabeceras manipuladas: tamaños que desbordan uint64 al multiplicar
+    auto rewrite = [&](auto edit) {
+        io::writePointCloud(path, Span<const Vector<float, 2>>(pts));
+        io::PointCloudHeader h{};
+        {
+            std::ifstream in(path, std::ios::binary);
+            in.read(reinterpret_cast<char*>(&h), sizeof(h));
+        }
+        edit(h);
+        std::fstream io(path, std::ios::binary | std::ios::in | std::ios::out);
+        io.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    };
+    rewrite([](io::PointCloudHeader& h) { h.count = (uint64_t(1) << 61) + 1; }); // count * 8 == 8
+    ASSERT_TRUE(throws([&] { io::MappedPointCloud wrapped(path); }));
+    rewrite([](io::PointCloudHeader& h) { h.dataOffset = ~uint64_t(0) - 63; });
+    ASSERT_TRUE(throws([&] { io::MappedPointCloud offset(path); }));
+    rewrite([](io::PointCloudHeader& h) { h.alignment = 24; });
+    ASSERT_TRUE(throws([&] { io::MappedPointCloud alignment(path); }));
+    rewrite([](io::PointCloudHeader& h) {
+        h.layout = io::Layout::SoA;
+        h.laneStride = (uint64_t(1) << 62) + 32; // laneStride * 2 * 8 desborda a 512
+        h.count = 100;
+        h.stride = 8;
+    });
+    ASSERT_TRUE(throws([&] { io::MappedPointCloud lanes(path); }));
+    rewrite([](io::PointCloudHeader& h) {
+        h.layout = io::Layout::SoA;
+        h.laneStride = 100;
+        h.stride = 1; // Menor que sizeof(float): lanes() leería de más
+    });
+    {
+        io::MappedPointCloud cloud(path);
+        ASSERT_TRUE(throws([&] { cloud.lanes<float, 2>(); }));
+    }
+
+    std::remove(path.c_str());
+    std::cout << "[PASS] Invalid point cloud files are rejected" << std::endl;
+}
+
+int main() {
+    test_aos_roundtrip();
+    test_soa_roundtrip();
+    test_invalid_files();
+    return 0;
+}
@@ -0,0 +1,379 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "TinyGeo/Predicates.h"
+#include "TestCommon.h"
+
+namespace {
+
+    using TinyGeo::Vector;
+    using V2 = Vector<double, 2>;
+    using V3 = Vector<double, 3>;
+
+    uint32_t nextRandom(uint32_t& s) {
+        s = s * 1664525u + 1013904223u;
+        return s;
+    }
+
+    double uniform(uint32_t& s, double lo, double hi) {
+        return lo + (hi - lo) * double(nextRandom(s) >> 8) / double(1u << 24);
+    }
+
+    int sign(double v) { return v > 0.0 ? 1 : (v < 0.0 ? -1 : 0); }
+
+    // Entero con signo de precisión arbitraria: referencia exacta
+    // independiente de la aritmética de expansiones.
+    struct BigInt {
+        bool negative = false;
+        std::vector<uint32_t> limbs; // Little endian, sin ceros a la izquierda
+
+        void trim() {
+            while (!limbs.empty() && limbs.back() == 0) limbs.pop_back();
+            if (limbs.empty()) negative = false;
+        }
+
+        int sign() const { return limbs.empty() ? 0 : (negative ? -1 : 1); }
+
+        static int compareMagnitude(const BigInt& a, const BigInt& b) {
+            if (a.limbs.size() != b.limbs.size()) return a.limbs.size() < b.limbs.size() ? -1 : 1;
+            for (size_t i = a.limbs.size(); i-- > 0;) {
+                if (a.limbs[i] != b.limbs[i]) return a.limbs[i] < b.limbs[i] ? -1 : 1;
+            }
+            return 0;
+        }
+
+        static BigInt addMagnitude(const BigInt& a, const BigInt& b) {
+            BigInt r;
+            uint64_t carry = 0;
+            for (size_t i = 0; i < std::max(a.limbs.size(), b.limbs.size()); ++i) {
+                const uint64_t s = carry + (i < a.limbs.size() ? a.limbs[i] : 0) + (i < b.limbs.size() ? b.limbs[i] : 0);
+                r.limbs.push_back(uint32_t(s));
+                carry = s >> 32;
+            }
+            if (carry) r.limbs.push_back(uint32_t(carry));
+            return r;
+        }
+
+        // |a| >= |b|
+        static BigInt subMagnitude(const BigInt& a, const BigInt& b) {
+            BigInt r;
+            int64_t borrow = 0;
+            for (size_t i = 0; i < a.limbs.size(); ++i) {
+                int64_t d = int64_t(a.limbs[i]) - borrow - (i < b.limbs.size() ? int64_t(b.limbs[i]) : 0);
+                borrow = d < 0;
+                if (d < 0) d += int64_t(1) << 32;
+                r.limbs.push_back(uint32_t(d));
+            }
+            r.trim();
+            return r;
+        }
+
+        friend BigInt operator+(const BigInt& a, const BigInt& b) {
+            BigInt r;
+            if (a.negative == b.negative) {
+                r = addMagnitude(a, b);
+                r.negative = a.negative;
+            } else if (compareMagnitude(a, b) >= 0) {
+                r = subMagnitude(a, b);
+                r.negative = a.negative;
+            } else {
+                r = subMagnitude(b, a);
+                r.negative = b.negative;
+            }
+            r.trim();
+            return r;
+        }
+
+        friend BigInt operator-(BigInt a) {
+            a.negative = !a.negative;
+            a.trim();
+            return a;
+        }
+
+        friend BigInt operator-(const BigInt& a, const BigInt& b) { return a + (-b); }
+
+        friend BigInt operator*(const BigInt& a, const BigInt& b) {
+            BigInt r;
+            r.limbs.assign(a.limbs.size() + b.limbs.size(), 0);
+            for (size_t i = 0; i < a.limbs.size(); ++i) {
+                uint64_t carry = 0;
+                for (size_t j = 0; j < b.limbs.size(); ++j) {
+                    const uint64_t t = uint64_t(a.limbs[i]) * b.limbs[j] + r.limbs[i + j] + carry;
+                    r.limbs[i + j] = uint32_t(t);
+                    carry = t >> 32;
+                }
+                r.limbs[i + b.limbs.size()] += uint32_t(carry);
+            }
+            r.negative = a.negative != b.negative;
+            r.trim();
+            return r;
+        }
+    };
+
+    // Todas las coordenadas son múltiplos enteros de 2^kMinExp
+    constexpr int kMinExp = -200;
+
+    BigInt exact(double v) {
+        int e;
+        const double m = std::frexp(v, &e); // v = m * 2^e, 0.5 <= |m| < 1
+        const int64_t mantissa = int64_t(std::ldexp(m, 53));
+        const int shift = e - 53 - kMinExp;
+        if (shift < 0) std::abort(); // Fuera del rango de la referencia
+        const uint64_t mag = uint64_t(mantissa < 0 ? -mantissa : mantissa);
+        BigInt r;
+        r.limbs.assign(size_t(shift / 32) + 3, 0);
+        const unsigned bits = unsigned(shift % 32);
+        const size_t base = size_t(shift / 32);
+        r.limbs[base] = uint32_t(mag << bits);
+        r.limbs[base + 1] = uint32_t((mag << bits) >> 32);
+        r.limbs[base + 2] = bits ? uint32_t(mag >> (64 - bits)) : 0;
+        r.negative = mantissa < 0;
+        r.trim();
+        return r;
+    }
+
+    BigInt det2(const BigInt& a, const BigInt& b, const BigInt& c, const BigInt& d) { return a * d - b * c; }
+
+    BigInt det3(const BigInt (&m)[3][3]) {
+        return m[0][0] * det2(m[1][1], m[1][2], m[2][1], m[2][2]) - m[0][1] * det2(m[1][0], m[1][2], m[2][0], m[2][2]) +
+               m[0][2] * det2(m[1][0], m[1][1], m[2][0], m[2][1]);
+    }
+
+    BigInt det4(const BigInt (&m)[4][4]) {
+        BigInt r;
+        for (size_t col = 0; col < 4; ++col) {
+            BigInt minor[3][3];
+            for (size_t i = 1; i < 4; ++i) {
+                for (size_t j = 0, k = 0; j < 4; ++j) {
+                    if (j != col) minor[i - 1][k++] = m[i][j];
+                }
+            }
+            const BigInt term = m[0][col] * det3(minor);
+            r = (col % 2 == 0) ? r + term : r - term;
+        }
+        return r;
+    }
+
+    int refOrient2d(const V2& a, const V2& b, const V2& c) {
+        return det2(exact(a.x()) - exact(c.x()), exact(a.y()) - exact(c.y()), exact(b.x()) - exact(c.x()),
+                    exact(b.y()) - exact(c.y()))
+            .sign();
+    }
+
+    int refOrient3d(const V3& a, const V3& b, const V3& c, const V3& d) {
+        const V3* rows[3] = {&a, &b, &c};
+        BigInt m[3][3];
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 3; ++j) m[i][j] = exact(rows[i]->data[j]) - exact(d.data[j]);
+        }
+        return det3(m).sign();
+    }
+
+    int refIncircle(const V2& a, const V2& b, const V2& c, const V2& d) {
+        const V2* rows[3] = {&a, &b, &c};
+        BigInt m[3][3];
+        for (size_t i = 0; i < 3; ++i) {
+            m[i][0] = exact(rows[i]->x()) - exact(d.x());
+            m[i][1] = exact(rows[i]->y()) - exact(d.y());
+            m[i][2] = m[i][0] * m[i][0] + m[i][1] * m[i][1];
+        }
+        return det3(m).sign();
+    }
+
+    // Filas (x, y, z, |p|^2) relativas a e
+    int refInsphere(const V3& a, const V3& b, const V3& c, const V3& d, const V3& e) {
+        const V3* rows[4] = {&a, &b, &c, &d};
+        BigInt m[4][4];
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 3; ++j) m[i][j] = exact(rows[i]->data[j]) - exact(e.data[j]);
+            m[i][3] = m[i][0] * m[i][0] + m[i][1] * m[i][1] + m[i][2] * m[i][2];
+        }
+        return det4(m).sign();
+    }
+
+} // namespace
+
+void test_conventions() {
+    using namespace TinyGeo;
+    ASSERT_TRUE(orient2d(V2(0.0, 0.0), V2(1.0, 0.0), V2(0.0, 1.0)) > 0.0);
+    ASSERT_TRUE(orient2d(V2(0.0, 0.0), V2(0.0, 1.0), V2(1.0, 0.0)) < 0.0);
+    ASSERT_TRUE(orient2d(V2(0.0, 0.0), V2(1.0, 1.0), V2(3.0, 3.0)) == 0.0);
+
+    const V3 a(0.0, 0.0, 0.0), b(1.0, 0.0, 0.0), c(0.0, 1.0, 0.0);
+    ASSERT_TRUE(orient3d(a, b, c, V3(0.0, 0.0, -1.0)) > 0.0);
+    ASSERT_TRUE(orient3d(a, b, c, V3(0.0, 0.0, 1.0)) < 0.0);
+    ASSERT_TRUE(orient3d(a, b, c, V3(0.3, 0.7, 0.0)) == 0.0);
+
+    // Puntos exactamente cocirculares / coesféricos
+    const V2 e(1.0, 0.0), n(0.0, 1.0), w(-1.0, 0.0), s(0.0, -1.0);
+    ASSERT_TRUE(incircle(e, n, w, V2(0.0, 0.0)) > 0.0);
+    ASSERT_TRUE(incircle(e, n, w, V2(2.0, 0.0)) < 0.0);
+    ASSERT_TRUE(incircle(e, n, w, s) == 0.0);
+
+    const V3 px(1.0, 0.0, 0.0), py(0.0, 1.0, 0.0), pz(0.0, 0.0, 1.0), nx(-1.0, 0.0, 0.0);
+    ASSERT_TRUE(orient3d(px, py, pz, nx) > 0.0);
+    ASSERT_TRUE(insphere(px, py, pz, nx, V3(0.0, 0.0, 0.0)) > 0.0);
+    ASSERT_TRUE(insphere(px, py, pz, nx, V3(0.0, 0.0, 3.0)) < 0.0);
+    ASSERT_TRUE(insphere(px, py, pz, nx, V3(0.0, -1.0, 0.0)) == 0.0);
+    ASSERT_TRUE(refInsphere(px, py, pz, nx, V3(0.0, 0.0, 0.0)) > 0);
+
+    // float e int se evalúan sin pérdida en double
+    using F2 = Vector<float, 2>;
+    ASSERT_TRUE(orient2d(F2(0.0f, 0.0f), F2(1.0f, 0.0f), F2(0.0f, 1.0f)) > 0.0);
+    using I2 = Vector<int, 2>;
+    ASSERT_TRUE(incircle(I2(1, 0), I2(0, 1), I2(-1, 0), I2(0, -1)) == 0.0);
+}
+
+// Kettner et al., "Classroom examples of robustness problems": una rejilla
+// de 256x256 ulps alrededor de (0.5, 0.5) contra la recta y = x
+void test_orient2d_near_degenerate() {
+    using namespace TinyGeo;
+    const double ulp = std::ldexp(1.0, -53);
+    const V2 q(12.0, 12.0), r(24.0, 24.0);
+    size_t naiveWrong = 0, zeros = 0;
+    for (int i = 0; i < 256; ++i) {
+        for (int j = 0; j < 256; ++j) {
+            const V2 p(0.5 + i * ulp, 0.5 + j * ulp);
+            const int expected = refOrient2d(p, q, r);
+            ASSERT_TRUE(sign(orient2d(p, q, r)) == expected);
+            ASSERT_TRUE(sign(orient2d(q, r, p)) == expected);
+            ASSERT_TRUE(sign(orient2d(q, p, r)) == -expected);
+            const double naive = (p.x() - r.x()) * (q.y() - r.y()) - (p.y() - r.y()) * (q.x() - r.x());
+            naiveWrong += sign(naive) != expected;
+            zeros += expected == 0;
+        }
+    }
+    // La rejilla tiene que ser un caso difícil de verdad
+    ASSERT_TRUE(naiveWrong > 0);
+    ASSERT_TRUE(zeros > 0);
+}
+
+void test_orient3d_near_degenerate() {
+    using namespace TinyGeo;
+    uint32_t seed = 7;
+    // Puntos del plano x + y + z = 1 redondeados a double: casi coplanares
+    auto onPlane = [&] {
+        const double x = uniform(seed, -10.0, 10.0), y = uniform(seed, -10.0, 10.0);
+        return V3(x, y, 1.0 - x - y);
+    };
+    size_t naiveWrong = 0;
+    for (int it = 0; it < 2000; ++it) {
+        const V3 a = onPlane(), b = onPlane(), c = onPlane();
+        V3 d = onPlane();
+        if (it % 3 == 1) d = V3(d.x(), d.y(), std::nextafter(d.z(), 100.0));
+        if (it % 3 == 2) d = V3(std::nextafter(d.x(), -100.0), d.y(), d.z());
+        const int expected = refOrient3d(a, b, c, d);
+        ASSERT_TRUE(sign(orient3d(a, b, c, d)) == expected);
+        ASSERT_TRUE(sign(orient3d(b, a, c, d)) == -expected);
+
+        const V3 ad = a - d, bd = b - d, cd = c - d;
+        const double naive = ad.z() * (bd.x() * cd.y() - cd.x() * bd.y()) +
+                             bd.z() * (cd.x() * ad.y() - ad.x() * cd.y()) +
+                             cd.z() * (ad.x() * bd.y() - bd.x() * ad.y());
+        naiveWrong += sign(naive) != expected;
+    }
+    ASSERT_TRUE(naiveWrong > 0);
+}
+
+void test_incircle_near_degenerate() {
+    using namespace TinyGeo;
+    uint32_t seed = 11;
+    // Puntos de un círculo desplazado del origen: cocirculares salvo redondeo
+    const double cx = 1234.5, cy = -77.25, radius = 3.0;
+    auto onCircle = [&] {
+        const double t = uniform(seed, 0.0, 6.283185307179586);
+        return V2(cx + radius * std::cos(t), cy + radius * std::sin(t));
+    };
+    for (int it = 0; it < 2000; ++it) {
+        const V2 a = onCircle(), b = onCircle(), c = onCircle(), d = onCircle();
+        const int expected = refIncircle(a, b, c, d);
+        ASSERT_TRUE(sign(incircle(a, b, c, d)) == expected);
+        ASSERT_TRUE(sign(incircle(b, a, c, d)) == -expected);
+    }
+
+    // Lejos de la degeneración el filtro decide y el resultado coincide
+    for (int it = 0; it < 1000; ++it) {
+        const V2 a(uniform(seed, -1.0, 1.0), uniform(seed, -1.0, 1.0));
+        const V2 b(uniform(seed, -1.0, 1.0), uniform(seed, -1.0, 1.0));
+        const V2 c(uniform(seed, -1.0, 1.0), uniform(seed, -1.0, 1.0));
+        const V2 d(uniform(seed, -1.0, 1.0), uniform(seed, -1.0, 1.0));
+        ASSERT_TRUE(sign(incircle(a, b, c, d)) == refIncircle(a, b, c, d));
+        ASSERT_TRUE(sign(orient2d(a, b, c)) == refOrient2d(a, b, c));
+    }
+}
+
+void test_insphere_near_degenerate() {
+    using namespace TinyGeo;
+    uint32_t seed = 13;
+    const V3 center(10.5, -3.25, 0.125);
+    // -> V3: en modo expression templates "center + ..." sería un nodo perezoso
+    // que apunta al temporal V3(...) destruido al volver de la lambda
+    auto onSphere = [&]() -> V3 {
+        const double z = uniform(seed, -1.0, 1.0), t = uniform(seed, 0.0, 6.283185307179586);
+        const double r = std::sqrt(1.0 - z * z);
+        return center + V3(r * std::cos(t), r * std::sin(t), z) * 2.0;
+    };
+    for (int it = 0; it < 300; ++it) {
+        const V3 a = onSphere(), b = onSphere(), c = onSphere(), d = onSphere(), e = onSphere();
+        const int expected = refInsphere(a, b, c, d, e);
+        ASSERT_TRUE(sign(insphere(a, b, c, d, e)) == expected);
+        ASSERT_TRUE(sign(insphere(b, a, c, d, e)) == -expected);
+    }
+
+    // Cinco puntos exactamente coesféricos con coordenadas de magnitudes dispares
+    const V3 p0(1e-30, 0.0, 0.0), p1(-1e-30, 0.0, 0.0), p2(0.0, 1e-30, 0.0), p3(0.0, 0.0, 1e-30);
+    ASSERT_TRUE(refInsphere(p0, p1, p2, p3, V3(0.0, -1e-30, 0.0)) == 0);
+    ASSERT_TRUE(insphere(p0, p1, p2, p3, V3(0.0, -1e-30, 0.0)) == 0.0);
+}
+
+// Etapa D por separado (normalmente B la oculta): coordenadas de magnitudes
+// dispares, cuyas diferencias pierden bits, contra la referencia BigInt
+void test_full_exact_stage() {
+    using namespace TinyGeo;
+    uint32_t seed = 17;
+    auto point = [&] { return V3(uniform(seed, -1.0, 1.0) * 1e3, uniform(seed, -1.0, 1.0) * 1e-3, uniform(seed, -1.0, 1.0)); };
+    for (int it = 0; it < 200; ++it) {
+        const V3 p[5] = {point(), point(), point(), point(), point()};
+
+        double raw[5][3];
+        for (size_t k = 0; k < 5; ++k) {
+            for (size_t i = 0; i < 3; ++i) raw[k][i] = p[k].data[i];
+        }
+        ASSERT_TRUE(sign(detail::insphereExact(raw).estimate()) == refInsphere(p[0], p[1], p[2], p[3], p[4]));
+
+        double lhs[9], rhs[9];
+        for (size_t i = 0; i < 3; ++i) {
+            lhs[i] = p[0].data[i];
+            lhs[3 + i] = p[1].data[i];
+            lhs[6 + i] = p[2].data[i];
+            rhs[i] = rhs[3 + i] = rhs[6 + i] = p[3].data[i];
+        }
+        const double o3 = detail::stageD(lhs, rhs, [](const auto& e) {
+            return detail::orient3dDet(e[0], e[1], e[2], e[3], e[4], e[5], e[6], e[7], e[8]);
+        });
+        ASSERT_TRUE(sign(o3) == refOrient3d(p[0], p[1], p[2], p[3]));
+
+        const V2 q[4] = {V2(p[0].x(), p[0].y()), V2(p[1].x(), p[1].y()), V2(p[2].x(), p[2].y()), V2(p[3].x(), p[3].y())};
+        const double l2[6] = {q[0].x(), q[0].y(), q[1].x(), q[1].y(), q[2].x(), q[2].y()};
+        const double r2[6] = {q[3].x(), q[3].y(), q[3].x(), q[3].y(), q[3].x(), q[3].y()};
+        const double ic = detail::stageD(l2, r2, [](const auto& e) { return detail::incircleDet(e[0], e[1], e[2], e[3], e[4], e[5]); });
+        ASSERT_TRUE(sign(ic) == refIncircle(q[0], q[1], q[2], q[3]));
+    }
+
+    // Coesféricos exactos: el 5x5 sobre coordenadas originales da cero
+    const double cosphere[5][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}, {-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}};
+    ASSERT_TRUE(detail::insphereExact(cosphere).sign() == 0);
+}
+
+int main() {
+    test_conventions();
+    test_orient2d_near_degenerate();
+    test_orient3d_near_degenerate();
+    test_incircle_near_degenerate();
+    test_insphere_near_degenerate();
+    test_full_exact_stage();
+    std::cout << "Predicates tests passed." << std::endl;
+    return 0;
+}
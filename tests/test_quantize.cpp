@@ -0,0 +1,153 @@
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "TinyGeo/Quantize.h"
+#include "TestCommon.h"
+
+namespace {
+
+    uint32_t nextRandom(uint32_t& s) {
+        s = s * 1664525u + 1013904223u;
+        return s;
+    }
+
+    float uniform(uint32_t& s, float lo, float hi) {
+        return lo + (hi - lo) * float(nextRandom(s) >> 8) / float(1u << 24);
+    }
+
+} // namespace
+
+void test_half() {
+    using namespace TinyGeo;
+    // Todos los half no NaN sobreviven half -> float -> half
+    for (uint32_t h = 0; h < 0x10000u; ++h) {
+        const float f = fromHalf(uint16_t(h));
+        if (std::isnan(f)) {
+            ASSERT_TRUE(std::isnan(fromHalf(toHalf(f))));
+            continue;
+        }
+        ASSERT_TRUE(toHalf(f) == h);
+    }
+
+    ASSERT_TRUE(toHalf(1.0f) == 0x3c00u);
+    ASSERT_TRUE(toHalf(-2.0f) == 0xc000u);
+    ASSERT_TRUE(toHalf(65504.0f) == 0x7bffu);
+    ASSERT_TRUE(toHalf(1e6f) == 0x7c00u);
+    ASSERT_TRUE(toHalf(-std::numeric_limits<float>::infinity()) == 0xfc00u);
+    ASSERT_TRUE(toHalf(1e-10f) == 0u);
+    ASSERT_TRUE(fromHalf(0x0001u) == std::ldexp(1.0f, -24)); // Menor denormal
+    // Empate exacto: 1 + 2^-11 redondea al par (1), 1 + 3 * 2^-11 a 1 + 2^-9
+    ASSERT_TRUE(toHalf(1.0f + std::ldexp(1.0f, -11)) == 0x3c00u);
+    ASSERT_TRUE(toHalf(1.0f + 3.0f * std::ldexp(1.0f, -11)) == 0x3c02u);
+
+    // Error relativo documentado en el rango normal y lotes == escalar
+    uint32_t s = 11u;
+    std::vector<float> values(1003);
+    for (float& v : values) v = uniform(s, -60000.0f, 60000.0f);
+    std::vector<uint16_t> halves(values.size());
+    std::vector<float> back(values.size());
+    batch::toHalf(Span<const float>(values), Span<uint16_t>(halves));
+    batch::fromHalf(Span<const uint16_t>(halves), Span<float>(back));
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_TRUE(halves[i] == toHalf(values[i]));
+        ASSERT_TRUE(back[i] == fromHalf(halves[i]));
+        if (std::abs(values[i]) >= 6.2e-5f) {
+            ASSERT_TRUE(std::abs(back[i] - values[i]) <= std::ldexp(std::abs(values[i]), -11));
+        }
+    }
+    std::cout << "[PASS] Half float" << (TINYGEO_HAS_F16C ? " (F16C)" : "") << std::endl;
+}
+
+void test_octahedral() {
+    using namespace TinyGeo;
+    uint32_t s = 5u;
+    std::vector<Vector<float, 3>> normals;
+    for (size_t i = 0; i < 20000; ++i) {
+        Vector<float, 3> n = {uniform(s, -1.0f, 1.0f), uniform(s, -1.0f, 1.0f), uniform(s, -1.0f, 1.0f)};
+        if (n.normSq() < 1e-4f) continue;
+        normals.push_back(n.normalized());
+    }
+    // Ejes y diagonales: los casos frontera del plegado
+    normals.push_back({0.0f, 0.0f, 1.0f});
+    normals.push_back({0.0f, 0.0f, -1.0f});
+    normals.push_back({-1.0f, 0.0f, 0.0f});
+    normals.push_back({0.0f, -1.0f, 0.0f});
+    normals.push_back(Vector<float, 3>{1.0f, -1.0f, -1.0f}.normalized());
+
+    std::vector<OctNormal> codes(normals.size());
+    std::vector<Vector<float, 3>> decoded(normals.size());
+    batch::encodeOctahedral(Span<const Vector<float, 3>>(normals), Span<OctNormal>(codes));
+    batch::decodeOctahedral(Span<const OctNormal>(codes), Span<Vector<float, 3>>(decoded));
+
+    double worst = 0.0;
+    for (size_t i = 0; i < normals.size(); ++i) {
+        const OctNormal c = encodeOctahedral(normals[i]);
+        ASSERT_TRUE(c.x == codes[i].x && c.y == codes[i].y);
+        ASSERT_NEAR(decoded[i].norm(), 1.0f, 1e-6f);
+        const double cosAngle = std::min(1.0, double(decoded[i].dot(normals[i])));
+        // acos pierde precisión cerca de 1: se usa la cuerda
+        Vector<float, 3> d = decoded[i] - normals[i];
+        worst = std::max(worst, 2.0 * std::asin(std::min(1.0, double(d.norm()) * 0.5)));
+        ASSERT_TRUE(cosAngle > 0.99999);
+    }
+    ASSERT_TRUE(worst < 0.005 * std::acos(-1.0) / 180.0);
+    std::cout << "[PASS] Octahedral normals (max error " << worst * 180.0 / std::acos(-1.0) << " deg)" << std::endl;
+}
+
+template <unsigned Bits>
+void check_positions() {
+    using namespace TinyGeo;
+    using Q = PositionQuantizer<float, 3, Bits>;
+    const AABB3f box({-10.0f, 0.0f, 5.0f}, {30.0f, 2.0f, 5.5f});
+    const Q q(box);
+    const Vector<float, 3> err = q.maxError();
+    const float slack = 4.0f * std::numeric_limits<float>::epsilon() * float(Q::kMaxCode);
+
+    uint32_t s = 3u;
+    std::vector<Vector<float, 3>> points;
+    for (size_t i = 0; i < 5000; ++i) {
+        points.push_back({uniform(s, -10.0f, 30.0f), uniform(s, 0.0f, 2.0f), uniform(s, 5.0f, 5.5f)});
+    }
+    points.push_back(box.lo);
+    points.push_back(box.hi);
+
+    std::vector<typename Q::Code> codes(points.size());
+    std::vector<Vector<float, 3>> decoded(points.size());
+    batch::encode(q, Span<const Vector<float, 3>>(points), Span<typename Q::Code>(codes));
+    batch::decode(q, Span<const typename Q::Code>(codes), Span<Vector<float, 3>>(decoded));
+    for (size_t i = 0; i < points.size(); ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            ASSERT_TRUE(Q::component(codes[i], k) <= Q::kMaxCode);
+            // Medio paso + el redondeo float del código y de lo + q * step
+            const float ulp = 2.0f * std::numeric_limits<float>::epsilon() * std::abs(points[i][k]);
+            ASSERT_TRUE(std::abs(decoded[i][k] - points[i][k]) <= err[k] * (1.0f + slack) + ulp);
+        }
+    }
+    // Las esquinas se reconstruyen exactas y fuera de la caja se satura
+    ASSERT_TRUE(Q::component(q.encode(box.hi), 0) == Q::kMaxCode);
+    ASSERT_NEAR(q.decode(q.encode(box.lo))[0], -10.0f, 1e-6f);
+    const typename Q::Code outside = q.encode(Vector<float, 3>{100.0f, -5.0f, 5.25f});
+    ASSERT_TRUE(Q::component(outside, 0) == Q::kMaxCode && Q::component(outside, 1) == 0u);
+}
+
+void test_positions() {
+    using namespace TinyGeo;
+    static_assert(std::is_same_v<PositionQuantizer10::Code, uint32_t>, "3 x 10 bits pack into 32");
+    static_assert(sizeof(PositionQuantizer16::Code) == 6, "3 x 16 bits use 6 bytes");
+    check_positions<10>();
+    check_positions<16>();
+
+    // Eje degenerado: todo se decodifica al plano de la caja
+    const PositionQuantizer16 flat(AABB3f({0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}));
+    ASSERT_TRUE(flat.decode(flat.encode(Vector<float, 3>{0.5f, 1.0f, 0.5f}))[1] == 1.0f);
+    std::cout << "[PASS] Position quantization (10 / 16 bits)" << std::endl;
+}
+
+int main() {
+    test_half();
+    test_octahedral();
+    test_positions();
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "TinyGeo/Quaternion.h"
+#include "TestCommon.h"
+
+void test_quaternion_rotate() {
+    using namespace TinyGeo;
+    const double halfPi = std::acos(0.0);
+    Quaterniond qz = Quaterniond::fromAxisAngle({0.0, 0.0, 2.0}, halfPi);
+    Vector<double, 3> r = qz.rotate({1.0, 0.0, 0.0});
+    ASSERT_NEAR(r[0], 0.0, 1e-12);
+    ASSERT_NEAR(r[1], 1.0, 1e-12);
+    ASSERT_NEAR(r[2], 0.0, 1e-12);
+
+    // Debe coincidir con la matriz equivalente
+    Quaterniond q = Quaterniond::fromAxisAngle({1.0, -2.0, 0.5}, 0.7);
+    Vector<double, 3> p = {0.3, -1.2, 2.5};
+    Vector<double, 3> a = q.rotate(p);
+    Vector<double, 3> b = q.toMatrix() * p;
+    for (size_t i = 0; i < 3; ++i) {
+        ASSERT_NEAR(a[i], b[i], 1e-12);
+    }
+
+    // Composición: (q2 * q1) aplica q1 y luego q2; el inverso deshace
+    Quaterniond q2 = Quaterniond::fromAxisAngle({0.0, 1.0, 1.0}, -1.1);
+    Vector<double, 3> c1 = (q2 * q).rotate(p);
+    Vector<double, 3> c2 = q2.rotate(q.rotate(p));
+    Vector<double, 3> back = q.inverse().rotate(a);
+    for (size_t i = 0; i < 3; ++i) {
+        ASSERT_NEAR(c1[i], c2[i], 1e-12);
+        ASSERT_NEAR(back[i], p[i], 1e-12);
+    }
+    ASSERT_NEAR((q2 * q).norm(), 1.0, 1e-12);
+
+    std::cout << "[PASS] Quaternion rotate / compose" << std::endl;
+}
+
+void test_quaternion_interpolation() {
+    using namespace TinyGeo;
+    Quaterniond a;
+    Quaterniond b = Quaterniond::fromAxisAngle({0.0, 0.0, 1.0}, 2.0);
+
+    // slerp recorre el ángulo a velocidad constante
+    Quaterniond mid = slerp(a, b, 0.25);
+    Quaterniond ref = Quaterniond::fromAxisAngle({0.0, 0.0, 1.0}, 0.5);
+    ASSERT_NEAR(std::abs(mid.dot(ref)), 1.0, 1e-12);
+    ASSERT_NEAR(slerp(a, b, 1.0).dot(b), 1.0, 1e-12);
+
+    // Camino corto: -b es la misma rotación
+    Quaterniond negB(-b.w, b.v * -1.0);
+    ASSERT_NEAR(std::abs(slerp(a, negB, 0.25).dot(ref)), 1.0, 1e-12);
+
+    // nlerp: unitario y simétrico en t = 0.5
+    Quaterniond n = nlerp(a, b, 0.5);
+    ASSERT_NEAR(n.norm(), 1.0, 1e-12);
+    ASSERT_NEAR(n.dot(Quaterniond::fromAxisAngle({0.0, 0.0, 1.0}, 1.0)), 1.0, 1e-12);
+
+    // Casi iguales: rama nlerp, sin NaN
+    Quaterniond c = Quaterniond::fromAxisAngle({0.0, 0.0, 1.0}, 1e-6);
+    ASSERT_NEAR(slerp(a, c, 0.5).norm(), 1.0, 1e-12);
+
+    std::cout << "[PASS] Quaternion nlerp / slerp" << std::endl;
+}
+
+void test_quaternion_batch() {
+    using namespace TinyGeo;
+    Quaternionf q = Quaternionf::fromAxisAngle({0.3f, 1.0f, -0.4f}, 1.3f);
+
+    const size_t n = 1031; // No múltiplo del ancho SIMD
+    std::vector<Vector<float, 3>> pts(n), out(n);
+    VectorSoA<float, 3> soa;
+    for (size_t i = 0; i < n; ++i) {
+        pts[i] = {float(i) * 0.01f, 1.0f - float(i % 7), float(i % 13) * 0.5f};
+        soa.push_back(pts[i]);
+    }
+
+    batch::rotate(q, Span<const Vector<float, 3>>(pts), Span(out));
+    batch::rotate(q, soa);
+    for (size_t i = 0; i < n; ++i) {
+        Vector<float, 3> ref = q.rotate(pts[i]);
+        Vector<float, 3> s = soa.get(i);
+        for (size_t k = 0; k < 3; ++k) {
+            ASSERT_NEAR(out[i][k], ref[k], 1e-4f);
+            ASSERT_NEAR(s[k], ref[k], 1e-4f);
+        }
+    }
+
+    // In-place
+    batch::rotate(q, Span(pts));
+    ASSERT_NEAR(pts[n - 1][1], out[n - 1][1], 1e-6f);
+
+    std::cout << "[PASS] Quaternion batch rotate (AoS / SoA)" << std::endl;
+}
+
+int main() {
+    test_quaternion_rotate();
+    test_quaternion_interpolation();
+    test_quaternion_batch();
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "TinyGeo/Reduction.h"
+#include "TestCommon.h"
+
+namespace {
+
+    float uniform(uint32_t& s) {
+        s = s * 1664525u + 1013904223u;
+        return float(s >> 8) / float(1u << 24);
+    }
+
+    // Referencia: Kahan en double (exacta a efectos de un resultado float)
+    double referenceDot(const std::vector<float>& a, const std::vector<float>& b, size_t n) {
+        double sum = 0.0, c = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            const double y = double(a[i]) * double(b[i]) - c;
+            const double t = sum + y;
+            c = (t - sum) - y;
+            sum = t;
+        }
+        return sum;
+    }
+
+} // namespace
+
+// Las reducciones son constexpr (útiles en tablas precalculadas)
+constexpr float kValues[5] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+static_assert(TinyGeo::reduction::sum(TinyGeo::reduction::kahan, kValues, 5) == 15.0f, "Kahan sum must be constexpr");
+static_assert(TinyGeo::reduction::sum(TinyGeo::reduction::pairwise, kValues, 5) == 15.0f,
+              "Pairwise sum must be constexpr");
+
+void test_accuracy() {
+    using namespace TinyGeo;
+    const size_t n = size_t(1) << 20;
+    uint32_t s = 17u;
+    std::vector<float> a(n), b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = uniform(s);
+        b[i] = uniform(s);
+    }
+    const double exact = referenceDot(a, b, n);
+
+    const double eNaive = std::abs(double(reduction::dot(reduction::naive, a.data(), b.data(), n)) - exact);
+    const double eWide = std::abs(reduction::dot(reduction::widened, a.data(), b.data(), n) - exact);
+    const double ePair = std::abs(double(reduction::dot(reduction::pairwise, a.data(), b.data(), n)) - exact);
+    const double eKahan = std::abs(double(reduction::dot(reduction::kahan, a.data(), b.data(), n)) - exact);
+
+    // Un ulp del resultado en float (~2.6e5 -> 0.03)
+    const double ulp = std::ldexp(1.0, std::ilogb(exact) - 23);
+    std::cout << "  |error| naive " << eNaive << ", widened " << eWide << ", pairwise " << ePair << ", kahan "
+              << eKahan << " (ulp " << ulp << ")" << std::endl;
+    ASSERT_TRUE(eNaive > 16.0 * ulp);  // El caso que motiva las políticas
+    ASSERT_TRUE(eWide < 1e-6 * ulp);
+    ASSERT_TRUE(ePair <= 4.0 * ulp);
+    ASSERT_TRUE(eKahan <= 1.0 * ulp);
+
+    // Tamaños que no son múltiplo de carriles ni de bloques
+    for (size_t m : {size_t(0), size_t(1), size_t(7), size_t(255), size_t(257), size_t(1000)}) {
+        const double ref = referenceDot(a, b, m);
+        ASSERT_NEAR(double(reduction::dot(reduction::pairwise, a.data(), b.data(), m)), ref, 1e-3);
+        ASSERT_NEAR(double(reduction::dot(reduction::kahan, a.data(), b.data(), m)), ref, 1e-4);
+        ASSERT_NEAR(reduction::dot(reduction::widened, a.data(), b.data(), m), ref, 1e-9);
+    }
+
+    // sum(): 1 + n * tiny en float pierde todos los tiny con un acumulador
+    std::vector<float> tiny(100000, 1e-8f);
+    tiny[0] = 1.0f;
+    ASSERT_TRUE(reduction::sum(reduction::naive, Span<const float>(tiny)) == 1.0f);
+    const double expected = 1.0 + 99999.0 * double(1e-8f);
+    ASSERT_NEAR(double(reduction::sum(reduction::kahan, Span<const float>(tiny))), expected, 1e-7);
+    ASSERT_NEAR(reduction::sum(reduction::widened, Span<const float>(tiny)), expected, 1e-12);
+    std::cout << "[PASS] Reduction accuracy" << std::endl;
+}
+
+void test_vector_overloads() {
+    using namespace TinyGeo;
+    Vector<float, 3, AlignedStorage> v = {1.0f, 2.0f, 3.0f};
+    ASSERT_TRUE(dot(reduction::kahan, v, v) == 14.0f);
+    ASSERT_TRUE(normSq(reduction::pairwise, v) == 14.0f);
+    const double w = normSq(reduction::widened, v);
+    ASSERT_TRUE(w == 14.0);
+
+    DynVector<float> d(1000);
+    for (size_t i = 0; i < d.size(); ++i) d[i] = 0.1f;
+    ASSERT_NEAR(double(normSq(reduction::kahan, d)), 1000.0 * double(0.1f) * double(0.1f), 1e-4);
+    ASSERT_NEAR(dot(reduction::widened, d, d), 1000.0 * double(0.1f) * double(0.1f), 1e-9);
+
+    // La función libre sin política sigue siendo el dot de Vector
+    ASSERT_TRUE(dot(v, v) == 14.0f);
+    std::cout << "[PASS] Reduction policies on Vector / DynVector" << std::endl;
+}
+
+int main() {
+    test_accuracy();
+    test_vector_overloads();
+    return 0;
+}
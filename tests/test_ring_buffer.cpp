@@ -0,0 +1,183 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "TinyGeo/Batch.h"
+#include "TinyGeo/RingBuffer.h"
+#include "TestCommon.h"
+
+namespace {
+
+    using V = TinyGeo::Vector<float, 3>;
+
+    uint32_t nextRandom(uint32_t& s) {
+        s = s * 1664525u + 1013904223u;
+        return s;
+    }
+
+    // Muestra identificable: (productor, secuencia, 1); exacta en float
+    // mientras la secuencia quepa en 24 bits
+    V sample(uint32_t producer, uint32_t seq) { return V(float(producer), float(seq), 1.0f); }
+
+} // namespace
+
+void test_wrap_around() {
+    using namespace TinyGeo;
+    RingBuffer<V> ring(5); // Redondea a 8
+    ASSERT_TRUE(ring.capacity() == 8);
+    ASSERT_TRUE(ring.tryAcquire(4).empty());
+
+    std::vector<V> in(6), out(6);
+    for (uint32_t i = 0; i < 6; ++i) in[i] = sample(0, i);
+    ASSERT_TRUE(ring.tryPush(Span<const V>(in)));
+    ASSERT_TRUE(ring.tryReserve(3).empty()); // 6 + 3 > 8: todo o nada
+    ASSERT_TRUE(ring.tryPop(Span<V>(out).subspan(0, 5)) == 5);
+    ASSERT_TRUE(ring.size() == 1);
+
+    // Esta reserva cruza el final del almacenamiento: dos trozos
+    auto w = ring.reserve(6);
+    ASSERT_TRUE(w.first.size() == 2 && w.second.size() == 4);
+    for (uint32_t i = 0; i < 6; ++i) w[i] = sample(1, i);
+    ASSERT_TRUE(ring.size() == 1); // Sin commit() la reserva no es visible
+    ring.commit(w);
+
+    auto r = ring.acquire(16);
+    ASSERT_TRUE(r.size() == 7);
+    ASSERT_TRUE(r[0][1] == 5.0f && r[0][0] == 0.0f); // Último del primer lote
+    for (uint32_t i = 0; i < 6; ++i) ASSERT_TRUE(r[i + 1][0] == 1.0f && r[i + 1][1] == float(i));
+
+    // Los trozos van directos a los kernels de batch
+    std::vector<float> norms;
+    r.forEachSpan([&](Span<const V> s) {
+        std::vector<float> part(s.size());
+        batch::normSq(s, Span<float>(part));
+        norms.insert(norms.end(), part.begin(), part.end());
+    });
+    ASSERT_TRUE(norms.size() == 7 && norms[1] == 2.0f); // (1, 0, 1)
+    ring.release(r);
+    ASSERT_TRUE(ring.size() == 0);
+    std::cout << "[PASS] Wrap-around" << std::endl;
+}
+
+// Más de capacity() elementos: reservas vacías sin bloquear, push() trocea
+void test_oversized() {
+    using namespace TinyGeo;
+    RingBuffer<V> ring(8);
+    ASSERT_TRUE(ring.tryReserve(9).empty());
+    ASSERT_TRUE(ring.reserve(9).empty());
+    ASSERT_TRUE(ring.size() == 0);
+
+    std::vector<V> in(100);
+    for (uint32_t i = 0; i < 100; ++i) in[i] = sample(0, i);
+    ASSERT_TRUE(!ring.tryPush(Span<const V>(in)));
+
+    std::vector<V> out;
+    std::thread consumer([&] {
+        V local[8];
+        while (out.size() < in.size()) {
+            const size_t n = ring.tryPop(Span<V>(local));
+            out.insert(out.end(), local, local + n);
+            if (n == 0) std::this_thread::yield();
+        }
+    });
+    ring.push(Span<const V>(in));
+    consumer.join();
+    for (uint32_t i = 0; i < 100; ++i) ASSERT_TRUE(out[i][1] == float(i));
+    std::cout << "[PASS] Oversized reservations" << std::endl;
+}
+
+// Varios productores, un consumidor: cada productor llega en orden y sin
+// huecos ni duplicados
+void test_mpsc() {
+    using namespace TinyGeo;
+    const uint32_t producers = 4, perProducer = 200000;
+    RingBuffer<V> ring(1 << 12);
+
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            uint32_t seed = p + 1, seq = 0;
+            while (seq < perProducer) {
+                const uint32_t n = std::min(1 + nextRandom(seed) % 64, perProducer - seq);
+                auto w = ring.reserve(n);
+                for (uint32_t i = 0; i < n; ++i) w[i] = sample(p, seq + i);
+                ring.commit(w);
+                seq += n;
+            }
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<uint32_t> next(producers, 0);
+    size_t received = 0;
+    while (received < size_t(producers) * perProducer) {
+        auto r = ring.acquire(1024);
+        r.forEachSpan([&](Span<const V> s) {
+            for (const V& v : s) {
+                const uint32_t p = uint32_t(v[0]);
+                ASSERT_TRUE(p < producers && v[1] == float(next[p]));
+                ++next[p];
+            }
+        });
+        received += r.size();
+        ring.release(r);
+    }
+    for (std::thread& t : threads) t.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (uint32_t p = 0; p < producers; ++p) ASSERT_TRUE(next[p] == perProducer);
+    ASSERT_TRUE(ring.size() == 0);
+    std::cout << "[PASS] MPSC: " << double(received) / seconds * 1e-6 << " M samples/s" << std::endl;
+}
+
+// Varios productores y consumidores: cada muestra se consume una sola vez
+void test_mpmc() {
+    using namespace TinyGeo;
+    const uint32_t producers = 3, consumers = 3, perProducer = 100000;
+    RingBuffer<V> ring(1 << 10);
+    std::atomic<uint64_t> consumed{0};
+    std::vector<std::vector<uint8_t>> seen(producers, std::vector<uint8_t>(perProducer, 0));
+
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            std::vector<V> batch(100);
+            for (uint32_t seq = 0; seq < perProducer; seq += 100) {
+                for (uint32_t i = 0; i < 100; ++i) batch[i] = sample(p, seq + i);
+                ring.push(Span<const V>(batch));
+            }
+        });
+    }
+    const uint64_t total = uint64_t(producers) * perProducer;
+    for (uint32_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::vector<V> local(256);
+            while (consumed.load() < total) {
+                const size_t n = ring.tryPop(Span<V>(local));
+                if (n == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                // Cada consumidor escribe entradas distintas: sin carrera si no hay duplicados
+                for (size_t i = 0; i < n; ++i) ++seen[uint32_t(local[i][0])][uint32_t(local[i][1])];
+                consumed += n;
+            }
+        });
+    }
+    for (std::thread& t : threads) t.join();
+    ASSERT_TRUE(consumed.load() == total);
+    for (const auto& s : seen) {
+        for (uint8_t count : s) ASSERT_TRUE(count == 1);
+    }
+    std::cout << "[PASS] MPMC" << std::endl;
+}
+
+int main() {
+    test_wrap_around();
+    test_oversized();
+    test_mpsc();
+    test_mpmc();
+    std::cout << "Ring buffer tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,154 @@
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "TinyGeo/Batch.h"
+#include "TinyGeo/RuntimeDispatch.h"
+#include "TinyGeo/Statistics.h"
+#include "TinyGeo/VectorSoA.h"
+#include "TestCommon.h"
+
+namespace {
+
+    std::string tempPath(const char* name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    template <typename Fn>
+    bool throws(Fn&& fn) {
+        try {
+            fn();
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    // Kernel genérico: suma de componentes en double (vale para int16)
+    struct ComponentSum {
+        template <typename V>
+        double operator()(TinyGeo::Span<V> points) const {
+            double sum = 0.0;
+            for (const auto& p : points) {
+                for (size_t k = 0; k < TinyGeo::VectorTraits<std::remove_const_t<V>>::size; ++k) sum += double(p.data[k]);
+            }
+            return sum;
+        }
+    };
+
+} // namespace
+
+void test_visit_shapes() {
+    using namespace TinyGeo;
+    const io::ScalarType types[] = {io::ScalarType::Float32, io::ScalarType::Float64, io::ScalarType::Int16};
+    const size_t sizes[] = {sizeof(float), sizeof(double), sizeof(int16_t)};
+    for (size_t t = 0; t < 3; ++t) {
+        for (uint32_t n = dispatch::kMinDimension; n <= dispatch::kMaxDimension; ++n) {
+            const dispatch::Shape shape{types[t], n};
+            ASSERT_TRUE(dispatch::isSupported(shape));
+            const size_t bytes = dispatch::visit(shape, [](auto k) {
+                using K = decltype(k);
+                static_assert(std::is_same_v<typename K::vector_type, Vector<typename K::scalar_type, K::size>>);
+                return K::size * sizeof(typename K::scalar_type);
+            });
+            ASSERT_TRUE(bytes == n * sizes[t]);
+        }
+    }
+    const dispatch::Shape s = dispatch::shapeOf<int16_t, 4>();
+    ASSERT_TRUE(s.type == io::ScalarType::Int16 && s.dimension == 4);
+
+    // Formas fuera de la tabla: excepción, el callable no se llama
+    bool called = false;
+    auto mark = [&](auto) { called = true; };
+    ASSERT_TRUE(throws([&] { dispatch::visit(dispatch::Shape{io::ScalarType::Float32, 5}, mark); }));
+    ASSERT_TRUE(throws([&] { dispatch::visit(dispatch::Shape{io::ScalarType::Float64, 1}, mark); }));
+    ASSERT_TRUE(throws([&] { dispatch::visit(dispatch::Shape{io::ScalarType(7), 3}, mark); }));
+    ASSERT_TRUE(!called);
+    std::cout << "[PASS] Shape dispatch" << std::endl;
+}
+
+void test_isa_selection() {
+    using namespace TinyGeo;
+    const dispatch::CpuFeatures& f = dispatch::cpuFeatures();
+    ASSERT_TRUE(!f.avx2 || f.avx);
+    ASSERT_TRUE(dispatch::isSupported(dispatch::Isa::Baseline));
+    ASSERT_TRUE(dispatch::isSupported(dispatch::bestIsa()));
+    std::cout << "CPU: best ISA " << dispatch::isaName(dispatch::bestIsa()) << ", active "
+              << dispatch::isaName(dispatch::activeIsa()) << std::endl;
+
+    // Mismo kernel con cada ISA disponible: resultados equivalentes (FMA
+    // cambia el redondeo, no el resultado)
+    std::vector<Vector<float, 3>> pts(10000);
+    for (size_t i = 0; i < pts.size(); ++i) pts[i] = Vector<float, 3>(float(i % 97), float(i % 13) - 6.0f, 1.0f);
+    const dispatch::Shape shape = dispatch::shapeOf<float, 3>();
+    auto kernel = [](auto points) {
+        using V = typename decltype(points)::value_type;
+        std::vector<std::remove_const_t<V>> unit(points.size());
+        batch::normalize(points, Span<std::remove_const_t<V>>(unit));
+        const auto s = stats::reduce<stats::All>(Span<const std::remove_const_t<V>>(unit));
+        return double(s.centroid()[0]) + double(s.covariance().rows[1][1]);
+    };
+    const dispatch::Isa original = dispatch::activeIsa();
+    dispatch::setActiveIsa(dispatch::Isa::Baseline);
+    const double baseline = dispatch::visitPoints(shape, static_cast<const void*>(pts.data()), pts.size(), kernel);
+    dispatch::setActiveIsa(dispatch::bestIsa());
+    const double best = dispatch::visitPoints(shape, static_cast<const void*>(pts.data()), pts.size(), kernel);
+    dispatch::setActiveIsa(original);
+    ASSERT_NEAR(baseline, best, 1e-5);
+    std::cout << "[PASS] ISA selection" << std::endl;
+}
+
+void test_visit_points() {
+    using namespace TinyGeo;
+    // Buffer mutable sin tipo: el kernel escribe a través del Span
+    std::vector<Vector<double, 2>> pts(100, Vector<double, 2>(1.0, 2.0));
+    dispatch::visitPoints(dispatch::shapeOf<double, 2>(), static_cast<void*>(pts.data()), pts.size(), [](auto points) {
+        batch::scale(points, typename VectorTraits<typename decltype(points)::value_type>::scalar_type(3));
+    });
+    ASSERT_TRUE(pts[42][0] == 3.0 && pts[42][1] == 6.0);
+
+    // Archivo .tgpc: la forma sale de la cabecera
+    const std::string path = tempPath("tinygeo_dispatch.tgpc");
+    std::vector<Vector<int16_t, 3>> quantized(1000);
+    double expected = 0.0;
+    for (size_t i = 0; i < quantized.size(); ++i) {
+        quantized[i] = Vector<int16_t, 3>(int16_t(i), int16_t(-int(i)), int16_t(i % 7));
+        expected += double(i % 7);
+    }
+    io::writePointCloud(path, Span<const Vector<int16_t, 3>>(quantized));
+    {
+        io::MappedPointCloud cloud(path);
+        ASSERT_TRUE(cloud.header().scalarType == io::ScalarType::Int16);
+        ASSERT_TRUE(dispatch::visitPoints(cloud, ComponentSum{}) == expected);
+    }
+
+    std::vector<Vector<float, 4>> wide(500, Vector<float, 4>(1.0f, 1.0f, 1.0f, 1.0f));
+    io::writePointCloud(path, Span<const Vector<float, 4>>(wide));
+    {
+        io::MappedPointCloud cloud(path);
+        ASSERT_TRUE(dispatch::visitPoints(cloud, ComponentSum{}) == 2000.0);
+    }
+
+    // SoA: points<T, N>() rechaza el layout
+    VectorSoA<float, 3> soa;
+    soa.push_back(Vector<float, 3>(1.0f, 2.0f, 3.0f));
+    io::writePointCloud(path, soa);
+    {
+        io::MappedPointCloud cloud(path);
+        ASSERT_TRUE(throws([&] { dispatch::visitPoints(cloud, ComponentSum{}); }));
+    }
+    std::remove(path.c_str());
+    std::cout << "[PASS] Point buffers" << std::endl;
+}
+
+int main() {
+    test_visit_shapes();
+    test_isa_selection();
+    test_visit_points();
+    std::cout << "Runtime dispatch tests passed." << std::endl;
+    return 0;
+}
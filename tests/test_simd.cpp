@@ -0,0 +1,88 @@
+#include <iostream>
+#include "TinyGeo/Vector.h"
+#include "TestCommon.h"
+
+// Compara el backend SIMD activo contra los kernels escalares de referencia.
+// Con TINYGEO_SIMD=SCALAR ambos coinciden trivialmente.
+
+namespace {
+
+    // Generador determinista (LCG) para no depender de <random> ni de semillas
+    struct Lcg {
+        unsigned state = 12345u;
+        double next() {
+            state = state * 1664525u + 1013904223u;
+            return static_cast<double>(state >> 8) / static_cast<double>(1u << 24) * 20.0 - 10.0;
+        }
+    };
+
+    template <typename T, size_t N>
+    void check_kernels(T tolerance) {
+        using Simd = TinyGeo::detail::Kernels<T, N>;
+        using Ref = TinyGeo::detail::ScalarKernels<T, N>;
+        Lcg rng;
+        for (int iter = 0; iter < 1000; ++iter) {
+            T a[N], b[N];
+            for (size_t i = 0; i < N; ++i) {
+                a[i] = static_cast<T>(rng.next());
+                b[i] = static_cast<T>(rng.next());
+            }
+            ASSERT_NEAR(Simd::dot(a, b), Ref::dot(a, b), tolerance);
+
+            T s1[N], s2[N];
+            for (size_t i = 0; i < N; ++i) { s1[i] = a[i]; s2[i] = a[i]; }
+            Simd::add(s1, b);
+            Ref::add(s2, b);
+            Simd::scale(s1, T(0.5));
+            Ref::scale(s2, T(0.5));
+            Simd::sub(s1, b);
+            Ref::sub(s2, b);
+            for (size_t i = 0; i < N; ++i) {
+                ASSERT_NEAR(s1[i], s2[i], tolerance);
+            }
+
+            if constexpr (N == 3 || N == 4) {
+                // N=4: vector 3D con padding, w debe entrar y salir en cero
+                if constexpr (N == 4) {
+                    a[3] = T(0);
+                    b[3] = T(0);
+                }
+                T c1[N], c2[N];
+                Simd::cross(a, b, c1);
+                Ref::cross(a, b, c2);
+                for (size_t i = 0; i < N; ++i) {
+                    ASSERT_NEAR(c1[i], c2[i], tolerance);
+                }
+                if constexpr (N == 4) {
+                    ASSERT_TRUE(c1[3] == T(0));
+                }
+            }
+        }
+    }
+
+} // namespace
+
+void test_simd_matches_scalar() {
+    check_kernels<float, 3>(1e-3f);
+    check_kernels<float, 4>(1e-3f);
+    check_kernels<double, 2>(1e-9);
+    check_kernels<double, 4>(1e-9);
+    std::cout << "[PASS] SIMD kernels (" << TinyGeo::simdBackendName() << ")" << std::endl;
+}
+
+void test_cross_in_place() {
+    using namespace TinyGeo;
+    // El resultado no debe corromper las entradas si se reutiliza el buffer
+    float a[3] = {1.0f, 0.0f, 0.0f};
+    float b[3] = {0.0f, 1.0f, 0.0f};
+    detail::Kernels<float, 3>::cross(a, b, a);
+    ASSERT_NEAR(a[0], 0.0f, 1e-6f);
+    ASSERT_NEAR(a[2], 1.0f, 1e-6f);
+    std::cout << "[PASS] SIMD cross aliasing" << std::endl;
+}
+
+int main() {
+    test_simd_matches_scalar();
+    test_cross_in_place();
+    return 0;
+}
@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include "TinyGeo/SpaceFillingCurve.h"
+#include "TestCommon.h"
+
+namespace {
+
+    using Vector3f = TinyGeo::Vector<float, 3>;
+
+    uint32_t nextRandom(uint32_t& s) {
+        s = s * 1664525u + 1013904223u;
+        return s;
+    }
+
+    float uniform(uint32_t& s, float lo, float hi) {
+        return lo + (hi - lo) * float(nextRandom(s) >> 8) / float(1u << 24);
+    }
+
+    // Pool explícito: el global puede no tener hilos en máquinas de 1 núcleo
+    TinyGeo::ThreadPool& testPool() {
+        static TinyGeo::ThreadPool pool(3);
+        return pool;
+    }
+
+    // Referencia bit a bit: bit b del eje k -> bit b * dims + k
+    uint64_t naiveInterleave(const uint32_t* axes, size_t dims, unsigned bits) {
+        uint64_t key = 0;
+        for (unsigned b = 0; b < bits; ++b) {
+            for (size_t k = 0; k < dims; ++k) {
+                key |= uint64_t((axes[k] >> b) & 1u) << (b * dims + k);
+            }
+        }
+        return key;
+    }
+
+    uint32_t manhattan(const uint32_t* a, const uint32_t* b, size_t dims) {
+        uint32_t d = 0;
+        for (size_t k = 0; k < dims; ++k) d += a[k] > b[k] ? a[k] - b[k] : b[k] - a[k];
+        return d;
+    }
+
+} // namespace
+
+void test_interleave() {
+    using namespace TinyGeo;
+    uint32_t seed = 1;
+    for (int it = 0; it < 10000; ++it) {
+        const uint32_t a[2] = {nextRandom(seed), nextRandom(seed)};
+        const uint32_t b[3] = {nextRandom(seed) & 0x1FFFFFu, nextRandom(seed) & 0x1FFFFFu, nextRandom(seed) & 0x1FFFFFu};
+        ASSERT_TRUE(detail::spreadBits2(a[0]) == detail::spreadBits2Portable(a[0]));
+        ASSERT_TRUE(detail::spreadBits3(b[0]) == detail::spreadBits3Portable(b[0]));
+        ASSERT_TRUE(mortonKey(a[0], a[1]) == naiveInterleave(a, 2, 32));
+        ASSERT_TRUE(mortonKey(b[0], b[1], b[2]) == naiveInterleave(b, 3, 21));
+    }
+    static_assert(mortonKey(0xFFFFFFFFu, 0xFFFFFFFFu) == ~uint64_t(0));
+    static_assert(mortonKey(0x1FFFFFu, 0x1FFFFFu, 0x1FFFFFu) == (uint64_t(1) << 63) - 1);
+    static_assert(mortonKey(1u, 0u, 0u) == 1 && mortonKey(0u, 1u, 0u) == 2 && mortonKey(0u, 0u, 1u) == 4);
+}
+
+// Las primeras 4^k (8^k) posiciones de la curva recorren el cuadrado
+// (cubo) de lado 2^k del origen, y celdas consecutivas son vecinas
+void test_hilbert_adjacency() {
+    using namespace TinyGeo;
+    {
+        const uint32_t side = 32;
+        std::vector<std::array<uint32_t, 2>> cells(side * side, {~0u, ~0u});
+        for (uint32_t x = 0; x < side; ++x) {
+            for (uint32_t y = 0; y < side; ++y) {
+                const uint64_t key = hilbertKey(x, y);
+                ASSERT_TRUE(key < cells.size());
+                ASSERT_TRUE(cells[key][0] == ~0u); // Biyección
+                cells[key] = {x, y};
+            }
+        }
+        for (size_t i = 1; i < cells.size(); ++i) {
+            ASSERT_TRUE(manhattan(cells[i - 1].data(), cells[i].data(), 2) == 1);
+        }
+        ASSERT_TRUE(hilbertKey(0u, 0u) == 0);
+    }
+    {
+        const uint32_t side = 16;
+        std::vector<std::array<uint32_t, 3>> cells(side * side * side, {~0u, ~0u, ~0u});
+        for (uint32_t x = 0; x < side; ++x) {
+            for (uint32_t y = 0; y < side; ++y) {
+                for (uint32_t z = 0; z < side; ++z) {
+                    const uint64_t key = hilbertKey(x, y, z);
+                    ASSERT_TRUE(key < cells.size());
+                    ASSERT_TRUE(cells[key][0] == ~0u);
+                    cells[key] = {x, y, z};
+                }
+            }
+        }
+        for (size_t i = 1; i < cells.size(); ++i) {
+            ASSERT_TRUE(manhattan(cells[i - 1].data(), cells[i].data(), 3) == 1);
+        }
+    }
+}
+
+void test_encode() {
+    using namespace TinyGeo;
+    const AABB3f box(Vector3f(-1.0f, 0.0f, 2.0f), Vector3f(1.0f, 4.0f, 3.0f));
+    ASSERT_TRUE(mortonEncode(box, box.lo) == 0);
+    ASSERT_TRUE(mortonEncode(box, box.hi) == (uint64_t(1) << 63) - 1);
+    ASSERT_TRUE(mortonEncode(box, Vector3f(-5.0f, -5.0f, -5.0f)) == 0); // Saturación
+    ASSERT_TRUE(mortonEncode(box, Vector3f(9.0f, 9.0f, 9.0f)) == mortonEncode(box, box.hi));
+    ASSERT_TRUE(hilbertEncode(box, box.lo) == 0);
+
+    // Caja plana en z: ese eje aporta siempre la celda 0
+    const AABB<float, 2> flat(Vector<float, 2>(0.0f, 0.0f), Vector<float, 2>(1.0f, 0.0f));
+    ASSERT_TRUE(mortonEncode(flat, Vector<float, 2>(1.0f, 0.0f)) == mortonKey(0xFFFFFFFFu, 0u));
+
+    uint32_t seed = 5;
+    const size_t n = 50000;
+    std::vector<Vector3f> pts(n);
+    VectorSoA<float, 3> soa;
+    for (Vector3f& p : pts) {
+        p = Vector3f(uniform(seed, -1.5f, 1.5f), uniform(seed, -1.0f, 5.0f), uniform(seed, 2.0f, 3.0f));
+        soa.push_back(p);
+    }
+    std::vector<uint64_t> morton(n), mortonPar(n), mortonSoA(n), hilbert(n), hilbertPar(n), hilbertSoA(n);
+    mortonEncode(box, Span<const Vector3f>(pts), Span<uint64_t>(morton));
+    mortonEncode(execution::on(testPool()), box, Span<const Vector3f>(pts), Span<uint64_t>(mortonPar));
+    mortonEncode(execution::on(testPool()), box, soa, Span<uint64_t>(mortonSoA));
+    hilbertEncode(box, Span<const Vector3f>(pts), Span<uint64_t>(hilbert));
+    hilbertEncode(execution::on(testPool()), box, Span<const Vector3f>(pts), Span<uint64_t>(hilbertPar));
+    hilbertEncode(box, soa, Span<uint64_t>(hilbertSoA));
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_TRUE(morton[i] == mortonEncode(box, pts[i]));
+        ASSERT_TRUE(hilbert[i] == hilbertEncode(box, pts[i]));
+    }
+    ASSERT_TRUE(morton == mortonPar && morton == mortonSoA);
+    ASSERT_TRUE(hilbert == hilbertPar && hilbert == hilbertSoA);
+}
+
+void test_radix_sort() {
+    using namespace TinyGeo;
+    for (size_t n : {size_t(0), size_t(1), size_t(7), size_t(1000), size_t(300000)}) {
+        uint32_t seed = uint32_t(n) + 3;
+        std::vector<uint64_t> keys(n);
+        for (size_t i = 0; i < n; ++i) {
+            // Duplicados (estabilidad) y bits solo en dígitos altos y bajos
+            const uint64_t hi = nextRandom(seed) % 97;
+            keys[i] = (hi << 56) | (nextRandom(seed) % 13);
+        }
+        std::vector<uint32_t> expected(n);
+        std::iota(expected.begin(), expected.end(), 0u);
+        std::stable_sort(expected.begin(), expected.end(), [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+
+        std::vector<uint64_t> serialKeys = keys, parallelKeys = keys;
+        std::vector<uint32_t> serialOrder(n), parallelOrder(n);
+        radixSort(Span<uint64_t>(serialKeys), Span<uint32_t>(serialOrder));
+        radixSort(execution::on(testPool()), Span<uint64_t>(parallelKeys), Span<uint32_t>(parallelOrder));
+        ASSERT_TRUE(serialOrder == expected);
+        ASSERT_TRUE(parallelOrder == expected);
+        ASSERT_TRUE(std::is_sorted(serialKeys.begin(), serialKeys.end()));
+        ASSERT_TRUE(serialKeys == parallelKeys);
+    }
+
+    // Claves aleatorias completas: las 8 pasadas
+    uint32_t seed = 99;
+    std::vector<uint64_t> keys(100000);
+    for (uint64_t& k : keys) k = (uint64_t(nextRandom(seed)) << 32) | nextRandom(seed);
+    std::vector<uint64_t> sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<uint32_t> order(keys.size());
+    const std::vector<uint64_t> original = keys;
+    radixSort(execution::on(testPool()), Span<uint64_t>(keys), Span<uint32_t>(order));
+    ASSERT_TRUE(keys == sorted);
+    for (size_t i = 0; i < keys.size(); ++i) ASSERT_TRUE(original[order[i]] == keys[i]);
+}
+
+void test_curve_sort() {
+    using namespace TinyGeo;
+    uint32_t seed = 21;
+    const size_t n = 100000;
+    std::vector<Vector3f> pts(n);
+    for (Vector3f& p : pts) p = Vector3f(uniform(seed, -10.0f, 10.0f), uniform(seed, -10.0f, 10.0f), uniform(seed, 0.0f, 1.0f));
+
+    auto meanStep = [](const std::vector<Vector3f>& v) {
+        double sum = 0.0;
+        for (size_t i = 1; i < v.size(); ++i) sum += double(Vector3f(v[i] - v[i - 1]).norm());
+        return sum / double(v.size() - 1);
+    };
+
+    std::vector<Vector3f> morton = pts, hilbert = pts;
+    const std::vector<uint32_t> mp = mortonSort(execution::on(testPool()), Span<Vector3f>(morton));
+    const std::vector<uint32_t> hp = hilbertSort(Span<Vector3f>(hilbert));
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_TRUE(morton[i].data == pts[mp[i]].data);
+        ASSERT_TRUE(hilbert[i].data == pts[hp[i]].data);
+    }
+
+    // Claves no decrecientes dentro de la caja de los puntos
+    AABB3f box;
+    for (const Vector3f& p : pts) box.expand(p);
+    for (size_t i = 1; i < n; ++i) {
+        ASSERT_TRUE(mortonEncode(box, morton[i - 1]) <= mortonEncode(box, morton[i]));
+        ASSERT_TRUE(hilbertEncode(box, hilbert[i - 1]) <= hilbertEncode(box, hilbert[i]));
+    }
+
+    // Localidad: el paso medio entre puntos consecutivos cae en órdenes de magnitud
+    const double before = meanStep(pts);
+    ASSERT_TRUE(meanStep(morton) < before * 0.05);
+    ASSERT_TRUE(meanStep(hilbert) < meanStep(morton));
+
+    // SoA: misma permutación que el array AoS
+    VectorSoA<float, 3> soa;
+    for (const Vector3f& p : pts) soa.push_back(p);
+    const std::vector<uint32_t> sp = hilbertSort(execution::on(testPool()), soa);
+    ASSERT_TRUE(sp == hp);
+    for (size_t i = 0; i < n; ++i) ASSERT_TRUE(soa.get(i).data == hilbert[i].data);
+
+    // Atributos paralelos con la permutación devuelta
+    std::vector<uint32_t> ids(n);
+    std::iota(ids.begin(), ids.end(), 0u);
+    reorder(Span<const uint32_t>(mp), Span<uint32_t>(ids));
+    ASSERT_TRUE(ids == mp);
+}
+
+int main() {
+    test_interleave();
+    test_hilbert_adjacency();
+    test_encode();
+    test_radix_sort();
+    test_curve_sort();
+    std::cout << "Space-filling curve tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "TinyGeo/SpatialIndex.h"
+#include "TestCommon.h"
+
+namespace {
+
+    // LCG determinista en [-1, 1)
+    struct Lcg {
+        uint32_t state = 12345u;
+        double next() {
+            state = state * 1664525u + 1013904223u;
+            return double(state >> 8) / double(1u << 23) - 1.0;
+        }
+    };
+
+    // Pool explícito: el global puede no tener hilos en máquinas de 1 núcleo
+    TinyGeo::ThreadPool& testPool() {
+        static TinyGeo::ThreadPool pool(3);
+        return pool;
+    }
+
+    template <typename T, size_t N>
+    T bruteDistSq(const TinyGeo::Vector<T, N>& a, const TinyGeo::Vector<T, N>& b) {
+        TinyGeo::Vector<T, N> d = a - b;
+        return d.normSq();
+    }
+
+} // namespace
+
+template <size_t N>
+void check_kdtree(size_t count, bool parallel) {
+    using namespace TinyGeo;
+    using V = Vector<double, N>;
+    Lcg rng;
+    std::vector<V> pts(count);
+    for (auto& p : pts) {
+        for (size_t i = 0; i < N; ++i) p[i] = rng.next();
+    }
+    // Duplicados: la partición debe tolerar valores iguales al split
+    for (size_t i = 0; i + 1 < count; i += 17) pts[i + 1] = pts[i];
+
+    KdTree<double, N> tree = parallel ? KdTree<double, N>(execution::on(testPool()), Span<const V>(pts))
+                                      : KdTree<double, N>(Span<const V>(pts));
+    ASSERT_TRUE(tree.size() == count);
+
+    std::vector<double> all(count);
+    std::vector<uint32_t> hits(count);
+    Neighbor<double> knn[5];
+    for (size_t t = 0; t < 40; ++t) {
+        V q;
+        for (size_t i = 0; i < N; ++i) q[i] = rng.next() * 1.2;
+
+        for (size_t i = 0; i < count; ++i) all[i] = bruteDistSq(pts[i], q);
+        std::vector<double> sorted = all;
+        std::sort(sorted.begin(), sorted.end());
+
+        // kNN
+        const size_t found = tree.knn(q, Span<Neighbor<double>>(knn, 5));
+        ASSERT_TRUE(found == std::min<size_t>(5, count));
+        for (size_t i = 0; i < found; ++i) {
+            ASSERT_NEAR(knn[i].distSq, sorted[i], 1e-12);
+            ASSERT_NEAR(all[knn[i].index], knn[i].distSq, 1e-12);
+        }
+
+        // nearest(): recorrido propio, mismo resultado que kNN con k = 1
+        const Neighbor<double> best = tree.nearest(q);
+        ASSERT_NEAR(best.distSq, sorted[0], 1e-12);
+        ASSERT_NEAR(all[best.index], best.distSq, 1e-12);
+
+        // Radio
+        const double r = 0.3;
+        const size_t expected = size_t(std::count_if(all.begin(), all.end(), [&](double d) { return d <= r * r; }));
+        const size_t got = tree.queryRadius(q, r, Span<uint32_t>(hits));
+        ASSERT_TRUE(got == expected);
+        for (size_t i = 0; i < got; ++i) {
+            ASSERT_TRUE(all[hits[i]] <= r * r);
+        }
+
+        // Caja
+        AABB<double, N> box(q, q);
+        for (size_t i = 0; i < N; ++i) {
+            box.lo[i] -= 0.25;
+            box.hi[i] += 0.4;
+        }
+        const size_t inBox = size_t(std::count_if(pts.begin(), pts.end(), [&](const V& p) { return box.contains(p); }));
+        ASSERT_TRUE(tree.queryBox(box, Span<uint32_t>(hits)) == inBox);
+    }
+}
+
+void test_bvh() {
+    using namespace TinyGeo;
+    Lcg rng;
+    const size_t count = 40000; // Suficiente para construir en paralelo
+    std::vector<AABB3f> boxes(count);
+    for (auto& b : boxes) {
+        Vector<float, 3> c = {float(rng.next()), float(rng.next()), float(rng.next())};
+        Vector<float, 3> h = {float(rng.next() + 1.0) * 0.01f, 0.01f, float(rng.next() + 1.0) * 0.02f};
+        b = AABB3f(c - h, c + h);
+    }
+
+    Bvh<float, 3> seq{Span<const AABB3f>(boxes)};
+    Bvh<float, 3> par(execution::on(testPool()), Span<const AABB3f>(boxes));
+    ASSERT_TRUE(seq.nodeCount() == par.nodeCount());
+
+    std::vector<uint32_t> hits(count);
+    for (size_t t = 0; t < 20; ++t) {
+        Vector<float, 3> c = {float(rng.next()), float(rng.next()), float(rng.next())};
+        AABB3f query(c, c);
+        query.expand(Vector<float, 3>{c[0] + 0.1f, c[1] + 0.05f, c[2] + 0.1f});
+
+        const size_t expected = size_t(std::count_if(boxes.begin(), boxes.end(), [&](const AABB3f& b) { return b.overlaps(query); }));
+        ASSERT_TRUE(seq.queryOverlap(query, Span<uint32_t>(hits)) == expected);
+        ASSERT_TRUE(par.queryOverlap(query, Span<uint32_t>(hits)) == expected);
+        for (size_t i = 0; i < expected; ++i) {
+            ASSERT_TRUE(boxes[hits[i]].overlaps(query));
+        }
+
+        const float r = 0.05f;
+        const size_t inSphere = size_t(std::count_if(boxes.begin(), boxes.end(), [&](const AABB3f& b) { return b.distanceSq(c) <= r * r; }));
+        ASSERT_TRUE(seq.queryRadius(c, r, Span<uint32_t>(hits)) == inSphere);
+    }
+
+    // Buffer corto: devuelve el total igualmente
+    uint32_t small[2];
+    ASSERT_TRUE(seq.queryOverlap(seq.bounds(), Span<uint32_t>(small, 2)) == count);
+
+    std::cout << "[PASS] Bvh overlap / radius queries" << std::endl;
+}
+
+int main() {
+    check_kdtree<2>(1, false);
+    check_kdtree<2>(100, false);
+    check_kdtree<3>(5000, false);
+    check_kdtree<3>(40000, true);
+    check_kdtree<5>(3000, true);
+    std::cout << "[PASS] KdTree knn / radius / box queries" << std::endl;
+
+    TinyGeo::KdTree<float, 3> empty;
+    TinyGeo::Neighbor<float> n[3];
+    ASSERT_TRUE(empty.knn({0.0f, 0.0f, 0.0f}, TinyGeo::Span<TinyGeo::Neighbor<float>>(n, 3)) == 0);
+
+    test_bvh();
+    return 0;
+}
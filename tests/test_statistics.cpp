@@ -0,0 +1,190 @@
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "TinyGeo/Statistics.h"
+#include "TestCommon.h"
+
+namespace {
+
+    using Vector3f = TinyGeo::Vector<float, 3>;
+    using Vector3d = TinyGeo::Vector<double, 3>;
+
+    uint32_t nextRandom(uint32_t& s) {
+        s = s * 1664525u + 1013904223u;
+        return s;
+    }
+
+    float uniform(uint32_t& s, float lo, float hi) {
+        return lo + (hi - lo) * float(nextRandom(s) >> 8) / float(1u << 24);
+    }
+
+    TinyGeo::ThreadPool& testPool() {
+        static TinyGeo::ThreadPool pool(3);
+        return pool;
+    }
+
+    std::vector<Vector3f> randomPoints(size_t n, uint32_t seed, float offset) {
+        std::vector<Vector3f> v(n);
+        for (Vector3f& p : v) {
+            // Nube alargada y correlacionada en x-y
+            const float t = uniform(seed, -4.0f, 4.0f);
+            p = Vector3f(offset + t, offset + 0.5f * t + uniform(seed, -1.0f, 1.0f), offset + uniform(seed, -0.5f, 0.5f));
+        }
+        return v;
+    }
+
+    // Referencia en dos pasadas (media, luego co-momentos), en double
+    struct Reference {
+        double lo[3], hi[3], mean[3] = {}, cov[3][3] = {}, outer[3][3] = {};
+
+        explicit Reference(const std::vector<Vector3f>& pts) {
+            for (size_t k = 0; k < 3; ++k) {
+                lo[k] = 1e30;
+                hi[k] = -1e30;
+            }
+            for (const Vector3f& p : pts) {
+                for (size_t k = 0; k < 3; ++k) {
+                    lo[k] = std::min(lo[k], double(p[k]));
+                    hi[k] = std::max(hi[k], double(p[k]));
+                    mean[k] += double(p[k]);
+                }
+            }
+            for (double& m : mean) m /= double(pts.size());
+            for (const Vector3f& p : pts) {
+                for (size_t r = 0; r < 3; ++r) {
+                    for (size_t c = 0; c < 3; ++c) {
+                        cov[r][c] += (double(p[r]) - mean[r]) * (double(p[c]) - mean[c]);
+                        outer[r][c] += double(p[r]) * double(p[c]);
+                    }
+                }
+            }
+            for (size_t r = 0; r < 3; ++r) {
+                for (size_t c = 0; c < 3; ++c) cov[r][c] /= double(pts.size());
+            }
+        }
+    };
+
+} // namespace
+
+void test_fields() {
+    using namespace TinyGeo;
+    const std::vector<Vector3f> pts = randomPoints(10007, 1, 0.0f);
+    const Reference ref(pts);
+
+    const auto s = stats::reduce<stats::All>(Span<const Vector3f>(pts));
+    ASSERT_TRUE(s.count() == pts.size());
+    const AABB3f box = s.bounds();
+    const Vector3f sum = s.sum(), c = s.centroid();
+    const Matrix3f cov = s.covariance(), outer = s.outerSum(), scatter = s.scatter();
+    for (size_t k = 0; k < 3; ++k) {
+        ASSERT_TRUE(double(box.lo[k]) == ref.lo[k] && double(box.hi[k]) == ref.hi[k]);
+        ASSERT_NEAR(c[k], float(ref.mean[k]), 1e-5f);
+        ASSERT_NEAR(sum[k], float(ref.mean[k] * double(pts.size())), 1e-1f);
+        for (size_t j = 0; j < 3; ++j) {
+            ASSERT_NEAR(cov.rows[k][j], float(ref.cov[k][j]), 1e-5f);
+            ASSERT_TRUE(cov.rows[k][j] == cov.rows[j][k]); // Simétrica
+            ASSERT_NEAR(outer.rows[k][j] / float(pts.size()), float(ref.outer[k][j] / double(pts.size())), 1e-5f);
+            ASSERT_NEAR(scatter.rows[k][j] / float(pts.size()), cov.rows[k][j], 1e-6f);
+        }
+    }
+
+    // Subconjuntos de campos: mismos valores que la reducción completa
+    const auto b = stats::reduce<stats::Bounds>(Span<const Vector3f>(pts));
+    const auto m = stats::reduce<stats::Sum>(Span<const Vector3f>(pts));
+    const auto lo = stats::reduce<stats::Min>(Span<const Vector3f>(pts));
+    static_assert(stats::Accumulator<float, 3, stats::Outer>::fields == (stats::Outer | stats::Sum),
+                  "Outer implies Sum");
+    for (size_t k = 0; k < 3; ++k) {
+        ASSERT_TRUE(b.bounds().lo[k] == box.lo[k] && b.bounds().hi[k] == box.hi[k]);
+        ASSERT_TRUE(lo.lo()[k] == box.lo[k]);
+        ASSERT_TRUE(m.centroid()[k] == c[k]);
+    }
+
+    // Un punto cada vez == span completo
+    stats::Accumulator<float, 3, stats::All> single;
+    for (const Vector3f& p : pts) single.add(p);
+    for (size_t k = 0; k < 3; ++k) {
+        ASSERT_NEAR(single.centroid()[k], c[k], 1e-5f);
+        for (size_t j = 0; j < 3; ++j) ASSERT_NEAR(single.covariance().rows[k][j], cov.rows[k][j], 1e-5f);
+    }
+
+    // Vacío: caja vacía, centroide y covarianza cero
+    const auto e = stats::reduce<stats::All>(Span<const Vector3f>());
+    ASSERT_TRUE(e.count() == 0 && e.bounds().isEmpty());
+    for (size_t k = 0; k < 3; ++k) {
+        ASSERT_TRUE(e.centroid()[k] == 0.0f);
+        ASSERT_TRUE(e.covariance().rows[k][k] == 0.0f);
+    }
+}
+
+// Nube lejos del origen: sum(p^2) - n * media^2 en float perdería toda la
+// varianza; las sumas desplazadas la conservan
+void test_far_from_origin() {
+    using namespace TinyGeo;
+    const std::vector<Vector3f> pts = randomPoints(200000, 7, 10000.0f);
+    const Reference ref(pts);
+    const auto s = stats::reduce<stats::Outer>(execution::on(testPool()), Span<const Vector3f>(pts));
+    const Matrix3f cov = s.covariance();
+    for (size_t r = 0; r < 3; ++r) {
+        ASSERT_NEAR(s.centroid()[r], float(ref.mean[r]), 1e-2f);
+        for (size_t c = 0; c < 3; ++c) ASSERT_NEAR(cov.rows[r][c], float(ref.cov[r][c]), 1e-4f);
+    }
+
+    // Lo mismo en double con la nube desplazada 1e8
+    std::vector<Vector3d> far(pts.size());
+    for (size_t i = 0; i < pts.size(); ++i) {
+        for (size_t k = 0; k < 3; ++k) far[i].data[k] = double(pts[i][k]) - 10000.0 + 1e8;
+    }
+    const Matrix3d covd = stats::reduce<stats::Outer>(Span<const Vector3d>(far)).covariance();
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) ASSERT_NEAR(covd.rows[r][c], ref.cov[r][c], 1e-5);
+    }
+}
+
+void test_parallel_merge() {
+    using namespace TinyGeo;
+    const std::vector<Vector3f> pts = randomPoints(300001, 3, 2.0f);
+    const auto serial = stats::reduce<stats::All>(Span<const Vector3f>(pts));
+    const auto parallel = stats::reduce<stats::All>(execution::on(testPool()), Span<const Vector3f>(pts));
+    const auto again = stats::reduce<stats::All>(execution::on(testPool()), Span<const Vector3f>(pts));
+    ASSERT_TRUE(parallel.count() == pts.size());
+    for (size_t r = 0; r < 3; ++r) {
+        ASSERT_TRUE(parallel.bounds().lo[r] == serial.bounds().lo[r] && parallel.bounds().hi[r] == serial.bounds().hi[r]);
+        ASSERT_NEAR(parallel.centroid()[r], serial.centroid()[r], 1e-5f);
+        ASSERT_TRUE(again.centroid()[r] == parallel.centroid()[r]); // Determinista
+        for (size_t c = 0; c < 3; ++c) {
+            ASSERT_NEAR(parallel.covariance().rows[r][c], serial.covariance().rows[r][c], 1e-5f);
+        }
+    }
+
+    // Hilos propios: un acumulador por hilo y merge al final
+    const size_t threads = 4;
+    std::vector<stats::Accumulator<float, 3, stats::All>> partial(threads);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            const size_t b = pts.size() * t / threads, e = pts.size() * (t + 1) / threads;
+            partial[t].add(Span<const Vector3f>(pts).subspan(b, e - b));
+        });
+    }
+    for (std::thread& w : workers) w.join();
+    stats::Accumulator<float, 3, stats::All> total;
+    for (const auto& p : partial) total.merge(p);
+    ASSERT_TRUE(total.count() == pts.size());
+    for (size_t r = 0; r < 3; ++r) {
+        ASSERT_TRUE(total.bounds().lo[r] == serial.bounds().lo[r]);
+        ASSERT_NEAR(total.sum()[r], serial.sum()[r], 1.0f);
+        for (size_t c = 0; c < 3; ++c) ASSERT_NEAR(total.outerSum().rows[r][c] / float(pts.size()),
+                                                   serial.outerSum().rows[r][c] / float(pts.size()), 1e-4f);
+    }
+}
+
+int main() {
+    test_fields();
+    test_far_from_origin();
+    test_parallel_merge();
+    std::cout << "Statistics tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "TinyGeo/TextIO.h"
+#include "TestCommon.h"
+
+template <typename T>
+void check_roundtrip() {
+    using namespace TinyGeo;
+    using V = Vector<T, 3>;
+    std::vector<V> pts;
+    uint32_t s = 7u;
+    for (size_t i = 0; i < 5000; ++i) {
+        V v;
+        for (size_t k = 0; k < 3; ++k) {
+            s = s * 1664525u + 1013904223u;
+            v[k] = (T(s) / T(4294967296.0) - T(0.5)) * T(1e6) / T(i + 1);
+        }
+        pts.push_back(v);
+    }
+    pts.push_back({std::numeric_limits<T>::max(), -std::numeric_limits<T>::denorm_min(), T(0)});
+
+    std::vector<char> buf(pts.size() * io::maxChars<V>());
+    io::ToCharsResult w = io::toChars(buf.data(), buf.data() + buf.size(), Span<const V>(pts));
+    ASSERT_TRUE(w.ec == std::errc() && w.count == pts.size());
+
+    // Secuencial: bit a bit igual (round trip más corto)
+    std::vector<V> back(pts.size());
+    io::FromCharsResult r = io::fromChars(buf.data(), w.ptr, Span<V>(back));
+    ASSERT_TRUE(r.ec == std::errc() && r.count == pts.size() && r.ptr == w.ptr);
+    ASSERT_TRUE(std::memcmp(back.data(), pts.data(), pts.size() * sizeof(V)) == 0);
+
+    // Paralelo: mismo resultado
+    ThreadPool pool(3);
+    std::vector<V> par;
+    io::FromCharsResult pr = io::fromCharsParallel(pool, buf.data(), w.ptr, par);
+    ASSERT_TRUE(pr.ec == std::errc() && par.size() == pts.size());
+    ASSERT_TRUE(std::memcmp(par.data(), pts.data(), pts.size() * sizeof(V)) == 0);
+}
+
+void test_format() {
+    using namespace TinyGeo;
+    std::vector<Vector<float, 3>> v = {{1.5f, -2.0f, 3.25f}, {0.1f, 0.0f, 1e20f}};
+    char buf[128];
+    io::ToCharsResult w = io::toChars(buf, buf + sizeof(buf), Span<const Vector<float, 3>>(v));
+    ASSERT_TRUE(std::string(buf, w.ptr) == "[1.5, -2, 3.25]\n[0.1, 0, 1e+20]\n");
+
+    // Mismo aspecto que operator<< (más el salto de línea)
+    std::ostringstream ref;
+    ref << v[0] << "\n";
+    ASSERT_TRUE(ref.str() == "[1.5, -2, 3.25]\n");
+
+    // Buffer corto: solo vectores completos
+    io::ToCharsResult partial = io::toChars(buf, buf + 20, Span<const Vector<float, 3>>(v));
+    ASSERT_TRUE(partial.ec == std::errc::value_too_large && partial.count == 1);
+    ASSERT_TRUE(partial.ptr - buf == 16);
+
+    std::ostringstream os;
+    io::writeText(os, Span<const Vector<float, 3>>(v));
+    ASSERT_TRUE(os.str() == "[1.5, -2, 3.25]\n[0.1, 0, 1e+20]\n");
+
+    std::cout << "[PASS] toChars format" << std::endl;
+}
+
+void test_parse_errors() {
+    using namespace TinyGeo;
+    Vector<double, 2> out[4];
+    const std::string text = "  [1, 2]\n\n[3 ,4]\r\n[5, x]\n";
+    io::FromCharsResult r = io::fromChars(text.data(), text.data() + text.size(), Span<Vector<double, 2>>(out, 4));
+    ASSERT_TRUE(r.ec == std::errc::invalid_argument && r.count == 2);
+    ASSERT_TRUE(*r.ptr == '[' && r.ptr[4] == 'x');
+    ASSERT_NEAR(out[1][0], 3.0, 1e-12);
+
+    // El error se informa también en paralelo, con los vectores previos
+    std::string big;
+    for (int i = 0; i < 100000; ++i) big += "[1, 2]\n";
+    big += "[3, 4, 5]\n";
+    std::vector<Vector<double, 2>> par;
+    ThreadPool pool(3);
+    io::FromCharsResult pr = io::fromCharsParallel(pool, big.data(), big.data() + big.size(), par);
+    ASSERT_TRUE(pr.ec == std::errc::invalid_argument && par.size() == 100000);
+    ASSERT_TRUE(pr.ptr == big.data() + 100000 * 7);
+
+    std::cout << "[PASS] fromChars errors" << std::endl;
+}
+
+int main() {
+    test_format();
+    check_roundtrip<float>();
+    check_roundtrip<double>();
+    std::cout << "[PASS] toChars / fromChars round trip (sequential and parallel)" << std::endl;
+    test_parse_errors();
+    return 0;
+}
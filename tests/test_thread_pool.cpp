@@ -0,0 +1,106 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "TinyGeo/ParallelBatch.h"
+#include "TestCommon.h"
+
+void test_parallel_for_covers_range() {
+    using namespace TinyGeo;
+    ThreadPool pool(3);
+    std::vector<int> hits(10007, 0);
+    pool.parallelFor(hits.size(), 100, [&](size_t b, size_t e) {
+        for (size_t i = b; i < e; ++i) hits[i] += 1;
+    });
+    for (int h : hits) ASSERT_TRUE(h == 1);
+
+    // Vacío y un solo chunk: se ejecuta en el llamador
+    pool.parallelFor(0, 10, [&](size_t, size_t) { ASSERT_TRUE(false); });
+    size_t calls = 0;
+    pool.parallelFor(5, 10, [&](size_t b, size_t e) { calls += e - b; });
+    ASSERT_TRUE(calls == 5);
+
+    std::cout << "[PASS] parallelFor coverage" << std::endl;
+}
+
+void test_work_stealing_and_nesting() {
+    using namespace TinyGeo;
+    ThreadPool pool(3);
+    std::atomic<size_t> total{0};
+
+    // Chunks muy desbalanceados: los primeros tardan mucho, el resto se roba
+    pool.parallelFor(64, 1, [&](size_t b, size_t) {
+        if (b < 4) std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        total.fetch_add(1);
+    });
+    ASSERT_TRUE(total.load() == 64);
+
+    // parallelFor anidado desde una tarea no debe bloquearse
+    std::atomic<size_t> inner{0};
+    pool.parallelFor(8, 1, [&](size_t, size_t) {
+        pool.parallelFor(100, 10, [&](size_t b, size_t e) { inner.fetch_add(e - b); });
+    });
+    ASSERT_TRUE(inner.load() == 800);
+
+    std::cout << "[PASS] Work stealing / nesting" << std::endl;
+}
+
+void test_parallel_batch_matches_serial() {
+    using namespace TinyGeo;
+    using V = Vector<float, 3>;
+    ThreadPool pool(3);
+    const size_t count = 100003;
+    std::vector<V> a(count), b(count);
+    for (size_t i = 0; i < count; ++i) {
+        const float f = static_cast<float>(i);
+        a[i] = V{f, 1.0f - f, 0.5f};
+        b[i] = V{0.25f, f, -f};
+    }
+
+    std::vector<float> serial(count), parallel(count);
+    batch::dot(Span(a), Span(b), Span(serial));
+    batch::dot(pool, Span(a), Span(b), Span(parallel));
+    for (size_t i = 0; i < count; ++i) ASSERT_TRUE(serial[i] == parallel[i]);
+
+    std::vector<V> n1 = a, n2 = a;
+    batch::normalize(Span(n1));
+    batch::normalize(execution::on(pool), Span(n2));
+    batch::axpy(execution::par, 2.0f, Span(b), Span(n2));
+    batch::axpy(2.0f, Span(b), Span(n1));
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t k = 0; k < 3; ++k) ASSERT_TRUE(n1[i][k] == n2[i][k]);
+    }
+
+    std::cout << "[PASS] Parallel batch" << std::endl;
+}
+
+void test_chunk_grain_avoids_false_sharing() {
+    using namespace TinyGeo;
+    ThreadPool pool(7);
+    // Cada chunk de salida debe cubrir líneas de caché completas
+    const size_t g1 = batch::detail::chunkGrain<Vector<float, 3>, float>(1 << 24, pool);
+    const size_t g2 = batch::detail::chunkGrain<Vector<float, 3>, Vector<float, 3>>(1000, pool);
+    ASSERT_TRUE((g1 * sizeof(float)) % kCacheLine == 0);
+    ASSERT_TRUE((g2 * sizeof(Vector<float, 3>)) % kCacheLine == 0);
+
+    // sizeof(Out) = 12 no divide 64: el prefijo deja out + head en un
+    // límite de línea para cualquier dirección múltiplo de 4
+    using P = Vector<float, 3>;
+    std::vector<P, AlignedAllocator<P>> buf(64);
+    for (size_t offset = 0; offset < 16; ++offset) {
+        const P* out = reinterpret_cast<const P*>(reinterpret_cast<const char*>(buf.data()) + 4 * offset);
+        const size_t head = batch::detail::alignmentHead(out, 1000);
+        ASSERT_TRUE(reinterpret_cast<uintptr_t>(out + head) % kCacheLine == 0);
+    }
+    std::cout << "[PASS] Chunk grain" << std::endl;
+}
+
+int main() {
+    test_parallel_for_covers_range();
+    test_work_stealing_and_nesting();
+    test_parallel_batch_matches_serial();
+    test_chunk_grain_avoids_false_sharing();
+    return 0;
+}
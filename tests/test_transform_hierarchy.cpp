@@ -0,0 +1,157 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "TinyGeo/TransformHierarchy.h"
+#include "TestCommon.h"
+
+namespace {
+
+    using TinyGeo::Vector;
+    using Hierarchy = TinyGeo::TransformHierarchy<double>;
+
+    uint32_t nextRandom(uint32_t& s) {
+        s = s * 1664525u + 1013904223u;
+        return s;
+    }
+
+    double uniform(uint32_t& s, double lo, double hi) { return lo + (hi - lo) * double(nextRandom(s) >> 8) / double(1u << 24); }
+
+    TinyGeo::Transform<double> randomTransform(uint32_t& s) {
+        TinyGeo::Transform<double> t;
+        t.translation = Vector<double, 3>(uniform(s, -1, 1), uniform(s, -1, 1), uniform(s, -1, 1));
+        t.rotation = TinyGeo::Quaterniond::fromAxisAngle(
+            Vector<double, 3>(uniform(s, -1, 1), uniform(s, -1, 1), uniform(s, 0.1, 1)), uniform(s, -3, 3));
+        t.scale = Vector<double, 3>(uniform(s, 0.9, 1.1), uniform(s, 0.9, 1.1), uniform(s, 0.9, 1.1));
+        return t;
+    }
+
+    // Referencia: world = world(padre) * local con el producto genérico de
+    // Matrix, nodo a nodo en orden de inserción (padre < hijo)
+    void checkAgainstReference(const Hierarchy& h) {
+        std::vector<Hierarchy::Mat4> world(h.size());
+        for (Hierarchy::NodeId id = 0; id < h.size(); ++id) {
+            const Hierarchy::NodeId p = h.parent(id);
+            world[id] = p == Hierarchy::kNoParent ? h.local(id) : world[p] * h.local(id);
+            for (size_t r = 0; r < 4; ++r) {
+                for (size_t c = 0; c < 4; ++c) ASSERT_NEAR(h.world(id)(r, c), world[id](r, c), 1e-9);
+            }
+        }
+    }
+
+} // namespace
+
+void test_transform_matrix() {
+    using namespace TinyGeo;
+    uint32_t seed = 3;
+    const Transform<double> t = randomTransform(seed);
+    const Matrix<double, 4, 4> m = t.toMatrix();
+    const Vector<double, 3> p(0.3, -1.2, 2.5);
+    const Vector<double, 3> scaled(p[0] * t.scale[0], p[1] * t.scale[1], p[2] * t.scale[2]);
+    const Vector<double, 3> expected = t.translation + t.rotation.rotate(scaled);
+    const Vector<double, 3> got = transformPoint(m, p);
+    for (size_t k = 0; k < 3; ++k) ASSERT_NEAR(got[k], expected[k], 1e-12);
+
+    // toMatrix() es afín; una matriz proyectiva no pasa el assert de setLocal()
+    ASSERT_TRUE(detail::isAffine(m));
+    Matrix<double, 4, 4> projective = m;
+    projective.rows[3].data[2] = -1.0;
+    ASSERT_TRUE(!detail::isAffine(projective));
+
+    // Hijo de un padre trasladado: la posición de mundo se suma
+    Hierarchy h;
+    Transform<double> base;
+    base.translation = Vector<double, 3>(1, 2, 3);
+    const auto root = h.add(base);
+    const auto child = h.add(base, root);
+    ASSERT_TRUE(h.update() == 2);
+    ASSERT_NEAR(h.worldPosition(child)[0], 2.0, 1e-12);
+    ASSERT_NEAR(h.worldPosition(child)[2], 6.0, 1e-12);
+    std::cout << "[PASS] Transform TRS" << std::endl;
+}
+
+void test_incremental_update() {
+    using namespace TinyGeo;
+    uint32_t seed = 11;
+    Hierarchy h;
+    const size_t n = 5000;
+    // Varios árboles; padres elegidos al azar entre los nodos anteriores
+    for (size_t i = 0; i < n; ++i) {
+        const Hierarchy::NodeId parent =
+            i < 4 || nextRandom(seed) % 50 == 0 ? Hierarchy::kNoParent : Hierarchy::NodeId(nextRandom(seed) % i);
+        h.add(randomTransform(seed), parent);
+    }
+    ASSERT_TRUE(h.update() == n);
+    checkAgainstReference(h);
+    ASSERT_TRUE(h.update() == 0); // Nada marcado: nada que hacer
+
+    // Pocos nodos marcados: solo se recalculan sus subárboles
+    for (int round = 0; round < 20; ++round) {
+        std::vector<uint8_t> inDirty(n, 0);
+        for (int k = 0; k < 5; ++k) {
+            const auto node = Hierarchy::NodeId(nextRandom(seed) % n);
+            h.setLocal(node, randomTransform(seed));
+            inDirty[node] = 1;
+        }
+        // Esperado: nodos con algún ancestro (o él mismo) marcado
+        size_t expected = 0;
+        for (Hierarchy::NodeId id = 0; id < n; ++id) {
+            for (Hierarchy::NodeId a = id; a != Hierarchy::kNoParent; a = h.parent(a)) {
+                if (inDirty[a]) {
+                    ++expected;
+                    break;
+                }
+            }
+        }
+        ASSERT_TRUE(h.update() == expected);
+        checkAgainstReference(h);
+    }
+
+    // Nodos nuevos tras un update: reordenación y recálculo completo, los
+    // NodeId anteriores siguen siendo válidos
+    const Hierarchy::NodeId leaf = h.add(randomTransform(seed), 7);
+    h.setLocal(3, randomTransform(seed));
+    ASSERT_TRUE(h.update() == n + 1);
+    ASSERT_TRUE(h.parent(leaf) == 7);
+    checkAgainstReference(h);
+    ASSERT_TRUE(h.subtreeSize(leaf) == 1);
+    std::cout << "[PASS] Incremental update" << std::endl;
+}
+
+// Escena casi estática: un update con un nodo hoja marcado frente a un
+// recálculo completo
+void test_static_scene_cost() {
+    using namespace TinyGeo;
+    uint32_t seed = 5;
+    TransformHierarchy<float> h;
+    const size_t n = 200000;
+    for (size_t i = 0; i < n; ++i) {
+        Transform<float> t;
+        t.translation = Vector<float, 3>(float(uniform(seed, -1, 1)), 0.0f, 0.0f);
+        h.add(t, i == 0 ? TransformHierarchy<float>::kNoParent : TransformHierarchy<float>::NodeId(i / 4));
+    }
+    using Clock = std::chrono::steady_clock;
+    const auto t0 = Clock::now();
+    h.update();
+    const auto t1 = Clock::now();
+    size_t touched = 0;
+    for (int k = 0; k < 100; ++k) {
+        h.setLocal(TransformHierarchy<float>::NodeId(n - 1 - size_t(k)), Transform<float>{});
+        touched += h.update();
+    }
+    const auto t2 = Clock::now();
+    ASSERT_TRUE(touched == 100);
+    const double full = std::chrono::duration<double>(t1 - t0).count();
+    const double incremental = std::chrono::duration<double>(t2 - t1).count() / 100.0;
+    std::cout << "[PASS] Static scene: first update " << full * 1e3 << " ms, one leaf " << incremental * 1e6 << " us"
+              << std::endl;
+}
+
+int main() {
+    test_transform_matrix();
+    test_incremental_update();
+    test_static_scene_cost();
+    std::cout << "Transform hierarchy tests passed." << std::endl;
+    return 0;
+}
@@ -1,17 +1,12 @@
 #include <iostream>
 #include <cassert>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <type_traits>
 #include "TinyGeo/Vector.h"
+#include "TestCommon.h"
 
-// Una macro simple para validar flotantes con tolerancia
-#define ASSERT_NEAR(val1, val2, epsilon)                          \
-    do {                                                          \
-        if (std::abs((val1) - (val2)) >= (epsilon)) {            \
-            std::cerr << "ASSERT_NEAR failed: "                  \
-                      << #val1 << " vs " << #val2 << std::endl;  \
-            std::abort();                                        \
-        }                                                         \
-    } while (0)
 
 
 void test_arithmetic() {
@@ -45,9 +40,191 @@ void test_geometry() {
     std::cout << "[PASS] Geometry" << std::endl;
 }
 
+void test_aligned_storage() {
+    using namespace TinyGeo;
+    // El layout empaquetado no cambia
+    static_assert(sizeof(Vector<float, 3>) == 12);
+    static_assert(sizeof(Vector3A) == 16 && alignof(Vector3A) == 16);
+    static_assert(alignof(VectorA<double, 3>) == 32);
+
+    Vector3A a = {1.0f, 2.0f, 3.0f};
+    Vector3A b = {4.0f, 5.0f, 6.0f};
+    ASSERT_TRUE(a.data[3] == 0.0f);
+
+    Vector3A c = cross(a, b) * 2.0f + a;
+    c /= 3.0f;
+    c.normalize();
+    ASSERT_TRUE(c.data[3] == 0.0f); // El padding sigue en cero
+    ASSERT_NEAR(c.normSq(), 1.0f, 1e-5f);
+    ASSERT_NEAR(dot(a, b), 32.0f, 1e-5f);
+
+    // Mismo resultado que la versión empaquetada
+    Vector<float, 3> packed = cross(Vector<float, 3>(a), Vector<float, 3>(b));
+    Vector3A padded = cross(a, b);
+    for (size_t i = 0; i < 3; ++i) {
+        ASSERT_NEAR(packed[i], padded[i], 1e-6f);
+    }
+
+    std::cout << "[PASS] Aligned storage" << std::endl;
+}
+
+void test_elementwise() {
+    using namespace TinyGeo;
+    constexpr Vector<float, 3> a = {1.0f, -5.0f, 3.0f};
+    constexpr Vector<float, 3> b = {2.0f, -6.0f, -1.0f};
+    constexpr Vector<float, 3> lo = min(a, b);
+    static_assert(lo[0] == 1.0f && lo[1] == -6.0f && lo[2] == -1.0f);
+
+    Vector<float, 3> hi = max(a, b);
+    ASSERT_NEAR(hi[1], -5.0f, 1e-7f);
+    ASSERT_NEAR(abs(a)[1], 5.0f, 1e-7f);
+    Vector<float, 3> c = clamp(a, -2.0f, 2.0f);
+    ASSERT_NEAR(c[0], 1.0f, 1e-7f);
+    ASSERT_NEAR(c[1], -2.0f, 1e-7f);
+    ASSERT_NEAR(c[2], 2.0f, 1e-7f);
+    Vector<float, 3> cv = clamp(a, lo, Vector<float, 3>{1.5f, 0.0f, 0.0f});
+    ASSERT_NEAR(cv[0], 1.0f, 1e-7f);
+    ASSERT_NEAR(cv[2], 0.0f, 1e-7f);
+    Vector<float, 3> m = lerp(a, b, 0.25f);
+    ASSERT_NEAR(m[2], 2.0f, 1e-6f);
+
+    // El padding de AlignedStorage sigue en cero
+    Vector3A pa = clamp(abs(Vector3A(a)), 2.0f, 4.0f);
+    ASSERT_TRUE(pa.data[3] == 0.0f);
+    ASSERT_NEAR(pa[1], 4.0f, 1e-7f);
+
+    std::cout << "[PASS] Element-wise min / max / abs / clamp / lerp" << std::endl;
+}
+
+// Constantes geométricas evaluadas en compilación: viven en .rodata
+namespace basis {
+    constexpr TinyGeo::Vector<float, 3> X = {1.0f, 0.0f, 0.0f};
+    constexpr TinyGeo::Vector<float, 3> Y = {0.0f, 1.0f, 0.0f};
+    constexpr TinyGeo::Vector<float, 3> Z = TinyGeo::cross(X, Y);
+    constexpr TinyGeo::Vector<double, 2> Diag = TinyGeo::Vector<double, 2>{3.0, 4.0}.normalized();
+    constexpr TinyGeo::Vector3A ZA = TinyGeo::cross(TinyGeo::Vector3A(X), TinyGeo::Vector3A(Y));
+}
+
+void test_constexpr() {
+    using namespace TinyGeo;
+    static_assert(basis::Z.z() == 1.0f && basis::Z.x() == 0.0f);
+    static_assert(dot(basis::X, basis::Y) == 0.0f);
+    static_assert(basis::ZA[2] == 1.0f && basis::ZA.data[3] == 0.0f);
+
+    constexpr Vector<float, 3> sum = basis::X + basis::Y * 2.0f - basis::Z / 4.0f;
+    static_assert(sum.y() == 2.0f && sum.z() == -0.25f);
+
+    constexpr Vector<float, 3> acc = [] {
+        Vector<float, 3> v = basis::X;
+        v += basis::Y;
+        v *= 3.0f;
+        v -= basis::X;
+        return v;
+    }();
+    static_assert(acc.x() == 2.0f && acc.y() == 3.0f);
+
+    // normalized() en constexpr: 3-4-5
+    static_assert(basis::Diag.x() > 0.599999 && basis::Diag.x() < 0.600001);
+    static_assert(Vector<float, 4>{}.normalized().normSq() == 0.0f);
+
+    // Runtime y constexpr deben coincidir
+    Vector<double, 2> runtime = {3.0, 4.0};
+    ASSERT_NEAR(runtime.normalized().y(), basis::Diag.y(), 1e-15);
+
+    std::cout << "[PASS] Constexpr" << std::endl;
+}
+
+void test_construction() {
+    using namespace TinyGeo;
+    static_assert(std::is_trivially_copyable_v<Vector<float, 3>>);
+    static_assert(std::is_trivially_copyable_v<Vector3A>);
+    static_assert(std::is_nothrow_move_constructible_v<Vector<double, 8>>);
+
+    // Variadic y desde array: agregados en constexpr, padding en cero
+    constexpr Vector3A a(1, 2.5, 3.0f);
+    static_assert(a[1] == 2.5f && a.data[3] == 0.0f);
+    constexpr float raw[4] = {4.0f, 3.0f, 2.0f, 1.0f};
+    constexpr Vector<float, 4> b(raw);
+    static_assert(b.w() == 1.0f);
+    static_assert(!std::is_constructible_v<Vector<float, 3>, float, float>);
+    static_assert(!std::is_constructible_v<Vector<float, 3>, float, float, float, float>);
+    // Coma flotante -> entero no compila; double -> float y enteros sí
+    static_assert(std::is_constructible_v<Vector<float, 3>, double, double, double>);
+    static_assert(!std::is_constructible_v<Vector<int, 2>, float, float>);
+    static_assert(!std::is_constructible_v<Vector<int, 2>, int, double>);
+    Vector<float, 3> fromDoubles = {1.0, 2.0, 3.0};
+    ASSERT_TRUE(fromDoubles[2] == 3.0f);
+    static_assert(std::is_constructible_v<Vector<float, 3>, int, int, int>);
+    static_assert(std::is_constructible_v<Vector<double, 3>, float, int, double>);
+    // N == 1: solo explícito
+    static_assert(std::is_constructible_v<Vector<float, 1>, float>);
+    static_assert(!std::is_convertible_v<float, Vector<float, 1>>);
+
+    // memcpy es una copia válida
+    Vector3A c;
+    std::memcpy(static_cast<void*>(&c), &a, sizeof(a));
+    ASSERT_TRUE(c[0] == 1.0f && c[2] == 3.0f);
+
+#if !defined(TINYGEO_EXPRESSION_TEMPLATES)
+    // Operandos temporales reutilizados: mismos resultados que con lvalues
+    const Vector<float, 3> x = {1.0f, -2.0f, 0.5f};
+    const Vector<float, 3> y = {0.25f, 4.0f, 0.5f};
+    const Vector<float, 3> lv = x - y;
+    const Vector<float, 3> rv = x - Vector<float, 3>(y);
+    for (size_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(lv[i] == rv[i]);
+    }
+    // lhs - rhs en el sitio (no -(rhs - lhs)): x - x da +0
+    ASSERT_TRUE(!std::signbit((x - Vector<float, 3>(x))[2]));
+    const Vector<float, 3> chain = Vector<float, 3>(x) + y + (x * 2.0f) - (2.0f * y) / 2.0f;
+    ASSERT_NEAR(chain[1], -2.0f + 4.0f - 4.0f - 4.0f, 1e-6f);
+#endif
+    std::cout << "[PASS] Construction / trivially copyable / rvalue operators" << std::endl;
+}
+
+void test_fast_norm() {
+    using namespace TinyGeo;
+    const float bound = detail::FastMath<float>::kMaxRelError;
+    // Redondeo de normSq() y de la comparación contra norm(): unos pocos ULP extra
+    const double slack = 4.0 * 1.2e-7;
+
+    double worst = 0.0;
+    // Magnitudes de 1e-6 a 1e12 (por debajo de 1e-8 el resultado es el vector cero)
+    for (int e = -6; e <= 12; ++e) {
+        for (int i = 1; i <= 200; ++i) {
+            const float s = std::pow(10.0f, float(e)) * (float(i) / 37.0f);
+            Vector<float, 3> v = {s, -0.5f * s, 0.25f * s * float(i % 7)};
+            const double exact = std::sqrt(double(v.x()) * v.x() + double(v.y()) * v.y() + double(v.z()) * v.z());
+
+            const double errNorm = std::abs(v.fastNorm() - exact) / exact;
+            const double errUnit = std::abs(double(v.fastNormalized().norm()) - 1.0);
+            worst = std::max(worst, std::max(errNorm, errUnit));
+        }
+    }
+    ASSERT_TRUE(worst <= bound + slack);
+
+    // Caso cero: sin NaN ni saltos, igual que normalized()
+    Vector<float, 3> zero;
+    ASSERT_TRUE(zero.fastNorm() == 0.0f);
+    ASSERT_TRUE(zero.fastNormalized().normSq() == 0.0f);
+    Vector<double, 4> tiny = {1e-12, 0.0, 0.0, 0.0};
+    ASSERT_TRUE(tiny.fastNormalized().normSq() == 0.0);
+
+    // double usa la ruta exacta
+    Vector<double, 3> d = {3.0, 4.0, 12.0};
+    ASSERT_NEAR(d.fastNorm(), 13.0, 1e-14);
+
+    std::cout << "[PASS] Fast norm (max rel error " << worst << ")" << std::endl;
+}
+
 int main() {
     test_arithmetic();
     test_geometry();
+    test_aligned_storage();
+    test_elementwise();
+    test_constexpr();
+    test_construction();
+    test_fast_norm();
     // Si llegamos aquí, todo pasó. Retornar 0 es "Success" para CTest.
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "TinyGeo/VectorSoA.h"
+#include "TestCommon.h"
+
+void test_proxy_access() {
+    using namespace TinyGeo;
+    VectorSoA<float, 3> cloud;
+    cloud.push_back({1.0f, 2.0f, 3.0f});
+    cloud.push_back({4.0f, 5.0f, 6.0f});
+
+    ASSERT_TRUE(cloud.size() == 2);
+    ASSERT_NEAR(cloud[1].y(), 5.0f, 1e-6f);
+
+    // Escritura a través del proxy
+    cloud[0].z() = 10.0f;
+    cloud[1] = Vector<float, 3>{7.0f, 8.0f, 9.0f};
+    cloud[1] += Vector<float, 3>{1.0f, 1.0f, 1.0f};
+
+    Vector<float, 3> v = cloud[0];
+    ASSERT_NEAR(v.z(), 10.0f, 1e-6f);
+    ASSERT_NEAR(cloud.lane(0)[1], 8.0f, 1e-6f);
+    ASSERT_NEAR(cloud[1].dot(Vector<float, 3>{1.0f, 0.0f, 0.0f}), 8.0f, 1e-6f);
+
+    // Cada carril debe estar alineado
+    for (size_t k = 0; k < 3; ++k) {
+        ASSERT_TRUE(reinterpret_cast<uintptr_t>(cloud.lane(k)) % kCacheLine == 0);
+    }
+
+    std::cout << "[PASS] SoA proxy access" << std::endl;
+}
+
+void test_bulk_kernels() {
+    using namespace TinyGeo;
+    const size_t count = 1000; // No múltiplo del bloque: ejercita el resto
+    VectorSoA<float, 3> a(count);
+    VectorSoA<float, 3> b(count);
+    for (size_t i = 0; i < count; ++i) {
+        const float f = static_cast<float>(i);
+        a[i] = Vector<float, 3>{f, 1.0f, 0.0f};
+        b[i] = Vector<float, 3>{1.0f, 2.0f, f};
+    }
+    a[0] = Vector<float, 3>{}; // Vector cero
+
+    std::vector<float> out(count);
+    a.dot(b, out);
+    ASSERT_NEAR(out[10], 12.0f, 1e-5f);
+
+    a += b;
+    ASSERT_NEAR(a[10].x(), 11.0f, 1e-5f);
+    a *= 0.5f;
+    ASSERT_NEAR(a[10].y(), 1.5f, 1e-5f);
+
+    a.normalize();
+    a.normSq(out);
+    ASSERT_NEAR(out[0], 1.0f, 1e-4f);  // a[0] = 0.5 * b[0], no es cero
+    ASSERT_NEAR(out[999], 1.0f, 1e-4f);
+
+    VectorSoA<float, 3> zero(3);
+    zero.normalize();
+    ASSERT_NEAR(zero[1].normSq(), 0.0f, 1e-12f);
+
+    std::cout << "[PASS] SoA bulk kernels" << std::endl;
+}
+
+int main() {
+    test_proxy_access();
+    test_bulk_kernels();
+    return 0;
+}